@@ -27,6 +27,15 @@ namespace Constants {
     /** @brief 游戏刷新间隔（毫秒） */
     constexpr int kGameTickInterval = 200;
 
+    /** @brief 界面可回退的时长（秒） */
+    constexpr int kRewindSeconds = 10;
+
+    /** @brief 每按一次回退键回退的时长（秒） */
+    constexpr int kRewindStepSeconds = 1;
+
+    /** @brief 录像中周期性关键帧的间隔（帧） */
+    constexpr int kReplayKeyframeInterval = 1024;
+
     /** @brief 每个食物得分 */
     constexpr int kScorePerFood = 10;
 
@@ -54,6 +54,18 @@ public:
             default:               return QPoint(0, 0);
         }
     }
+
+    /**
+     * @brief 由单位位移向量得到方向（toOffset 的逆）
+     * @param offset 坐标偏移量
+     * @return 对应方向，非单位向量时按水平分量优先判断
+     */
+    static Direction fromOffset(const QPoint& offset) {
+        if (offset.x() > 0) return Direction::Right;
+        if (offset.x() < 0) return Direction::Left;
+        if (offset.y() < 0) return Direction::Up;
+        return Direction::Down;
+    }
 };
 
 }  // namespace SnakeGame
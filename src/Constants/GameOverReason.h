@@ -0,0 +1,25 @@
+/**
+ * @file GameOverReason.h
+ * @brief 游戏结束原因枚举
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef GAMEOVERREASON_H
+#define GAMEOVERREASON_H
+
+namespace SnakeGame {
+
+/**
+ * @brief 游戏结束原因
+ */
+enum class GameOverReason {
+    None,           ///< 游戏尚未结束
+    WallCollision,  ///< 撞墙
+    SelfCollision,  ///< 撞到自身
+    BoardFilled     ///< 蛇填满整个游戏区域（获胜）
+};
+
+}  // namespace SnakeGame
+
+#endif  // GAMEOVERREASON_H
@@ -16,8 +16,10 @@ namespace SnakeGame {
  * 用于在程序启动时选择前端渲染方式
  */
 enum class RendererType {
-    Widget,  ///< QPainter 方式（默认）
-    Scene    ///< QGraphicsScene 方式
+    Widget,   ///< QPainter 方式（默认）
+    Scene,    ///< QGraphicsScene 方式
+    Threaded, ///< 工作线程绘制 QImage，GUI 线程只贴图
+    Raster    ///< 直接写入 RGB32 帧缓冲，只重绘变化的格子
 };
 
 }  // namespace SnakeGame
@@ -0,0 +1,125 @@
+/**
+ * @file BodyBench.cpp
+ * @brief 蛇身存储基准实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "BodyBench.h"
+#include "HamiltonCycle.h"
+#include "Snake.h"
+#include <QElapsedTimer>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief 蛇头沿回路走到下一格（紧凑存储按当前方向推算，须先设好方向）
+ */
+void advance(Snake& snake, const QPoint& next, bool grow)
+{
+    snake.restoreDirection(DirectionHelper::fromOffset(next - snake.getHead()));
+    if (grow) {
+        snake.grow(next);
+    } else {
+        snake.move(next);
+    }
+}
+
+/**
+ * @brief 从回路起点长出指定长度的蛇（不计时）
+ * @return 蛇头所在的回路序号
+ */
+int layOut(Snake& snake, const HamiltonCycle& cycle, int length)
+{
+    snake.reset(cycle.at(0), 1, Direction::Right);
+    for (int i = 1; i < length; ++i) {
+        advance(snake, cycle.at(i), true);
+    }
+    return length - 1;
+}
+
+}  // namespace
+
+BodyBench::BodyBench(const BodyBenchConfig& config)
+    : config_(config)
+{
+}
+
+BodyBenchResult BodyBench::run()
+{
+    BodyBenchResult result;
+    result.ticks = config_.ticks;
+
+    const auto cycle = HamiltonCycle::forBoard(config_.boardWidth, config_.boardHeight);
+    const int cells = cycle->size();
+    result.snakeLength = std::clamp(static_cast<int>(cells * config_.snakeFraction), 2, cells - 1);
+
+    std::unique_ptr<PerfCounters> counters;
+    if (config_.counters) {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->isAvailable()) {
+            result.countersUnavailable = counters->unavailableReason();
+            counters.reset();
+        }
+    }
+
+    // 两种存储走完全相同的路线，每帧的蛇头与蛇尾记下来供比对
+    std::vector<QPoint> ends(static_cast<size_t>(config_.ticks) * 2);
+    Snake snakes[2];
+
+    for (int pass = 0; pass < 2; ++pass) {
+        const bool compact = pass == 1;
+        Snake& snake = snakes[pass];
+        // 坐标列表每长一节都要整体搬移，先用紧凑存储长出蛇身再转换，开局保持 O(n)
+        snake.setCompact(true);
+        snake.reserve(cells);
+        int head = layOut(snake, *cycle, result.snakeLength);
+        snake.setCompact(compact);
+
+        QElapsedTimer timer;
+        timer.start();
+        if (counters) {
+            counters->start();
+        }
+        for (qint64 tick = 0; tick < config_.ticks; ++tick) {
+            head = (head + 1) % cells;
+            advance(snake, cycle->at(head), false);
+
+            QPoint* slot = &ends[static_cast<size_t>(tick) * 2];
+            if (!compact) {
+                slot[0] = snake.getHead();
+                slot[1] = snake.getTail();
+            } else if (slot[0] != snake.getHead() || slot[1] != snake.getTail()) {
+                ++result.mismatches;
+            }
+        }
+        if (counters) {
+            *(compact ? &result.compactCounters : &result.vectorCounters) = counters->stop();
+        }
+        const double seconds = timer.nsecsElapsed() / 1e9;
+
+        if (compact) {
+            result.compactSeconds = seconds;
+            result.compactBytes = snake.memoryBytes();
+        } else {
+            result.vectorSeconds = seconds;
+            result.vectorBytes = snake.memoryBytes();
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const QVector<QPoint>& expanded = snakes[1].getBody();
+    result.expandSeconds = timer.nsecsElapsed() / 1e9;
+    if (expanded != snakes[0].getBody()) {
+        ++result.mismatches;
+    }
+    return result;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,73 @@
+/**
+ * @file BodyBench.h
+ * @brief 蛇身存储基准 - 紧凑方向码对比坐标列表
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef BODYBENCH_H
+#define BODYBENCH_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include "PerfCounters.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 基准配置
+ */
+struct BodyBenchConfig {
+    int boardWidth = 1024;          ///< 棋盘宽度（格数为偶数）
+    int boardHeight = 1024;         ///< 棋盘高度
+    double snakeFraction = 0.25;    ///< 蛇长占格数的比例
+    qint64 ticks = 200;             ///< 推进的帧数
+    bool counters = true;           ///< 是否读取硬件性能计数器
+};
+
+/**
+ * @brief 基准结果
+ */
+struct BodyBenchResult {
+    int snakeLength = 0;            ///< 蛇长
+    qint64 ticks = 0;               ///< 推进的帧数
+    qint64 mismatches = 0;          ///< 两种存储蛇头、蛇尾或展开结果不一致的次数（应为 0）
+    double vectorSeconds = 0.0;     ///< 坐标列表存储的移动耗时
+    double compactSeconds = 0.0;    ///< 紧凑存储的移动耗时
+    double expandSeconds = 0.0;     ///< 紧凑蛇身展开一次的耗时
+    qint64 vectorBytes = 0;         ///< 坐标列表存储占用的字节数
+    qint64 compactBytes = 0;        ///< 紧凑存储占用的字节数
+    PerfSample vectorCounters;      ///< 坐标列表一遍的硬件计数
+    PerfSample compactCounters;     ///< 紧凑存储一遍的硬件计数
+    QString countersUnavailable;    ///< 计数器不可用的原因（可用或未开启时为空）
+};
+
+/**
+ * @brief 蛇身存储基准
+ *
+ * 蛇沿整张棋盘的哈密顿回路前进，蛇长保持不变，分别用默认的 QVector<QPoint>
+ * 和紧凑存储（Snake::setCompact）推进同样的帧数并计时。每帧比对两种存储的
+ * 蛇头与蛇尾，结束时比对紧凑蛇身展开后的完整坐标列表。
+ */
+class BodyBench {
+public:
+    /**
+     * @brief 构造函数
+     * @param config 基准配置
+     */
+    explicit BodyBench(const BodyBenchConfig& config);
+
+    /**
+     * @brief 运行基准（单线程，阻塞直到完成）
+     * @return 结果
+     */
+    BodyBenchResult run();
+
+private:
+    BodyBenchConfig config_;    ///< 基准配置
+};
+
+}  // namespace SnakeGame
+
+#endif  // BODYBENCH_H
@@ -0,0 +1,162 @@
+/**
+ * @file PerfCounters.cpp
+ * @brief 硬件性能计数器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "PerfCounters.h"
+
+#ifdef Q_OS_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace SnakeGame {
+
+const char* PerfSample::name(Counter counter)
+{
+    switch (counter) {
+        case Cycles:       return "cycles";
+        case Instructions: return "instructions";
+        case L1dMisses:    return "L1d-misses";
+        case LlcMisses:    return "LLC-misses";
+        case BranchMisses: return "branch-misses";
+        default:           return "unknown";
+    }
+}
+
+#ifdef Q_OS_LINUX
+
+namespace {
+
+/**
+ * @brief 打开一个只统计本线程用户态的计数器（初始为停止状态）
+ * @return 文件描述符，失败时返回 -1 并保留 errno
+ */
+int openCounter(quint32 type, quint64 config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters()
+{
+    const quint64 l1dReadMiss = PERF_COUNT_HW_CACHE_L1D |
+                                (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    fds_[PerfSample::Cycles] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    const int cyclesError = errno;
+    fds_[PerfSample::Instructions] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds_[PerfSample::L1dMisses] = openCounter(PERF_TYPE_HW_CACHE, l1dReadMiss);
+    fds_[PerfSample::LlcMisses] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds_[PerfSample::BranchMisses] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+
+    if (!isAvailable()) {
+        reason_ = QString::fromLocal8Bit(std::strerror(cyclesError));
+        if (cyclesError == EACCES || cyclesError == EPERM) {
+            reason_ += " (check /proc/sys/kernel/perf_event_paranoid)";
+        } else if (cyclesError == ENOSYS) {
+            reason_ += " (perf_event_open blocked, e.g. inside a container)";
+        } else if (cyclesError == ENOENT || cyclesError == EOPNOTSUPP) {
+            reason_ += " (no hardware PMU exposed, e.g. inside a virtual machine)";
+        }
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+}
+
+bool PerfCounters::isAvailable() const
+{
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start()
+{
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+PerfSample PerfCounters::stop()
+{
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    PerfSample sample;
+    for (int i = 0; i < PerfSample::CounterCount; ++i) {
+        // value、time_enabled、time_running
+        quint64 data[3];
+        if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+            continue;
+        }
+        // 计数器多于硬件槽位时内核轮流调度，按实际运行时间比例放大
+        sample.values[i] = data[2] < data[1]
+            ? static_cast<quint64>(static_cast<double>(data[0]) * data[1] / data[2])
+            : data[0];
+        sample.valid[i] = true;
+    }
+    return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+    : reason_("not supported on this platform")
+{
+    for (int& fd : fds_) {
+        fd = -1;
+    }
+}
+
+PerfCounters::~PerfCounters() = default;
+
+bool PerfCounters::isAvailable() const
+{
+    return false;
+}
+
+void PerfCounters::start()
+{
+}
+
+PerfSample PerfCounters::stop()
+{
+    return PerfSample();
+}
+
+#endif
+
+}  // namespace SnakeGame
@@ -0,0 +1,84 @@
+/**
+ * @file PerfCounters.h
+ * @brief 硬件性能计数器 - Linux perf_event_open 的薄封装，不可用时优雅退化
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <QString>
+#include <QtGlobal>
+
+namespace SnakeGame {
+
+/**
+ * @brief 一次计数的结果
+ */
+struct PerfSample {
+    /**
+     * @brief 计数器种类
+     */
+    enum Counter {
+        Cycles,             ///< CPU 周期
+        Instructions,       ///< 退休指令数
+        L1dMisses,          ///< L1 数据缓存读未命中
+        LlcMisses,          ///< 末级缓存未命中
+        BranchMisses,       ///< 分支预测失败
+        CounterCount
+    };
+
+    quint64 values[CounterCount] = {};  ///< 计数值（多路复用时已按运行时间比例放大）
+    bool valid[CounterCount] = {};      ///< 该计数器是否可用
+
+    /**
+     * @brief 计数器的显示名
+     */
+    static const char* name(Counter counter);
+};
+
+/**
+ * @brief 当前线程的硬件性能计数器
+ *
+ * 每个计数器单独打开（不组成一组），某一项不受支持时其余照常工作；
+ * 只统计用户态。非 Linux 平台、内核禁止（perf_event_paranoid）
+ * 或容器屏蔽系统调用时 isAvailable() 返回 false，start()/stop() 什么也不做。
+ */
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief 是否至少有一个计数器可用
+     */
+    bool isAvailable() const;
+
+    /**
+     * @brief 不可用的原因（可用时为空）
+     */
+    const QString& unavailableReason() const { return reason_; }
+
+    /**
+     * @brief 清零并开始计数
+     */
+    void start();
+
+    /**
+     * @brief 停止计数并读出
+     * @return 各计数器的值，不可用的计数器 valid 为 false
+     */
+    PerfSample stop();
+
+private:
+    int fds_[PerfSample::CounterCount];     ///< 各计数器的文件描述符，-1 表示不可用
+    QString reason_;                        ///< 不可用的原因
+};
+
+}  // namespace SnakeGame
+
+#endif  // PERFCOUNTERS_H
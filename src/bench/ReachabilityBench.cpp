@@ -0,0 +1,255 @@
+/**
+ * @file ReachabilityBench.cpp
+ * @brief 可达区域查询基准实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ReachabilityBench.h"
+#include "OccupancyGrid.h"
+#include "Reachability.h"
+#include <QElapsedTimer>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief 取格子的 4 个邻居（棋盘不回绕）
+ * @return 邻居数
+ */
+int neighborsOf(int cell, int width, int height, int out[4])
+{
+    const int x = cell % width;
+    const int y = cell / width;
+    int n = 0;
+    if (x > 0) {
+        out[n++] = cell - 1;
+    }
+    if (x < width - 1) {
+        out[n++] = cell + 1;
+    }
+    if (y > 0) {
+        out[n++] = cell - width;
+    }
+    if (y < height - 1) {
+        out[n++] = cell + width;
+    }
+    return n;
+}
+
+}  // namespace
+
+ReachabilityBench::ReachabilityBench(const ReachabilityBenchConfig& config)
+    : config_(config)
+    , epoch_(0)
+{
+    const size_t cells = static_cast<size_t>(config.boardWidth) * static_cast<size_t>(config.boardHeight);
+    stamps_.assign(cells, 0);
+    stack_.reserve(cells);
+}
+
+ReachabilityBenchResult ReachabilityBench::run()
+{
+    ReachabilityBenchResult result;
+    const int cells = config_.boardWidth * config_.boardHeight;
+    result.snakeLength = std::clamp(static_cast<int>(cells * config_.snakeFraction), 2, cells - 2);
+
+    // 每帧最多 4 个候选格 + 蛇头面积 + 蛇头到蛇尾
+    std::vector<qint32> answers;
+    answers.reserve(static_cast<size_t>(config_.ticks) * 6);
+
+    std::unique_ptr<PerfCounters> counters;
+    if (config_.counters) {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->isAvailable()) {
+            result.countersUnavailable = counters->unavailableReason();
+            counters.reset();
+        }
+    }
+
+    result.incrementalSeconds = runPass(true, answers, result, counters.get(),
+                                        &result.incrementalCounters);
+    result.floodSeconds = runPass(false, answers, result, counters.get(), &result.floodCounters);
+    return result;
+}
+
+double ReachabilityBench::runPass(bool incremental, std::vector<qint32>& answers,
+                                  ReachabilityBenchResult& result,
+                                  PerfCounters* counters, PerfSample* sample)
+{
+    const int width = config_.boardWidth;
+    const int height = config_.boardHeight;
+    const int length = result.snakeLength;
+
+    OccupancyGrid occupancy(width, height);
+    Reachability reachability(occupancy);
+    std::mt19937_64 engine(config_.seed);
+
+    // 蛇身环形缓冲区：body[tail] 为蛇尾，按顺序走向蛇头
+    std::vector<int> body(static_cast<size_t>(length));
+    int tail = 0;
+    int head = 0;
+    auto restart = [&]() {
+        occupancy.clear();
+        for (int i = 0; i < length; ++i) {
+            const int y = i / width;
+            const int x = (y & 1) ? width - 1 - i % width : i % width;
+            body[static_cast<size_t>(i)] = y * width + x;
+            occupancy.set(QPoint(x, y));
+        }
+        tail = 0;
+        head = body[static_cast<size_t>(length - 1)];
+        reachability.reset(false);
+    };
+    auto point = [width](int cell) { return QPoint(cell % width, cell / width); };
+
+    restart();
+    size_t answer = 0;
+    qint64 queries = 0;
+    qint64 restarts = 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    if (counters) {
+        counters->start();
+    }
+
+    for (qint64 tick = 0; tick < config_.ticks; ++tick) {
+        const int tailCell = body[static_cast<size_t>(tail)];
+        int candidates[4];
+        const int candidateCount = neighborsOf(head, width, height, candidates);
+
+        // 查询：每个候选格所在区域的格数、蛇头可达面积、蛇头能否走到蛇尾
+        qint32 areas[4];
+        qint32 headArea;
+        qint32 headReachesTail;
+        if (incremental) {
+            for (int i = 0; i < candidateCount; ++i) {
+                areas[i] = reachability.regionSize(point(candidates[i]));
+            }
+            headArea = reachability.reachableArea(point(head));
+            headReachesTail = reachability.connected(point(head), point(tailCell)) ? 1 : 0;
+        } else {
+            int starts[4];
+            int startCount = 0;
+            for (int i = 0; i < candidateCount; ++i) {
+                const bool free = !occupancy.test(point(candidates[i]));
+                areas[i] = free ? floodFill(occupancy, &candidates[i], 1) : 0;
+                if (free) {
+                    starts[startCount++] = candidates[i];
+                }
+            }
+            headArea = floodFill(occupancy, starts, startCount);
+
+            int around[4];
+            headReachesTail = 0;
+            for (int i = 0, n = neighborsOf(tailCell, width, height, around); i < n; ++i) {
+                if (around[i] == head || stamps_[static_cast<size_t>(around[i])] == epoch_) {
+                    headReachesTail = 1;
+                }
+            }
+        }
+
+        const qint32 tickAnswers[6] = {
+            candidateCount > 0 ? areas[0] : 0, candidateCount > 1 ? areas[1] : 0,
+            candidateCount > 2 ? areas[2] : 0, candidateCount > 3 ? areas[3] : 0,
+            headArea, headReachesTail
+        };
+        for (qint32 value : tickAnswers) {
+            if (incremental) {
+                answers.push_back(value);
+            } else if (answers[answer++] != value) {
+                ++result.mismatches;
+            }
+        }
+        queries += candidateCount + 2;
+
+        // 朝可达面积最大的候选格移动，并列时随机选；蛇尾会让出，视为面积 1
+        int next = -1;
+        qint32 bestArea = 0;
+        int ties = 0;
+        for (int i = 0; i < candidateCount; ++i) {
+            const qint32 area = candidates[i] == tailCell ? 1 : areas[i];
+            if (area <= 0) {
+                continue;
+            }
+            if (area > bestArea) {
+                bestArea = area;
+                next = candidates[i];
+                ties = 1;
+            } else if (area == bestArea &&
+                       std::uniform_int_distribution<int>(0, ties++)(engine) == 0) {
+                next = candidates[i];
+            }
+        }
+        if (next < 0) {
+            restart();
+            ++restarts;
+            continue;
+        }
+
+        occupancy.reset(point(tailCell));
+        if (incremental) {
+            reachability.unblock(point(tailCell));
+        }
+        occupancy.set(point(next));
+        if (incremental) {
+            reachability.block(point(next));
+        }
+        body[static_cast<size_t>(tail)] = next;
+        head = next;
+        tail = (tail + 1) % length;
+    }
+
+    if (counters) {
+        *sample = counters->stop();
+    }
+    const double seconds = timer.nsecsElapsed() / 1e9;
+    result.ticks = config_.ticks;
+    result.queries = queries;
+    result.restarts = restarts;
+    if (incremental) {
+        result.relabels = reachability.getRelabelCount();
+    }
+    return seconds;
+}
+
+int ReachabilityBench::floodFill(const OccupancyGrid& occupancy, const int* starts, int count)
+{
+    if (++epoch_ == 0) {
+        std::fill(stamps_.begin(), stamps_.end(), 0u);
+        epoch_ = 1;
+    }
+
+    const int width = config_.boardWidth;
+    const int height = config_.boardHeight;
+    int visited = 0;
+    for (int i = 0; i < count; ++i) {
+        if (stamps_[static_cast<size_t>(starts[i])] != epoch_) {
+            stamps_[static_cast<size_t>(starts[i])] = epoch_;
+            stack_.push_back(starts[i]);
+        }
+    }
+
+    int around[4];
+    while (!stack_.empty()) {
+        const int cell = stack_.back();
+        stack_.pop_back();
+        ++visited;
+        for (int i = 0, n = neighborsOf(cell, width, height, around); i < n; ++i) {
+            const int next = around[i];
+            if (stamps_[static_cast<size_t>(next)] != epoch_ &&
+                !occupancy.test(QPoint(next % width, next / width))) {
+                stamps_[static_cast<size_t>(next)] = epoch_;
+                stack_.push_back(next);
+            }
+        }
+    }
+    return visited;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,99 @@
+/**
+ * @file ReachabilityBench.h
+ * @brief 可达区域查询基准 - 增量连通分量对比逐次洪水填充
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef REACHABILITYBENCH_H
+#define REACHABILITYBENCH_H
+
+#include <QString>
+#include <QtGlobal>
+#include <vector>
+
+#include "PerfCounters.h"
+
+namespace SnakeGame {
+
+class OccupancyGrid;
+
+/**
+ * @brief 基准配置
+ */
+struct ReachabilityBenchConfig {
+    int boardWidth = 1024;          ///< 棋盘宽度
+    int boardHeight = 1024;         ///< 棋盘高度
+    double snakeFraction = 0.25;    ///< 蛇长占格数的比例
+    qint64 ticks = 200;             ///< 推进的帧数
+    quint64 seed = 1;               ///< 随机种子
+    bool counters = true;           ///< 是否读取硬件性能计数器
+};
+
+/**
+ * @brief 基准结果
+ */
+struct ReachabilityBenchResult {
+    int snakeLength = 0;            ///< 蛇长
+    qint64 ticks = 0;               ///< 推进的帧数
+    qint64 queries = 0;             ///< 每种实现回答的查询数
+    qint64 restarts = 0;            ///< 蛇被困死后重新开始的次数
+    qint64 mismatches = 0;          ///< 两种实现结果不一致的次数（应为 0）
+    quint64 relabels = 0;           ///< 增量实现重新填充的次数
+    double floodSeconds = 0.0;      ///< 逐次洪水填充的耗时
+    double incrementalSeconds = 0.0;    ///< 增量实现的耗时（含每帧维护）
+    PerfSample floodCounters;       ///< 逐次洪水填充一遍的硬件计数
+    PerfSample incrementalCounters; ///< 增量实现一遍的硬件计数
+    QString countersUnavailable;    ///< 计数器不可用的原因（可用或未开启时为空）
+};
+
+/**
+ * @brief 可达区域查询基准
+ *
+ * 在大棋盘上放一条长蛇（开局按行蛇形铺满顶部），每帧对蛇头的每个候选格
+ * 查询所在区域的格数，再查询蛇头可达面积与蛇头能否走到蛇尾；蛇朝可达面积
+ * 最大的方向移动，被困死时重新开始。同一局面分别用逐次洪水填充和
+ * Reachability 回答并逐一比对，两者各自计时。
+ */
+class ReachabilityBench {
+public:
+    /**
+     * @brief 构造函数
+     * @param config 基准配置
+     */
+    explicit ReachabilityBench(const ReachabilityBenchConfig& config);
+
+    /**
+     * @brief 运行基准（单线程，阻塞直到完成）
+     * @return 结果
+     */
+    ReachabilityBenchResult run();
+
+private:
+    ReachabilityBenchConfig config_;    ///< 基准配置
+    std::vector<quint32> stamps_;       ///< 洪水填充访问标记（与 epoch_ 相等表示本次已访问）
+    quint32 epoch_;                     ///< 当前洪水填充轮次
+    std::vector<int> stack_;            ///< 洪水填充栈
+
+    /**
+     * @brief 完整推进一遍
+     * @param incremental true 用 Reachability 回答，false 用逐次洪水填充
+     * @param answers 增量一遍写入每个查询的结果，洪水填充一遍与之比对
+     * @param result 累计结果
+     * @param counters 硬件计数器（可为空），与计时覆盖同一段循环
+     * @param sample 输出本遍的硬件计数
+     * @return 耗时（秒）
+     */
+    double runPass(bool incremental, std::vector<qint32>& answers, ReachabilityBenchResult& result,
+                   PerfCounters* counters, PerfSample* sample);
+
+    /**
+     * @brief 从一组空闲格出发的洪水填充（访问标记留在 stamps_ 中）
+     * @return 访问到的格数
+     */
+    int floodFill(const OccupancyGrid& occupancy, const int* starts, int count);
+};
+
+}  // namespace SnakeGame
+
+#endif  // REACHABILITYBENCH_H
@@ -0,0 +1,201 @@
+/**
+ * @file main.cpp
+ * @brief 性能基准命令行程序入口（仅依赖 SnakeCore）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <algorithm>
+#include <cstdio>
+#include "BodyBench.h"
+#include "HamiltonCycle.h"
+#include "ReachabilityBench.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/**
+ * @brief 输出一遍的硬件计数（按帧平均）
+ * @param label 实现名
+ * @param sample 硬件计数
+ * @param ticks 帧数
+ */
+void printCounters(const char* label, const PerfSample& sample, qint64 ticks)
+{
+    const double perTick = 1.0 / static_cast<double>(ticks > 0 ? ticks : 1);
+    std::printf("%-12s per tick:", label);
+    for (int i = 0; i < PerfSample::CounterCount; ++i) {
+        const auto counter = static_cast<PerfSample::Counter>(i);
+        if (sample.valid[i]) {
+            std::printf("  %s=%.0f", PerfSample::name(counter), sample.values[i] * perTick);
+        } else {
+            std::printf("  %s=n/a", PerfSample::name(counter));
+        }
+    }
+    if (sample.valid[PerfSample::Cycles] && sample.valid[PerfSample::Instructions] &&
+        sample.values[PerfSample::Cycles] > 0) {
+        std::printf("  IPC=%.2f", static_cast<double>(sample.values[PerfSample::Instructions]) /
+                                      static_cast<double>(sample.values[PerfSample::Cycles]));
+    }
+    std::printf("\n");
+}
+
+/**
+ * @brief 运行可达区域查询基准并输出结果
+ * @return 0 成功，4 两种实现结果不一致
+ */
+int runReachability(const ReachabilityBenchConfig& config)
+{
+    ReachabilityBench bench(config);
+    const ReachabilityBenchResult result = bench.run();
+
+    const double queries = result.queries > 0 ? static_cast<double>(result.queries) : 1.0;
+    const double incremental = result.incrementalSeconds > 0.0 ? result.incrementalSeconds : 1e-9;
+
+    std::printf("reachability: board=%dx%d snake=%d ticks=%lld queries=%lld restarts=%lld\n"
+                "flood fill:  %.3fs  %.0f ns/query\n"
+                "incremental: %.3fs  %.0f ns/query  relabels=%llu\n"
+                "speedup: %.1fx  mismatches=%lld\n",
+                config.boardWidth, config.boardHeight, result.snakeLength,
+                static_cast<long long>(result.ticks), static_cast<long long>(result.queries),
+                static_cast<long long>(result.restarts),
+                result.floodSeconds, result.floodSeconds * 1e9 / queries,
+                result.incrementalSeconds, result.incrementalSeconds * 1e9 / queries,
+                static_cast<unsigned long long>(result.relabels),
+                result.floodSeconds / incremental, static_cast<long long>(result.mismatches));
+
+    if (config.counters) {
+        if (!result.countersUnavailable.isEmpty()) {
+            std::printf("counters: unavailable: %s\n", qPrintable(result.countersUnavailable));
+        } else {
+            printCounters("flood fill:", result.floodCounters, result.ticks);
+            printCounters("incremental:", result.incrementalCounters, result.ticks);
+        }
+    }
+    return result.mismatches == 0 ? 0 : 4;
+}
+
+/**
+ * @brief 运行蛇身存储基准并输出结果
+ * @return 0 成功，4 两种存储结果不一致
+ */
+int runBody(const BodyBenchConfig& config)
+{
+    BodyBench bench(config);
+    const BodyBenchResult result = bench.run();
+
+    const double ticks = result.ticks > 0 ? static_cast<double>(result.ticks) : 1.0;
+    const double compact = result.compactSeconds > 0.0 ? result.compactSeconds : 1e-9;
+
+    std::printf("body: board=%dx%d snake=%d ticks=%lld\n"
+                "vector:  %.3fs  %.0f ns/move  %.1f MB\n"
+                "compact: %.3fs  %.0f ns/move  %.1f MB  expand=%.3f ms\n"
+                "speedup: %.1fx  memory: %.1fx smaller  mismatches=%lld\n",
+                config.boardWidth, config.boardHeight, result.snakeLength,
+                static_cast<long long>(result.ticks),
+                result.vectorSeconds, result.vectorSeconds * 1e9 / ticks,
+                result.vectorBytes / (1024.0 * 1024.0),
+                result.compactSeconds, result.compactSeconds * 1e9 / ticks,
+                result.compactBytes / (1024.0 * 1024.0), result.expandSeconds * 1e3,
+                result.vectorSeconds / compact,
+                static_cast<double>(result.vectorBytes) / std::max<qint64>(1, result.compactBytes),
+                static_cast<long long>(result.mismatches));
+
+    if (config.counters) {
+        if (!result.countersUnavailable.isEmpty()) {
+            std::printf("counters: unavailable: %s\n", qPrintable(result.countersUnavailable));
+        } else {
+            printCounters("vector:", result.vectorCounters, result.ticks);
+            printCounters("compact:", result.compactCounters, result.ticks);
+        }
+    }
+    return result.mismatches == 0 ? 0 : 4;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @param argc 命令行参数数量
+ * @param argv 命令行参数
+ * @return 0 成功，1 参数错误，4 结果校验失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCoreApplication::setApplicationName("SnakeBench");
+    QCoreApplication::setApplicationVersion("1.0.0");
+    QCoreApplication::setOrganizationName("SnakeGame Team");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Micro-benchmarks for the Snake core.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("benchmark", "Benchmark to run: reachability or body.");
+
+    QCommandLineOption widthOption("width", "Board width in cells.", "cells", "1024");
+    QCommandLineOption heightOption("height", "Board height in cells.", "cells", "1024");
+    QCommandLineOption ticksOption("ticks", "Number of ticks to simulate.", "n", "200");
+    QCommandLineOption seedOption("seed", "Random seed.", "seed", "1");
+    QCommandLineOption snakeOption("snake",
+        "Snake length as a fraction of the board.", "fraction", "0.25");
+
+    QCommandLineOption noCountersOption("no-counters",
+        "Do not read hardware performance counters (Linux perf_event_open).");
+
+    parser.addOptions({widthOption, heightOption, ticksOption, seedOption, snakeOption,
+                       noCountersOption});
+    parser.process(app);
+
+    const QStringList positional = parser.positionalArguments();
+    const QString benchmark = positional.isEmpty() ? QString("reachability")
+                                                   : positional.first().toLower();
+
+    const int width = parser.value(widthOption).toInt();
+    const int height = parser.value(heightOption).toInt();
+    const qint64 ticks = parser.value(ticksOption).toLongLong();
+    if (width < 2 || height < 2 || ticks <= 0) {
+        std::fprintf(stderr, "Invalid board size or tick count\n");
+        return 1;
+    }
+
+    if (benchmark == "reachability") {
+        ReachabilityBenchConfig config;
+        config.boardWidth = width;
+        config.boardHeight = height;
+        config.ticks = ticks;
+        config.seed = parser.value(seedOption).toULongLong();
+        config.snakeFraction = parser.value(snakeOption).toDouble();
+        config.counters = !parser.isSet(noCountersOption);
+        if (config.snakeFraction <= 0.0 || config.snakeFraction >= 1.0) {
+            std::fprintf(stderr, "Invalid snake fraction\n");
+            return 1;
+        }
+        return runReachability(config);
+    }
+
+    if (benchmark == "body") {
+        BodyBenchConfig config;
+        config.boardWidth = width;
+        config.boardHeight = height;
+        config.ticks = ticks;
+        config.snakeFraction = parser.value(snakeOption).toDouble();
+        config.counters = !parser.isSet(noCountersOption);
+        if (config.snakeFraction <= 0.0 || config.snakeFraction >= 1.0) {
+            std::fprintf(stderr, "Invalid snake fraction\n");
+            return 1;
+        }
+        if (!HamiltonCycle::isSupported(width, height)) {
+            std::fprintf(stderr, "The body benchmark needs an even number of cells\n");
+            return 1;
+        }
+        return runBody(config);
+    }
+
+    std::fprintf(stderr, "Unknown benchmark: %s\n", qPrintable(benchmark));
+    return 1;
+}
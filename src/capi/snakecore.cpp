@@ -0,0 +1,385 @@
+/**
+ * @file snakecore.cpp
+ * @brief SnakeCore 的 C 语言接口实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "snakecore.h"
+#include "GameLogic.h"
+#include "ObservationBuilder.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using namespace SnakeGame;
+
+static_assert(static_cast<int>(Direction::Up) == SNAKE_ACTION_UP &&
+              static_cast<int>(Direction::Down) == SNAKE_ACTION_DOWN &&
+              static_cast<int>(Direction::Left) == SNAKE_ACTION_LEFT &&
+              static_cast<int>(Direction::Right) == SNAKE_ACTION_RIGHT,
+              "SNAKE_ACTION_* must match SnakeGame::Direction");
+
+static_assert(static_cast<int>(GameOverReason::WallCollision) == SNAKE_REASON_WALL &&
+              static_cast<int>(GameOverReason::SelfCollision) == SNAKE_REASON_SELF &&
+              static_cast<int>(GameOverReason::BoardFilled) == SNAKE_REASON_WON,
+              "SNAKE_REASON_* must match SnakeGame::GameOverReason");
+
+/**
+ * @brief C 句柄背后的对局状态
+ *
+ * GameLogic 关闭定时器后由 step() 同步推进，信号没有连接时只是空调用，
+ * 因此无需 QCoreApplication。
+ */
+struct snake_env {
+    snake_config config;                            ///< 创建参数
+    std::mt19937_64 engine;                         ///< 食物位置随机数引擎
+    GameLogic game;                                 ///< 对局
+    std::unique_ptr<ObservationBuilder> observation;    ///< 观测构建器（首次 observe 时创建）
+    void* observationBuffer;                        ///< 观测构建器当前写入的调用方缓冲区
+    quint64 episode;                                ///< 当前局序号
+    quint64 observedEpisode;                        ///< 观测缓冲区对应的局序号
+    int ticks;                                      ///< 本局已走步数
+    bool truncated;                                 ///< 本局是否因步数上限结束
+
+    explicit snake_env(const snake_config& cfg)
+        : config(cfg)
+        , engine(cfg.seed)
+        , game(cfg.board_width, cfg.board_height)
+        , observationBuffer(nullptr)
+        , episode(0)
+        , observedEpisode(0)
+        , ticks(0)
+        , truncated(false)
+    {
+        game.setAutoTick(false);
+        game.setRandomGenerator([this](int min, int max) {
+            return std::uniform_int_distribution<int>(min, max)(engine);
+        });
+    }
+};
+
+namespace {
+
+/** @brief 棋盘格数上限，保证坐标与张量偏移不会溢出 */
+constexpr qint64 kMaxCells = qint64(1) << 24;
+
+/** @brief 观测张量 padding 上限 */
+constexpr int kMaxPadding = 64;
+
+bool isValidConfig(const snake_config& config)
+{
+    // 初始蛇从棋盘中央向左延伸
+    if (config.board_width / 2 < Constants::kInitialSnakeLength - 1 || config.board_height < 1) {
+        return false;
+    }
+    if (static_cast<qint64>(config.board_width) * config.board_height > kMaxCells) {
+        return false;
+    }
+    if (config.observation_format != SNAKE_OBS_FLOAT32 &&
+        config.observation_format != SNAKE_OBS_UINT8) {
+        return false;
+    }
+    return config.observation_padding >= 0 && config.observation_padding <= kMaxPadding &&
+           config.max_ticks >= 0;
+}
+
+ObservationBuilder::Format observationFormat(const snake_config& config)
+{
+    return config.observation_format == SNAKE_OBS_UINT8 ? ObservationBuilder::Format::UInt8
+                                                        : ObservationBuilder::Format::Float32;
+}
+
+size_t observationByteSize(const snake_config& config)
+{
+    return static_cast<size_t>(ObservationBuilder::byteSizeFor(
+        config.board_width, config.board_height, observationFormat(config),
+        config.observation_padding));
+}
+
+void startEpisode(snake_env* env)
+{
+    // 对局进行中 startGame() 不会重置，先回到准备状态
+    if (env->game.getState() == GameState::Running || env->game.getState() == GameState::Paused) {
+        env->game.resetGame();
+    }
+    env->game.startGame();
+    env->ticks = 0;
+    env->truncated = false;
+    ++env->episode;
+}
+
+void fillResult(const snake_env* env, snake_step_result* result)
+{
+    result->score = env->game.getScore();
+    result->length = env->game.getSnakeLength();
+    result->ticks = env->ticks;
+    result->ate_food = 0;
+    result->done = env->game.getState() == GameState::GameOver;
+    result->truncated = env->truncated;
+    result->reason = static_cast<int32_t>(env->game.getGameOverReason());
+}
+
+}  // namespace
+
+extern "C" {
+
+int32_t snake_abi_version(void)
+{
+    return SNAKECORE_ABI_VERSION;
+}
+
+void snake_config_init(snake_config* config)
+{
+    if (!config) {
+        return;
+    }
+    config->board_width = Constants::kDefaultBoardWidth;
+    config->board_height = Constants::kDefaultBoardHeight;
+    config->seed = 0;
+    config->observation_format = SNAKE_OBS_FLOAT32;
+    config->observation_padding = 1;
+    config->max_ticks = 0;
+    config->auto_reset = 0;
+}
+
+snake_env* snake_create(const snake_config* config)
+{
+    snake_config cfg;
+    if (config) {
+        cfg = *config;
+    } else {
+        snake_config_init(&cfg);
+    }
+    if (!isValidConfig(cfg)) {
+        return nullptr;
+    }
+
+    // 异常不能穿过 C 边界
+    snake_env* env = nullptr;
+    try {
+        env = new snake_env(cfg);
+        startEpisode(env);
+    } catch (...) {
+        delete env;
+        return nullptr;
+    }
+    return env;
+}
+
+void snake_destroy(snake_env* env)
+{
+    delete env;
+}
+
+int32_t snake_reset(snake_env* env, uint64_t seed)
+{
+    if (!env) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    env->engine.seed(seed);
+    startEpisode(env);
+    return SNAKE_OK;
+}
+
+int32_t snake_step(snake_env* env, int32_t action, snake_step_result* result)
+{
+    if (!env || action < SNAKE_ACTION_NONE || action > SNAKE_ACTION_RIGHT) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    GameLogic& game = env->game;
+    if (game.getState() != GameState::Running || env->truncated) {
+        if (result) {
+            fillResult(env, result);
+        }
+        return SNAKE_ERROR_GAME_OVER;
+    }
+
+    if (action != SNAKE_ACTION_NONE) {
+        const Direction direction = static_cast<Direction>(action);
+        if (!DirectionHelper::isOpposite(game.getDirection(), direction)) {
+            game.setDirection(direction);
+        }
+    }
+
+    const int scoreBefore = game.getScore();
+    game.step();
+    ++env->ticks;
+
+    const bool done = game.getState() != GameState::Running;
+    env->truncated = !done && env->config.max_ticks > 0 && env->ticks >= env->config.max_ticks;
+
+    if (result) {
+        fillResult(env, result);
+        result->ate_food = game.getScore() > scoreBefore;
+    }
+
+    if ((done || env->truncated) && env->config.auto_reset) {
+        startEpisode(env);
+    }
+    return SNAKE_OK;
+}
+
+int32_t snake_observation_info_get(const snake_env* env, snake_observation_info* info)
+{
+    if (!env || !info) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    const int padding = env->config.observation_padding;
+    info->planes = ObservationBuilder::PlaneCount;
+    info->height = env->config.board_height + 2 * padding;
+    info->width = env->config.board_width + 2 * padding;
+    info->element_size = env->config.observation_format == SNAKE_OBS_UINT8 ? 1 : 4;
+    info->byte_size = observationByteSize(env->config);
+    return SNAKE_OK;
+}
+
+int32_t snake_observe(snake_env* env, void* buffer, size_t size)
+{
+    if (!env || !buffer) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    if (size < observationByteSize(env->config)) {
+        return SNAKE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    if (buffer != env->observationBuffer) {
+        // 新缓冲区：构建器直接写入调用方内存，之后每步只改写变化的格子
+        try {
+            env->observation = std::make_unique<ObservationBuilder>(
+                env->config.board_width, env->config.board_height,
+                observationFormat(env->config), env->config.observation_padding, buffer);
+        } catch (...) {
+            env->observation.reset();
+            env->observationBuffer = nullptr;
+            return SNAKE_ERROR_INVALID_ARGUMENT;
+        }
+        env->observationBuffer = buffer;
+        env->observedEpisode = env->episode;
+    } else if (env->observedEpisode != env->episode) {
+        env->observation->reset();
+        env->observedEpisode = env->episode;
+    }
+
+    env->observation->update(env->game);
+    return SNAKE_OK;
+}
+
+int32_t snake_copy_body(const snake_env* env, int32_t* xy, int32_t capacity)
+{
+    if (!env || (!xy && capacity > 0) || capacity < 0) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    const QVector<QPoint>& body = env->game.getSnakeBody();
+    const int count = std::min(capacity, static_cast<int32_t>(body.size()));
+    for (int i = 0; i < count; ++i) {
+        xy[2 * i] = body[i].x();
+        xy[2 * i + 1] = body[i].y();
+    }
+    return body.size();
+}
+
+int32_t snake_food(const snake_env* env, int32_t* x, int32_t* y)
+{
+    if (!env || !x || !y) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    // 填满棋盘时已没有食物，坐标为 (-1, -1)
+    const QPoint food = env->game.getFoodPosition();
+    *x = food.x();
+    *y = food.y();
+    return SNAKE_OK;
+}
+
+int32_t snake_set_food_count(snake_env* env, int32_t count)
+{
+    if (!env || count < 1) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    env->game.setFoodCount(count);
+    return SNAKE_OK;
+}
+
+int32_t snake_foods(const snake_env* env, int32_t* xy, int32_t capacity)
+{
+    if (!env || (!xy && capacity > 0) || capacity < 0) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    const QVector<QPoint>& foods = env->game.getFoodPositions();
+    const int count = std::min(capacity, static_cast<int32_t>(foods.size()));
+    for (int i = 0; i < count; ++i) {
+        xy[2 * i] = foods[i].x();
+        xy[2 * i + 1] = foods[i].y();
+    }
+    return foods.size();
+}
+
+int32_t snake_distances(snake_env* env, int32_t* out, int32_t capacity)
+{
+    if (!env || !out) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    const int cells = env->config.board_width * env->config.board_height;
+    if (capacity < cells) {
+        return SNAKE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    try {
+        env->game.setDistanceFieldEnabled(true);
+    } catch (...) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    const qint32* distances = env->game.getDistanceField()->data();
+    for (int i = 0; i < cells; ++i) {
+        out[i] = distances[i] == DistanceField::kUnreachable ? -1 : distances[i];
+    }
+    return SNAKE_OK;
+}
+
+int32_t snake_reachable_area(snake_env* env, int32_t x, int32_t y)
+{
+    if (!env || x < 0 || x >= env->config.board_width || y < 0 || y >= env->config.board_height) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        env->game.setReachabilityEnabled(true);
+    } catch (...) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+    return env->game.getReachability()->reachableArea(QPoint(x, y));
+}
+
+int32_t snake_step_batch(snake_env* const* envs, size_t count, const int32_t* actions,
+                         snake_step_result* results, void* observations, size_t observation_stride)
+{
+    if (count == 0) {
+        return SNAKE_OK;
+    }
+    if (!envs || !actions) {
+        return SNAKE_ERROR_INVALID_ARGUMENT;
+    }
+
+    int32_t status = SNAKE_OK;
+    auto record = [&status](int32_t code) {
+        if (status == SNAKE_OK && code != SNAKE_OK) {
+            status = code;
+        }
+    };
+
+    uchar* output = static_cast<uchar*>(observations);
+    for (size_t i = 0; i < count; ++i) {
+        record(snake_step(envs[i], actions[i], results ? &results[i] : nullptr));
+        if (output) {
+            record(snake_observe(envs[i], output + i * observation_stride, observation_stride));
+        }
+    }
+    return status;
+}
+
+}  // extern "C"
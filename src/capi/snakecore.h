@@ -0,0 +1,245 @@
+/**
+ * @file snakecore.h
+ * @brief SnakeCore 的 C 语言接口（libsnakecore 共享库）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ *
+ * 只使用 C 基本类型和不透明句柄，不暴露任何 Qt 或 C++ 类型，
+ * 可由 Python ctypes/cffi、Rust、Julia 等宿主直接加载。
+ * 所有缓冲区均由调用方提供，库内不为调用方分配内存，也不需要 Qt 事件循环。
+ *
+ * 线程安全：不同句柄可在不同线程上并发使用；同一句柄不可并发调用。
+ */
+
+#ifndef SNAKECORE_H
+#define SNAKECORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(SNAKECORE_BUILD)
+#    define SNAKECORE_API __declspec(dllexport)
+#  else
+#    define SNAKECORE_API __declspec(dllimport)
+#  endif
+#else
+#  define SNAKECORE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief 接口版本，结构体布局或函数语义不兼容变化时递增 */
+#define SNAKECORE_ABI_VERSION 1
+
+/** @brief 不透明的对局句柄 */
+typedef struct snake_env snake_env;
+
+/** @brief 返回码 */
+enum {
+    SNAKE_OK = 0,                       /**< 成功 */
+    SNAKE_ERROR_INVALID_ARGUMENT = -1,  /**< 参数无效（空指针、越界动作等） */
+    SNAKE_ERROR_BUFFER_TOO_SMALL = -2,  /**< 调用方缓冲区不足 */
+    SNAKE_ERROR_GAME_OVER = -3          /**< 对局已结束，需要先 snake_reset() */
+};
+
+/** @brief 动作（与蛇的移动方向一致） */
+enum {
+    SNAKE_ACTION_NONE = -1,     /**< 保持当前方向 */
+    SNAKE_ACTION_UP = 0,
+    SNAKE_ACTION_DOWN = 1,
+    SNAKE_ACTION_LEFT = 2,
+    SNAKE_ACTION_RIGHT = 3
+};
+
+/** @brief 对局结束原因 */
+enum {
+    SNAKE_REASON_NONE = 0,      /**< 未结束 */
+    SNAKE_REASON_WALL = 1,      /**< 撞墙 */
+    SNAKE_REASON_SELF = 2,      /**< 撞到自身 */
+    SNAKE_REASON_WON = 3        /**< 填满棋盘 */
+};
+
+/** @brief 观测张量元素类型 */
+enum {
+    SNAKE_OBS_FLOAT32 = 0,
+    SNAKE_OBS_UINT8 = 1
+};
+
+/**
+ * @brief 创建参数（先用 snake_config_init() 填入默认值）
+ */
+typedef struct snake_config {
+    int32_t board_width;        /**< 棋盘宽度（格数） */
+    int32_t board_height;       /**< 棋盘高度（格数） */
+    uint64_t seed;              /**< 食物位置随机种子 */
+    int32_t observation_format; /**< SNAKE_OBS_FLOAT32 或 SNAKE_OBS_UINT8 */
+    int32_t observation_padding;/**< 观测张量四周墙的宽度 */
+    int32_t max_ticks;          /**< 单局步数上限，0 表示不限制 */
+    int32_t auto_reset;         /**< 非 0 时对局结束后立即开始下一局 */
+} snake_config;
+
+/**
+ * @brief 单步结果
+ *
+ * 开启 auto_reset 时，done/truncated 为 1 的结果描述刚结束的那一局，
+ * 句柄此时已经处于下一局的初始局面。
+ */
+typedef struct snake_step_result {
+    int32_t score;              /**< 当前分数 */
+    int32_t length;             /**< 蛇长 */
+    int32_t ticks;              /**< 本局已走步数 */
+    int32_t ate_food;           /**< 本步吃到食物为 1 */
+    int32_t done;               /**< 本步对局结束为 1 */
+    int32_t truncated;          /**< 本步达到 max_ticks 为 1 */
+    int32_t reason;             /**< SNAKE_REASON_* */
+} snake_step_result;
+
+/**
+ * @brief 观测张量形状，布局为 [planes][height][width]，行优先连续
+ */
+typedef struct snake_observation_info {
+    int32_t planes;             /**< 平面数：蛇头、蛇身、占据帧序号、食物、墙 */
+    int32_t height;             /**< 高度（含 padding） */
+    int32_t width;              /**< 宽度（含 padding） */
+    int32_t element_size;       /**< 元素字节数 */
+    size_t byte_size;           /**< 总字节数 */
+} snake_observation_info;
+
+/**
+ * @brief 获取库的接口版本
+ * @return SNAKECORE_ABI_VERSION
+ */
+SNAKECORE_API int32_t snake_abi_version(void);
+
+/**
+ * @brief 填入默认创建参数（默认棋盘、float 观测、padding 1）
+ */
+SNAKECORE_API void snake_config_init(snake_config* config);
+
+/**
+ * @brief 创建对局并开始第一局
+ * @param config 创建参数，为空时使用默认值
+ * @return 句柄，参数无效或内存不足时返回 NULL
+ */
+SNAKECORE_API snake_env* snake_create(const snake_config* config);
+
+/**
+ * @brief 销毁对局（可传入 NULL）
+ */
+SNAKECORE_API void snake_destroy(snake_env* env);
+
+/**
+ * @brief 重新播种并开始新的一局
+ * @param env 句柄
+ * @param seed 随机种子
+ * @return SNAKE_OK 或错误码
+ */
+SNAKECORE_API int32_t snake_reset(snake_env* env, uint64_t seed);
+
+/**
+ * @brief 推进一步
+ * @param env 句柄
+ * @param action SNAKE_ACTION_*，反方向会被忽略
+ * @param result 结果（可为 NULL）
+ * @return SNAKE_OK 或错误码；对局已结束时返回 SNAKE_ERROR_GAME_OVER 并填入终局结果
+ */
+SNAKECORE_API int32_t snake_step(snake_env* env, int32_t action, snake_step_result* result);
+
+/**
+ * @brief 查询观测张量形状
+ */
+SNAKECORE_API int32_t snake_observation_info_get(const snake_env* env, snake_observation_info* info);
+
+/**
+ * @brief 把当前局面写入调用方缓冲区
+ * @param env 句柄
+ * @param buffer 缓冲区，至少 byte_size 字节（无对齐要求）
+ * @param size 缓冲区字节数
+ * @return SNAKE_OK 或错误码
+ *
+ * 句柄记住上次使用的缓冲区：每步传入同一块缓冲区时只改写变化的格子，
+ * 开销与棋盘大小无关；换用新缓冲区时整帧重写一次。
+ * 两次调用之间调用方不得修改缓冲区内容。
+ */
+SNAKECORE_API int32_t snake_observe(snake_env* env, void* buffer, size_t size);
+
+/**
+ * @brief 复制蛇身坐标
+ * @param env 句柄
+ * @param xy 输出 [x0, y0, x1, y1, ...]，蛇头在前
+ * @param capacity xy 可容纳的格子数（即 xy 元素数的一半）
+ * @return 蛇长；大于 capacity 时只写入前 capacity 节；出错返回负的错误码
+ */
+SNAKECORE_API int32_t snake_copy_body(const snake_env* env, int32_t* xy, int32_t capacity);
+
+/**
+ * @brief 获取食物位置（同时存在多个食物时为第一个）
+ * @return SNAKE_OK 或错误码；棋盘填满时坐标为 (-1, -1)
+ */
+SNAKECORE_API int32_t snake_food(const snake_env* env, int32_t* x, int32_t* y);
+
+/**
+ * @brief 设置同时存在的食物数量
+ * @param env 句柄
+ * @param count 食物数量（至少为 1，默认 1）
+ * @return SNAKE_OK 或错误码
+ *
+ * 下一次生成食物时生效；需要从开局起生效时在 snake_reset() 之前调用。
+ */
+SNAKECORE_API int32_t snake_set_food_count(snake_env* env, int32_t count);
+
+/**
+ * @brief 复制全部食物坐标
+ * @param env 句柄
+ * @param xy 输出 [x0, y0, x1, y1, ...]，顺序不固定
+ * @param capacity xy 可容纳的食物数（即 xy 元素数的一半）
+ * @return 食物数；大于 capacity 时只写入前 capacity 个；出错返回负的错误码
+ */
+SNAKECORE_API int32_t snake_foods(const snake_env* env, int32_t* xy, int32_t capacity);
+
+/**
+ * @brief 复制每格到最近食物的步数（绕开蛇身与障碍物）
+ * @param env 句柄
+ * @param out 输出，行优先 width × height 个元素；被占据或走不到食物的格子为 -1
+ * @param capacity out 的元素数
+ * @return SNAKE_OK 或错误码
+ *
+ * 首次调用时为该句柄开启距离场，之后每步随蛇头蛇尾局部修补，复制时无需重新搜索。
+ */
+SNAKECORE_API int32_t snake_distances(snake_env* env, int32_t* out, int32_t capacity);
+
+/**
+ * @brief 查询从某格出发沿空闲格能走到的格数
+ * @param env 句柄
+ * @param x 出发格横坐标（可以是蛇头等被占据的格子）
+ * @param y 出发格纵坐标
+ * @return 格数（出发格空闲时计入）；出错返回负的错误码
+ *
+ * 首次调用时为该句柄开启可达区域查询，之后随每步增量维护，通常为 O(1)。
+ */
+SNAKECORE_API int32_t snake_reachable_area(snake_env* env, int32_t x, int32_t y);
+
+/**
+ * @brief 批量推进多个对局
+ * @param envs 句柄数组
+ * @param count 句柄数
+ * @param actions 每局的动作
+ * @param results 每局的结果（可为 NULL）
+ * @param observations 观测输出首地址（可为 NULL），第 i 局写入 observations + i * observation_stride
+ * @param observation_stride 相邻两局观测之间的字节数
+ * @return 全部成功返回 SNAKE_OK，否则返回遇到的第一个错误码（其余对局照常推进）
+ *
+ * 一次调用完成 count 局的推进与观测写入，宿主每批只跨越一次语言边界。
+ */
+SNAKECORE_API int32_t snake_step_batch(snake_env* const* envs, size_t count,
+                                       const int32_t* actions, snake_step_result* results,
+                                       void* observations, size_t observation_stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* SNAKECORE_H */
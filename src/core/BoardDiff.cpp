@@ -0,0 +1,155 @@
+/**
+ * @file BoardDiff.cpp
+ * @brief 棋盘增量差异实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "BoardDiff.h"
+#include <algorithm>
+
+namespace SnakeGame {
+
+BoardDiff::BoardDiff(int boardWidth, int boardHeight)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , flags_(static_cast<size_t>(boardWidth) * boardHeight, 0)
+    , valid_(false)
+    , prevLength_(0)
+{
+    // 一帧最多改动蛇头、旧蛇头、蛇尾三格；食物变化按需增长后复用
+    changes_.reserve(8);
+}
+
+bool BoardDiff::setSnake(const QVector<QPoint>& body)
+{
+    changes_.clear();
+
+    const int length = body.size();
+    if (length == 0) {
+        rebuild(body);
+        return true;
+    }
+
+    if (valid_ && length == prevLength_ && body.first() == prevHead_ && body.last() == prevTail_) {
+        // 本帧没有移动（暂停、重开时重复发送或重复调用）
+        return false;
+    }
+
+    // 第二节是上一帧蛇头之外，蛇尾也要衔接：长度不变时新蛇尾必须仍在蛇身上，
+    // 只长一节时蛇尾不动
+    const QPoint tail = body.last();
+    const bool tailFollows =
+        (length == prevLength_ &&
+         (!isInside(tail) || (flags_[index(tail.x(), tail.y())] & (kHead | kBody)))) ||
+        (length == prevLength_ + 1 && tail == prevTail_);
+    const bool incremental = valid_ && length >= 2 && body[1] == prevHead_ && tailFollows;
+
+    if (!incremental) {
+        rebuild(body);
+        return true;
+    }
+
+    // 长度不变说明蛇尾离开了原位置（除非蛇头正好走进原蛇尾）
+    if (length == prevLength_ && prevTail_ != body.first()) {
+        update(prevTail_, 0, kHead | kBody);
+    }
+    update(prevHead_, kBody, kHead);
+    update(body.first(), kHead, kBody);
+
+    prevHead_ = body.first();
+    prevTail_ = tail;
+    prevLength_ = length;
+    return false;
+}
+
+void BoardDiff::setFoods(const QVector<QPoint>& foods)
+{
+    changes_.clear();
+
+    // 旧食物先标记为待擦除，仍在新集合中的保持不变，只画新出现的
+    for (const QPoint& food : foods_) {
+        quint8& flags = flags_[index(food.x(), food.y())];
+        flags = static_cast<quint8>((flags & ~kFood) | kStale);
+    }
+
+    for (const QPoint& food : foods) {
+        if (!isInside(food)) {
+            continue;
+        }
+        quint8& flags = flags_[index(food.x(), food.y())];
+        if (flags & kStale) {
+            flags = static_cast<quint8>((flags & ~kStale) | kFood);
+        } else {
+            update(food, kFood, 0);
+        }
+    }
+
+    // 仍待擦除的就是消失的食物；被蛇盖住的格子显示不变
+    for (const QPoint& food : foods_) {
+        quint8& flags = flags_[index(food.x(), food.y())];
+        if (flags & kStale) {
+            flags = static_cast<quint8>(flags & ~kStale);
+            if (visible(flags) == Cell::Empty) {
+                changes_.push_back({food, Cell::Empty});
+            }
+        }
+    }
+
+    foods_.clear();
+    for (const QPoint& food : foods) {
+        if (isInside(food)) {
+            foods_.push_back(food);
+        }
+    }
+}
+
+void BoardDiff::invalidate()
+{
+    valid_ = false;
+}
+
+void BoardDiff::clear()
+{
+    std::fill(flags_.begin(), flags_.end(), 0);
+    foods_.clear();
+    changes_.clear();
+    valid_ = false;
+    prevLength_ = 0;
+}
+
+void BoardDiff::update(const QPoint& pos, quint8 set, quint8 clear)
+{
+    if (!isInside(pos)) {
+        return;
+    }
+
+    quint8& flags = flags_[index(pos.x(), pos.y())];
+    const Cell before = visible(flags);
+    flags = static_cast<quint8>((flags & ~clear) | set);
+    const Cell after = visible(flags);
+    if (after != before) {
+        changes_.push_back({pos, after});
+    }
+}
+
+void BoardDiff::rebuild(const QVector<QPoint>& body)
+{
+    for (quint8& flags : flags_) {
+        flags = static_cast<quint8>(flags & ~(kHead | kBody));
+    }
+    for (int i = body.size() - 1; i >= 0; --i) {
+        if (isInside(body[i])) {
+            flags_[index(body[i].x(), body[i].y())] |= (i == 0 ? kHead : kBody);
+        }
+    }
+
+    valid_ = !body.isEmpty();
+    if (valid_) {
+        prevHead_ = body.first();
+        prevTail_ = body.last();
+    }
+    prevLength_ = body.size();
+}
+
+}  // namespace SnakeGame
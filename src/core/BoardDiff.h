@@ -0,0 +1,164 @@
+/**
+ * @file BoardDiff.h
+ * @brief 棋盘增量差异 - 渲染器与观测张量共用的变化格子计算
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef BOARDDIFF_H
+#define BOARDDIFF_H
+
+#include <QPoint>
+#include <QVector>
+#include <QtGlobal>
+#include <vector>
+
+namespace SnakeGame {
+
+/**
+ * @brief 棋盘增量差异
+ *
+ * 记录每个格子当前显示的内容，每次传入新的蛇身或食物后给出发生变化的格子
+ * （新蛇头、旧蛇头、离开的蛇尾、出现或消失的食物），调用方只重绘这些格子，
+ * 每帧开销与棋盘大小和蛇长无关。
+ *
+ * 蛇与食物分开记录，同一格两者都有时显示蛇。GameLogic 每帧先发出
+ * foodsChanged 再发出 snakeMoved，被吃掉的食物会先被擦除、随后画成蛇头；
+ * 两种顺序得到的最终画面相同。
+ *
+ * 只有新蛇身的第二节是上一帧蛇头、蛇尾与上一帧衔接、且长度不变或只长一节时
+ * 才增量更新，否则整帧重建。回退或游戏状态变化后蛇身可能与上一帧无关，
+ * 调用方应先调用 invalidate()，下一次 setSnake() 必定整帧重建。
+ */
+class BoardDiff {
+public:
+    /**
+     * @brief 格子显示的内容
+     */
+    enum class Cell : quint8 {
+        Empty,
+        Head,
+        Body,
+        Food
+    };
+
+    /**
+     * @brief 一个发生变化的格子
+     */
+    struct Change {
+        QPoint pos;     ///< 格子坐标（总在棋盘内）
+        Cell cell;      ///< 新的内容
+    };
+
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     */
+    BoardDiff(int boardWidth, int boardHeight);
+
+    /**
+     * @brief 更新蛇身
+     * @param body 蛇身坐标（body[0] 为蛇头，棋盘外的坐标被忽略）
+     * @return true 表示整帧重建，调用方应按 cellAt() 重绘全部格子；
+     *         false 表示变化的格子已写入 changes()（蛇身未动时为空）
+     */
+    bool setSnake(const QVector<QPoint>& body);
+
+    /**
+     * @brief 更新食物
+     * @param foods 全部食物坐标（棋盘外的坐标被忽略）
+     *
+     * 位置不变的食物不产生变化；变化的格子写入 changes()。
+     */
+    void setFoods(const QVector<QPoint>& foods);
+
+    /**
+     * @brief 令下一次 setSnake() 整帧重建（回退、跳转或游戏状态变化后调用）
+     */
+    void invalidate();
+
+    /**
+     * @brief 清空蛇与食物（下一次 setFoods() 重新给出所有食物）
+     */
+    void clear();
+
+    /**
+     * @brief 上一次 setSnake()/setFoods() 产生的变化（按顺序应用，同一格以后者为准）
+     */
+    const std::vector<Change>& changes() const { return changes_; }
+
+    /**
+     * @brief 格子当前显示的内容
+     * @param x 列（需在棋盘内）
+     * @param y 行（需在棋盘内）
+     */
+    Cell cellAt(int x, int y) const { return visible(flags_[index(x, y)]); }
+
+    /**
+     * @brief 当前的食物坐标（棋盘内）
+     */
+    const std::vector<QPoint>& foods() const { return foods_; }
+
+private:
+    /** @brief 格子标志位 */
+    enum : quint8 {
+        kHead = 1,      ///< 蛇头
+        kBody = 2,      ///< 蛇身（不含蛇头）
+        kFood = 4,      ///< 食物
+        kStale = 8      ///< 旧食物，等待确认是否擦除（仅在 setFoods() 内出现）
+    };
+
+    int boardWidth_;                ///< 游戏区域宽度
+    int boardHeight_;               ///< 游戏区域高度
+    std::vector<quint8> flags_;     ///< 每格标志位
+    std::vector<QPoint> foods_;     ///< 当前食物（复用容量）
+    std::vector<Change> changes_;   ///< 最近一次更新的变化（复用容量）
+
+    bool valid_;                    ///< 上一帧蛇身是否可作为增量的基础
+    QPoint prevHead_;               ///< 上一帧蛇头
+    QPoint prevTail_;               ///< 上一帧蛇尾
+    int prevLength_;                ///< 上一帧蛇长
+
+    /**
+     * @brief 由标志位得到显示内容（蛇优先于食物）
+     */
+    static Cell visible(quint8 flags) {
+        if (flags & kHead) {
+            return Cell::Head;
+        }
+        if (flags & kBody) {
+            return Cell::Body;
+        }
+        return (flags & kFood) ? Cell::Food : Cell::Empty;
+    }
+
+    /**
+     * @brief 改写格子的标志位（棋盘外忽略），显示内容变化时记录
+     * @param pos 格子坐标
+     * @param set 置位的标志
+     * @param clear 清除的标志
+     */
+    void update(const QPoint& pos, quint8 set, quint8 clear);
+
+    /**
+     * @brief 整帧重建蛇的标志位
+     */
+    void rebuild(const QVector<QPoint>& body);
+
+    /**
+     * @brief 格子在标志数组中的下标
+     */
+    int index(int x, int y) const { return y * boardWidth_ + x; }
+
+    /**
+     * @brief 检查坐标是否在棋盘内
+     */
+    bool isInside(const QPoint& pos) const {
+        return pos.x() >= 0 && pos.x() < boardWidth_ && pos.y() >= 0 && pos.y() < boardHeight_;
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // BOARDDIFF_H
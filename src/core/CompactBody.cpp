@@ -0,0 +1,224 @@
+/**
+ * @file CompactBody.cpp
+ * @brief 紧凑蛇身实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "CompactBody.h"
+#include <utility>
+
+namespace SnakeGame {
+
+namespace {
+
+/** @brief 环的最小容量（方向码个数） */
+constexpr int kMinLinks = 64;
+
+/**
+ * @brief 相邻两格之间的方向
+ * @return false 表示两格不相邻
+ */
+bool directionBetween(const QPoint& from, const QPoint& to, Direction* direction)
+{
+    const QPoint delta = to - from;
+    if (delta == QPoint(0, -1)) {
+        *direction = Direction::Up;
+    } else if (delta == QPoint(0, 1)) {
+        *direction = Direction::Down;
+    } else if (delta == QPoint(-1, 0)) {
+        *direction = Direction::Left;
+    } else if (delta == QPoint(1, 0)) {
+        *direction = Direction::Right;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+// ==================== Cursor ====================
+
+CompactBody::Cursor& CompactBody::Cursor::operator++()
+{
+    // 第 k+1 节 = 第 k 节 - 第 k 个方向码的偏移
+    if (index_ + 1 < body_->length_) {
+        pos_ -= DirectionHelper::toOffset(body_->link(index_));
+    }
+    ++index_;
+    return *this;
+}
+
+// ==================== CompactBody ====================
+
+CompactBody::CompactBody()
+    : mask_(-1)
+    , headSlot_(0)
+    , length_(0)
+{
+}
+
+bool CompactBody::reset(const QVector<QPoint>& body)
+{
+    clear();
+    if (body.isEmpty()) {
+        return true;
+    }
+
+    reserveLinks(body.size() - 1);
+    for (int k = 0; k + 1 < body.size(); ++k) {
+        Direction direction;
+        if (!directionBetween(body[k + 1], body[k], &direction)) {
+            clear();
+            return false;
+        }
+        store(k, direction);
+    }
+
+    head_ = body.first();
+    tail_ = body.last();
+    length_ = body.size();
+    return true;
+}
+
+void CompactBody::reset(const QPoint& head, int length, Direction direction)
+{
+    clear();
+    if (length <= 0) {
+        return;
+    }
+
+    reserveLinks(length - 1);
+    for (int k = 0; k + 1 < length; ++k) {
+        store(k, direction);
+    }
+
+    head_ = head;
+    tail_ = head - DirectionHelper::toOffset(direction) * (length - 1);
+    length_ = length;
+}
+
+void CompactBody::clear()
+{
+    headSlot_ = 0;
+    length_ = 0;
+    head_ = QPoint();
+    tail_ = QPoint();
+}
+
+void CompactBody::move(Direction direction)
+{
+    if (length_ == 0) {
+        return;
+    }
+    if (length_ == 1) {
+        head_ += DirectionHelper::toOffset(direction);
+        tail_ = head_;
+        return;
+    }
+
+    // 蛇尾沿最后一个方向码前进，再在蛇头一侧写入新方向码
+    tail_ += DirectionHelper::toOffset(link(length_ - 2));
+    headSlot_ = (headSlot_ - 1) & mask_;
+    store(headSlot_, direction);
+    head_ += DirectionHelper::toOffset(direction);
+}
+
+void CompactBody::grow(Direction direction)
+{
+    if (length_ == 0) {
+        return;
+    }
+
+    reserveLinks(length_);
+    headSlot_ = (headSlot_ - 1) & mask_;
+    store(headSlot_, direction);
+    head_ += DirectionHelper::toOffset(direction);
+    ++length_;
+}
+
+void CompactBody::popHead()
+{
+    if (length_ <= 1) {
+        clear();
+        return;
+    }
+
+    // 第 1 节 = 蛇头 - 第 0 个方向码的偏移
+    head_ -= DirectionHelper::toOffset(link(0));
+    headSlot_ = (headSlot_ + 1) & mask_;
+    --length_;
+}
+
+bool CompactBody::pushTail(const QPoint& tail)
+{
+    if (length_ == 0) {
+        return false;
+    }
+
+    Direction direction;
+    if (!directionBetween(tail, tail_, &direction)) {
+        return false;
+    }
+
+    reserveLinks(length_);
+    store((headSlot_ + length_ - 1) & mask_, direction);
+    tail_ = tail;
+    ++length_;
+    return true;
+}
+
+QPoint CompactBody::at(int index) const
+{
+    if (index < length_ / 2) {
+        QPoint pos = head_;
+        for (int k = 0; k < index; ++k) {
+            pos -= DirectionHelper::toOffset(link(k));
+        }
+        return pos;
+    }
+
+    // 从蛇尾反推：第 k 节 = 第 k+1 节 + 第 k 个方向码的偏移
+    QPoint pos = tail_;
+    for (int k = length_ - 2; k >= index; --k) {
+        pos += DirectionHelper::toOffset(link(k));
+    }
+    return pos;
+}
+
+void CompactBody::toVector(QVector<QPoint>* out) const
+{
+    out->resize(length_);
+    QPoint* data = out->data();
+    for (Cursor it = begin(); it != end(); ++it) {
+        data[it.index()] = *it;
+    }
+}
+
+void CompactBody::reserveLinks(int links)
+{
+    const int capacity = mask_ + 1;
+    if (links <= capacity) {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : kMinLinks;
+    while (newCapacity < links) {
+        newCapacity *= 2;
+    }
+
+    // 按顺序搬到新环开头，第 0 个方向码落在槽位 0
+    CompactBody grown;
+    grown.words_.assign(static_cast<size_t>(newCapacity) / 32, 0);
+    grown.mask_ = newCapacity - 1;
+    for (int k = 0; k + 1 < length_; ++k) {
+        grown.store(k, link(k));
+    }
+
+    words_ = std::move(grown.words_);
+    mask_ = grown.mask_;
+    headSlot_ = 0;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,202 @@
+/**
+ * @file CompactBody.h
+ * @brief 紧凑蛇身 - 每节 2 位方向编码的环形缓冲区
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef COMPACTBODY_H
+#define COMPACTBODY_H
+
+#include <QPoint>
+#include <QVector>
+#include <QtGlobal>
+#include <vector>
+
+#include "Direction.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 紧凑蛇身
+ *
+ * 只保存蛇头、蛇尾坐标，相邻两节之间的关系用 2 位方向码表示
+ * （第 k 个方向码是第 k+1 节走到第 k 节的方向），方向码按 32 个一组
+ * 打包进 64 位字组成的环形缓冲区。每节 2 位，是 QVector<QPoint> 的 1/32：
+ * 填满 4096×4096 棋盘的 1600 万节只需 4 MB。
+ *
+ * - 移动：蛇头一侧写入一个方向码，蛇尾沿最后一个方向码前进一格，O(1)
+ * - 遍历：Cursor 从蛇头出发逐节反推坐标，顺序访问，缓存友好
+ * - 随机访问：at() 从较近的一端开始推算，O(min(i, n - i))
+ *
+ * 配合 OccupancyGrid（每格 1 位）即可在超大棋盘上完成移动与碰撞检测。
+ */
+class CompactBody {
+public:
+    /**
+     * @brief 从蛇头到蛇尾的顺序游标
+     */
+    class Cursor {
+    public:
+        /**
+         * @brief 当前节坐标
+         */
+        QPoint operator*() const { return pos_; }
+
+        /**
+         * @brief 前进到下一节（朝蛇尾方向）
+         */
+        Cursor& operator++();
+
+        bool operator==(const Cursor& other) const { return index_ == other.index_; }
+        bool operator!=(const Cursor& other) const { return index_ != other.index_; }
+
+        /**
+         * @brief 当前节序号（0 为蛇头）
+         */
+        int index() const { return index_; }
+
+    private:
+        friend class CompactBody;
+
+        Cursor(const CompactBody* body, int index, const QPoint& pos)
+            : body_(body), index_(index), pos_(pos) {}
+
+        const CompactBody* body_;   ///< 所属蛇身
+        int index_;                 ///< 当前节序号
+        QPoint pos_;                ///< 当前节坐标
+    };
+
+    CompactBody();
+
+    /**
+     * @brief 按坐标列表重建
+     * @param body 蛇身坐标（body[0] 为蛇头，相邻两节必须相邻）
+     * @return false 表示坐标不连续，此时蛇身被清空
+     */
+    bool reset(const QVector<QPoint>& body);
+
+    /**
+     * @brief 按直线重建（与 Snake::reset 相同的初始形状）
+     * @param head 蛇头位置
+     * @param length 节数
+     * @param direction 初始方向，蛇身向反方向延伸
+     */
+    void reset(const QPoint& head, int length, Direction direction);
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+    /**
+     * @brief 蛇头前进一格，蛇尾让出一格
+     * @param direction 移动方向
+     */
+    void move(Direction direction);
+
+    /**
+     * @brief 蛇头前进一格，蛇尾保留
+     * @param direction 移动方向
+     */
+    void grow(Direction direction);
+
+    /**
+     * @brief 去掉蛇头（撤销一次 grow()，或撤销 move() 的前半步）
+     */
+    void popHead();
+
+    /**
+     * @brief 在蛇尾之后接回一节（撤销 move() 的后半步）
+     * @param tail 新蛇尾，必须与当前蛇尾相邻
+     * @return false 表示不相邻，蛇身不变
+     */
+    bool pushTail(const QPoint& tail);
+
+    /**
+     * @brief 预留容量，之后长度不超过 length 时不再分配内存
+     * @param length 最大节数
+     */
+    void reserve(int length) { reserveLinks(length - 1); }
+
+    /**
+     * @brief 蛇头坐标
+     */
+    QPoint head() const { return head_; }
+
+    /**
+     * @brief 蛇尾坐标
+     */
+    QPoint tail() const { return tail_; }
+
+    /**
+     * @brief 节数
+     */
+    int size() const { return length_; }
+
+    /**
+     * @brief 是否为空
+     */
+    bool isEmpty() const { return length_ == 0; }
+
+    /**
+     * @brief 第 index 节的坐标（从较近的一端推算）
+     * @param index 序号（0 为蛇头）
+     */
+    QPoint at(int index) const;
+
+    /**
+     * @brief 蛇头游标
+     */
+    Cursor begin() const { return Cursor(this, 0, head_); }
+
+    /**
+     * @brief 结束游标
+     */
+    Cursor end() const { return Cursor(this, length_, QPoint()); }
+
+    /**
+     * @brief 展开为坐标列表
+     * @param out 输出（覆盖原内容）
+     */
+    void toVector(QVector<QPoint>* out) const;
+
+    /**
+     * @brief 方向码缓冲区占用的字节数
+     */
+    qsizetype memoryBytes() const { return static_cast<qsizetype>(words_.size() * sizeof(quint64)); }
+
+private:
+    std::vector<quint64> words_;    ///< 方向码环形缓冲区（每字 32 个）
+    int mask_;                      ///< 环容量减一（容量为 2 的幂）
+    int headSlot_;                  ///< 第 0 个方向码所在槽位
+    int length_;                    ///< 节数
+    QPoint head_;                   ///< 蛇头坐标
+    QPoint tail_;                   ///< 蛇尾坐标
+
+    /**
+     * @brief 第 k 个方向码（第 k+1 节走到第 k 节的方向）
+     */
+    Direction link(int k) const {
+        const int slot = (headSlot_ + k) & mask_;
+        return static_cast<Direction>((words_[slot >> 5] >> ((slot & 31) * 2)) & 3);
+    }
+
+    /**
+     * @brief 写入槽位
+     */
+    void store(int slot, Direction direction) {
+        const int shift = (slot & 31) * 2;
+        quint64& word = words_[slot >> 5];
+        word = (word & ~(quint64(3) << shift)) | (quint64(static_cast<int>(direction)) << shift);
+    }
+
+    /**
+     * @brief 保证环至少能容纳 links 个方向码（扩容时按顺序搬到新环开头）
+     */
+    void reserveLinks(int links);
+};
+
+}  // namespace SnakeGame
+
+#endif  // COMPACTBODY_H
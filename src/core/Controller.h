@@ -0,0 +1,42 @@
+/**
+ * @file Controller.h
+ * @brief 自动驾驶控制器接口
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef CONTROLLER_H
+#define CONTROLLER_H
+
+#include "Direction.h"
+
+namespace SnakeGame {
+
+class GameLogic;
+
+/**
+ * @brief 自动驾驶控制器接口
+ *
+ * GameLogic 在每一帧移动之前调用 nextDirection()，
+ * 由控制器代替玩家决定蛇的方向。
+ */
+class Controller {
+public:
+    virtual ~Controller() = default;
+
+    /**
+     * @brief 计算下一帧的移动方向
+     * @param game 当前游戏（只读）
+     * @return 期望的移动方向
+     */
+    virtual Direction nextDirection(const GameLogic& game) = 0;
+
+    /**
+     * @brief 游戏重置时调用，清除控制器内部状态
+     */
+    virtual void reset() {}
+};
+
+}  // namespace SnakeGame
+
+#endif  // CONTROLLER_H
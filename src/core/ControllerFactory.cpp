@@ -0,0 +1,45 @@
+/**
+ * @file ControllerFactory.cpp
+ * @brief 控制器工厂实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ControllerFactory.h"
+#include "EventLog.h"
+#include "GreedyController.h"
+#include "HamiltonController.h"
+#include "PerfectController.h"
+#include "RandomController.h"
+
+namespace SnakeGame {
+
+bool ControllerFactory::isKnown(const QString& name)
+{
+    return name == "random" || name == "greedy" || name == "hamilton" || name == "perfect";
+}
+
+std::unique_ptr<Controller> ControllerFactory::create(
+    const QString& name, int boardWidth, int boardHeight,
+    Food::RandomGenerator generator, std::shared_ptr<const PolicyTable> policy)
+{
+    if (name == "random") {
+        return std::make_unique<RandomController>(std::move(generator));
+    } else if (name == "greedy") {
+        return std::make_unique<GreedyController>();
+    } else if (name == "hamilton") {
+        return std::make_unique<HamiltonController>();
+    } else if (name == "perfect") {
+        if (!PerfectSolver(boardWidth, boardHeight).isSupported()) {
+            SNAKE_LOG_WARNING("ControllerFactory - perfect play supports at most %lld cells, "
+                              "the board has %lld; using the Hamiltonian cycle",
+                              static_cast<qint64>(PerfectSolver::kMaxCells),
+                              static_cast<qint64>(boardWidth) * boardHeight);
+            return std::make_unique<HamiltonController>();
+        }
+        return std::make_unique<PerfectController>(std::move(policy));
+    }
+    return nullptr;
+}
+
+}  // namespace SnakeGame
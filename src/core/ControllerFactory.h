@@ -0,0 +1,52 @@
+/**
+ * @file ControllerFactory.h
+ * @brief 控制器工厂 - 按名称创建自动驾驶控制器
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef CONTROLLERFACTORY_H
+#define CONTROLLERFACTORY_H
+
+#include <QString>
+#include <memory>
+
+#include "Controller.h"
+#include "Food.h"
+#include "PolicyTable.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 控制器工厂
+ *
+ * 图形版、终端版和批量模拟共用的唯一创建入口。最优策略只能在不超过
+ * PerfectSolver::kMaxCells 格的棋盘上求解，更大的棋盘记一条警告并改用哈密顿回路。
+ */
+class ControllerFactory {
+public:
+    /**
+     * @brief 检查控制器名称是否可用
+     * @param name 控制器名称（random / greedy / hamilton / perfect）
+     * @return true 表示可用
+     */
+    static bool isKnown(const QString& name);
+
+    /**
+     * @brief 创建控制器
+     * @param name 控制器名称
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param generator 随机控制器使用的随机数生成器（为空时使用全局生成器）
+     * @param policy 最优控制器使用的策略表（可为空）
+     * @return 控制器，名称未知时返回空指针
+     */
+    static std::unique_ptr<Controller> create(
+        const QString& name, int boardWidth, int boardHeight,
+        Food::RandomGenerator generator = nullptr,
+        std::shared_ptr<const PolicyTable> policy = nullptr);
+};
+
+}  // namespace SnakeGame
+
+#endif  // CONTROLLERFACTORY_H
@@ -0,0 +1,375 @@
+/**
+ * @file DistanceField.cpp
+ * @brief 到食物的距离场实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "DistanceField.h"
+#include "OccupancyGrid.h"
+#include <QtAlgorithms>
+#include <algorithm>
+
+namespace SnakeGame {
+
+namespace {
+
+/** @brief 前沿不再增长且格子数不足参与计算的字数的 1/kSparseFactor 时改用队列 BFS */
+constexpr qint64 kSparseFactor = 2;
+
+}  // namespace
+
+DistanceField::DistanceField(int width, int height)
+    : width_(width)
+    , height_(height)
+    , rowWords_((width + 63) / 64)
+    , wrap_(false)
+    , dirty_(true)
+{
+    const size_t cells = static_cast<size_t>(width) * static_cast<size_t>(height);
+    const size_t words = static_cast<size_t>(rowWords_) * static_cast<size_t>(height);
+    distances_.assign(cells, kUnreachable);
+    blocked_.assign(words, 0);
+    visited_.assign(words, 0);
+    frontier_.assign(words, 0);
+    next_.assign(words, 0);
+    stamps_.assign(cells, 0);
+    epoch_ = 0;
+    queue_.reserve(cells);
+    affected_.reserve(cells);
+    seeds_.reserve(cells);
+}
+
+void DistanceField::reset(const OccupancyGrid& occupancy, bool wrap)
+{
+    wrap_ = wrap;
+    dirty_ = true;
+
+    std::fill(blocked_.begin(), blocked_.end(), quint64(0));
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            if (occupancy.test(QPoint(x, y))) {
+                setBlockedBit(QPoint(x, y), true);
+            }
+        }
+        // 行尾填充位视为不可通行，位并行扩展时自然被屏蔽
+        for (int x = width_; x < rowWords_ * 64; ++x) {
+            blocked_[static_cast<size_t>(y * rowWords_ + (x >> 6))] |= quint64(1) << (x & 63);
+        }
+    }
+}
+
+void DistanceField::rebuild(const QVector<QPoint>& foods)
+{
+    dirty_ = false;
+    std::fill(distances_.begin(), distances_.end(), kUnreachable);
+    std::copy(blocked_.begin(), blocked_.end(), visited_.begin());
+    std::fill(frontier_.begin(), frontier_.end(), quint64(0));
+
+    int lo = height_;
+    int hi = -1;
+    qint64 frontierCells = 0;
+    qint64 previousCells = 0;
+    for (const QPoint& food : foods) {
+        if (food.x() < 0 || food.x() >= width_ || food.y() < 0 || food.y() >= height_) {
+            continue;
+        }
+        const int cell = food.y() * width_ + food.x();
+        if (isBlocked(cell) || distances_[static_cast<size_t>(cell)] == 0) {
+            continue;
+        }
+        const size_t word = static_cast<size_t>(food.y() * rowWords_ + (food.x() >> 6));
+        const quint64 bit = quint64(1) << (food.x() & 63);
+        frontier_[word] |= bit;
+        visited_[word] |= bit;
+        distances_[static_cast<size_t>(cell)] = 0;
+        lo = std::min(lo, food.y());
+        hi = std::max(hi, food.y());
+        ++frontierCells;
+    }
+
+    for (qint32 level = 1; frontierCells > 0; ++level) {
+        const int first = wrap_ ? 0 : std::max(0, lo - 1);
+        const int last = wrap_ ? height_ - 1 : std::min(height_ - 1, hi + 1);
+
+        // 前沿稀疏且不再增长时（如沿蛇身间的窄通道推进）逐字扫描不再划算，改用队列；
+        // 刚从单个食物出发时前沿虽小但逐层扩大，仍按位扩展
+        const qint64 words = static_cast<qint64>(last - first + 1) * rowWords_;
+        if (frontierCells <= previousCells && frontierCells * kSparseFactor < words) {
+            queue_.clear();
+            for (int y = lo; y <= hi; ++y) {
+                for (int w = 0; w < rowWords_; ++w) {
+                    quint64 bits = frontier_[static_cast<size_t>(y * rowWords_ + w)];
+                    while (bits) {
+                        queue_.push_back(y * width_ + w * 64 + qCountTrailingZeroBits(bits));
+                        bits &= bits - 1;
+                    }
+                }
+            }
+            propagateQueue(0);
+            return;
+        }
+
+        previousCells = frontierCells;
+        frontierCells = expandLevel(first, last, level);
+
+        lo = height_;
+        hi = -1;
+        for (int y = first; y <= last; ++y) {
+            for (int w = 0; w < rowWords_; ++w) {
+                if (frontier_[static_cast<size_t>(y * rowWords_ + w)]) {
+                    lo = std::min(lo, y);
+                    hi = y;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void DistanceField::block(const QPoint& pos)
+{
+    setBlockedBit(pos, true);
+    if (dirty_) {
+        return;
+    }
+
+    const int origin = pos.y() * width_ + pos.x();
+    const qint32 old = distances_[static_cast<size_t>(origin)];
+    distances_[static_cast<size_t>(origin)] = kUnreachable;
+    if (old == kUnreachable) {
+        return;
+    }
+
+    int around[4];
+    const quint32 epoch = nextEpoch();
+
+    // 第一步：按距离层次找出失去支撑的格子（没有距离恰好小 1 的有效邻居）
+    affected_.clear();
+    queue_.clear();
+    for (int i = 0, n = neighbors(origin, around); i < n; ++i) {
+        const int cell = around[i];
+        if (!isBlocked(cell) && distances_[static_cast<size_t>(cell)] == old + 1) {
+            stamps_[static_cast<size_t>(cell)] = epoch;
+            queue_.push_back(cell);
+        }
+    }
+    for (size_t head = 0; head < queue_.size(); ++head) {
+        const int cell = queue_[head];
+        const qint32 d = distances_[static_cast<size_t>(cell)];
+
+        bool supported = false;
+        for (int i = 0, n = neighbors(cell, around); i < n && !supported; ++i) {
+            supported = !isBlocked(around[i]) && distances_[static_cast<size_t>(around[i])] == d - 1;
+        }
+        if (supported) {
+            continue;
+        }
+
+        distances_[static_cast<size_t>(cell)] = kUnreachable;
+        affected_.push_back(cell);
+        for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+            const int next = around[i];
+            if (!isBlocked(next) && stamps_[static_cast<size_t>(next)] != epoch &&
+                distances_[static_cast<size_t>(next)] == d + 1) {
+                stamps_[static_cast<size_t>(next)] = epoch;
+                queue_.push_back(next);
+            }
+        }
+    }
+
+    // 第二步：失效格子从未受影响的邻居取得候选距离，按距离顺序重新传播
+    seeds_.clear();
+    for (int cell : affected_) {
+        qint32 best = kUnreachable;
+        for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+            const qint32 d = distances_[static_cast<size_t>(around[i])];
+            if (!isBlocked(around[i]) && d != kUnreachable) {
+                best = std::min(best, d + 1);
+            }
+        }
+        if (best != kUnreachable) {
+            seeds_.emplace_back(best, cell);
+        }
+    }
+    std::sort(seeds_.begin(), seeds_.end());
+
+    // 起点与队列各自按距离单调，归并后即为按距离顺序处理
+    queue_.clear();
+    size_t head = 0;
+    size_t seed = 0;
+    while (seed < seeds_.size() || head < queue_.size()) {
+        int cell;
+        if (head == queue_.size() ||
+            (seed < seeds_.size() &&
+             seeds_[seed].first <= distances_[static_cast<size_t>(queue_[head])])) {
+            cell = seeds_[seed].second;
+            const qint32 d = seeds_[seed].first;
+            ++seed;
+            if (d >= distances_[static_cast<size_t>(cell)]) {
+                continue;
+            }
+            distances_[static_cast<size_t>(cell)] = d;
+        } else {
+            cell = queue_[head++];
+        }
+
+        const qint32 d = distances_[static_cast<size_t>(cell)] + 1;
+        for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+            const int next = around[i];
+            if (!isBlocked(next) && d < distances_[static_cast<size_t>(next)]) {
+                distances_[static_cast<size_t>(next)] = d;
+                queue_.push_back(next);
+            }
+        }
+    }
+}
+
+void DistanceField::unblock(const QPoint& pos)
+{
+    setBlockedBit(pos, false);
+    if (dirty_) {
+        return;
+    }
+
+    const int origin = pos.y() * width_ + pos.x();
+    int around[4];
+    qint32 best = kUnreachable;
+    for (int i = 0, n = neighbors(origin, around); i < n; ++i) {
+        const qint32 d = distances_[static_cast<size_t>(around[i])];
+        if (!isBlocked(around[i]) && d != kUnreachable) {
+            best = std::min(best, d + 1);
+        }
+    }
+    distances_[static_cast<size_t>(origin)] = best;
+    if (best == kUnreachable) {
+        return;
+    }
+
+    queue_.clear();
+    queue_.push_back(origin);
+    propagateQueue(0);
+}
+
+void DistanceField::setBlockedBit(const QPoint& pos, bool blocked)
+{
+    quint64& word = blocked_[static_cast<size_t>(pos.y() * rowWords_ + (pos.x() >> 6))];
+    const quint64 bit = quint64(1) << (pos.x() & 63);
+    word = blocked ? (word | bit) : (word & ~bit);
+}
+
+quint32 DistanceField::nextEpoch()
+{
+    // 回绕时清零，避免旧标记被误认为本轮
+    if (++epoch_ == 0) {
+        std::fill(stamps_.begin(), stamps_.end(), 0u);
+        epoch_ = 1;
+    }
+    return epoch_;
+}
+
+int DistanceField::neighbors(int cell, int out[4]) const
+{
+    const int x = cell % width_;
+    const int y = cell / width_;
+    int n = 0;
+    if (x > 0) {
+        out[n++] = cell - 1;
+    } else if (wrap_) {
+        out[n++] = cell + width_ - 1;
+    }
+    if (x < width_ - 1) {
+        out[n++] = cell + 1;
+    } else if (wrap_) {
+        out[n++] = cell - width_ + 1;
+    }
+    if (y > 0) {
+        out[n++] = cell - width_;
+    } else if (wrap_) {
+        out[n++] = cell + (height_ - 1) * width_;
+    }
+    if (y < height_ - 1) {
+        out[n++] = cell + width_;
+    } else if (wrap_) {
+        out[n++] = cell - (height_ - 1) * width_;
+    }
+    return n;
+}
+
+qint64 DistanceField::expandLevel(int first, int last, qint32 level)
+{
+    const int lastWord = rowWords_ - 1;
+    const int lastBit = (width_ - 1) & 63;
+
+    // 先算出整层再写回，避免同一层内的新前沿参与扩展
+    for (int y = first; y <= last; ++y) {
+        const quint64* row = &frontier_[static_cast<size_t>(y * rowWords_)];
+        const quint64* up = y > 0 ? row - rowWords_
+                                  : (wrap_ ? &frontier_[static_cast<size_t>((height_ - 1) * rowWords_)] : nullptr);
+        const quint64* down = y < height_ - 1 ? row + rowWords_
+                                              : (wrap_ ? &frontier_[0] : nullptr);
+        quint64* out = &next_[static_cast<size_t>(y * rowWords_)];
+        const quint64* seen = &visited_[static_cast<size_t>(y * rowWords_)];
+
+        for (int w = 0; w <= lastWord; ++w) {
+            const quint64 f = row[w];
+            quint64 reach = (f << 1) | (f >> 1);
+            if (w > 0) {
+                reach |= row[w - 1] >> 63;
+            }
+            if (w < lastWord) {
+                reach |= row[w + 1] << 63;
+            }
+            if (wrap_) {
+                if (w == 0) {
+                    reach |= (row[lastWord] >> lastBit) & 1;
+                }
+                if (w == lastWord) {
+                    reach |= (row[0] & 1) << lastBit;
+                }
+            }
+            if (up) {
+                reach |= up[w];
+            }
+            if (down) {
+                reach |= down[w];
+            }
+            out[w] = reach & ~seen[w];
+        }
+    }
+
+    qint64 added = 0;
+    for (int y = first; y <= last; ++y) {
+        for (int w = 0; w <= lastWord; ++w) {
+            const size_t index = static_cast<size_t>(y * rowWords_ + w);
+            quint64 bits = next_[index];
+            frontier_[index] = bits;
+            visited_[index] |= bits;
+            while (bits) {
+                const int x = w * 64 + qCountTrailingZeroBits(bits);
+                distances_[static_cast<size_t>(y * width_ + x)] = level;
+                bits &= bits - 1;
+                ++added;
+            }
+        }
+    }
+    return added;
+}
+
+void DistanceField::propagateQueue(size_t head)
+{
+    int around[4];
+    for (; head < queue_.size(); ++head) {
+        const int cell = queue_[head];
+        const qint32 d = distances_[static_cast<size_t>(cell)] + 1;
+        for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+            const int next = around[i];
+            if (!isBlocked(next) && d < distances_[static_cast<size_t>(next)]) {
+                distances_[static_cast<size_t>(next)] = d;
+                queue_.push_back(next);
+            }
+        }
+    }
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,164 @@
+/**
+ * @file DistanceField.h
+ * @brief 到食物的距离场 - 食物变化时整体重建，蛇头蛇尾变化时局部修补
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include <QPoint>
+#include <QVector>
+#include <QtGlobal>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace SnakeGame {
+
+class OccupancyGrid;
+
+/**
+ * @brief 每个格子沿空闲格走到最近食物的步数
+ *
+ * 被占据的格子（蛇身、障碍物）不可通行，距离为 kUnreachable。
+ *
+ * - 重建（食物变化时）：按位并行的多源 BFS，每行按 64 位字对齐，
+ *   一次字运算同时扩展 64 个格子；前沿变得稀疏后切换为普通队列 BFS，
+ *   总开销仍为 O(格数)
+ * - 修补（每帧）：蛇尾让出的格子只会让距离变短，从该格向外传播；
+ *   蛇头占据的格子只会让距离变长，先找出依赖该格的格子，
+ *   再从未受影响的边界按距离顺序重新传播。开销只与受影响的区域有关
+ *
+ * 所有缓冲区在构造时按格数分配，之后重建和修补都不再分配内存。
+ */
+class DistanceField {
+public:
+    static constexpr qint32 kUnreachable = std::numeric_limits<qint32>::max();  ///< 不可达
+
+    /**
+     * @brief 构造函数
+     * @param width 棋盘宽度（格数）
+     * @param height 棋盘高度（格数）
+     */
+    DistanceField(int width, int height);
+
+    /**
+     * @brief 按占用位图同步可通行格子，并标记为待重建
+     * @param occupancy 占用位图（障碍物与蛇身）
+     * @param wrap 越过边界是否从对侧出现
+     */
+    void reset(const OccupancyGrid& occupancy, bool wrap);
+
+    /**
+     * @brief 以一组食物为源整体重建
+     * @param foods 食物坐标
+     */
+    void rebuild(const QVector<QPoint>& foods);
+
+    /**
+     * @brief 标记为待重建：之后的 block()/unblock() 只更新可通行位，不再修补距离
+     *
+     * 本帧稍后必然重建时调用（例如蛇头吃掉了食物），省去无用的修补。
+     */
+    void invalidate() { dirty_ = true; }
+
+    /**
+     * @brief 格子被占据（新蛇头），距离只会变长
+     */
+    void block(const QPoint& pos);
+
+    /**
+     * @brief 格子被让出（蛇尾离开），距离只会变短
+     */
+    void unblock(const QPoint& pos);
+
+    /**
+     * @brief 查询到最近食物的步数
+     * @param pos 格子坐标
+     * @return 步数，被占据、不可达或在棋盘外时为 kUnreachable
+     */
+    qint32 distance(const QPoint& pos) const {
+        if (pos.x() < 0 || pos.x() >= width_ || pos.y() < 0 || pos.y() >= height_) {
+            return kUnreachable;
+        }
+        return distances_[static_cast<size_t>(pos.y() * width_ + pos.x())];
+    }
+
+    /**
+     * @brief 距离数组首地址（行优先，width × height 个元素）
+     */
+    const qint32* data() const { return distances_.data(); }
+
+    /**
+     * @brief 棋盘宽度
+     */
+    int width() const { return width_; }
+
+    /**
+     * @brief 棋盘高度
+     */
+    int height() const { return height_; }
+
+    /**
+     * @brief 是否正等待重建
+     */
+    bool isDirty() const { return dirty_; }
+
+private:
+    int width_;                         ///< 棋盘宽度
+    int height_;                        ///< 棋盘高度
+    int rowWords_;                      ///< 每行占用的 64 位字数
+    bool wrap_;                         ///< 越界回绕
+    bool dirty_;                        ///< 距离是否待重建
+
+    std::vector<qint32> distances_;     ///< 每格距离
+    std::vector<quint64> blocked_;      ///< 不可通行位图（按行对齐）
+    std::vector<quint64> visited_;      ///< 重建用：已访问位图
+    std::vector<quint64> frontier_;     ///< 重建用：当前前沿
+    std::vector<quint64> next_;         ///< 重建用：下一层前沿
+    std::vector<int> queue_;            ///< BFS 队列（容量为格数）
+    std::vector<int> affected_;         ///< 修补用：失效的格子
+    std::vector<std::pair<qint32, int>> seeds_;     ///< 修补用：重新传播的起点
+    std::vector<quint32> stamps_;       ///< 修补用：入队标记（与 epoch_ 相等表示本轮已入队）
+    quint32 epoch_;                     ///< 当前修补轮次
+
+    bool isBlocked(int cell) const {
+        const int x = cell % width_;
+        const int y = cell / width_;
+        return (blocked_[static_cast<size_t>(y * rowWords_ + (x >> 6))] >> (x & 63)) & 1;
+    }
+
+    void setBlockedBit(const QPoint& pos, bool blocked);
+
+    /**
+     * @brief 开始新一轮修补，返回本轮标记值
+     */
+    quint32 nextEpoch();
+
+    /**
+     * @brief 取格子的 4 个邻居（棋盘外且不回绕的方向跳过）
+     * @return 邻居数
+     */
+    int neighbors(int cell, int out[4]) const;
+
+    /**
+     * @brief 位并行扩展一层前沿
+     * @param first 参与计算的首行
+     * @param last 参与计算的末行
+     * @param level 新前沿的距离
+     * @return 新访问的格子数
+     */
+    qint64 expandLevel(int first, int last, qint32 level);
+
+    /**
+     * @brief 以队列中的格子为起点做普通 BFS（队列内距离单调不减）
+     * @param head 队列读位置
+     */
+    void propagateQueue(size_t head);
+};
+
+}  // namespace SnakeGame
+
+#endif  // DISTANCEFIELD_H
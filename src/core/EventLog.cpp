@@ -0,0 +1,230 @@
+/**
+ * @file EventLog.cpp
+ * @brief 事件日志实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "EventLog.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief 缓冲区中的一条记录（格式化推迟到后台线程）
+ */
+struct LogRecord {
+    qint64 time;                ///< 记录时间（纳秒，自日志创建起）
+    const LogSite* site;        ///< 调用点
+    qint64 args[2];             ///< 参数
+    quint64 suppressed;         ///< 此前被限流丢弃的次数
+};
+
+/**
+ * @brief 环形缓冲的槽位，序号标明槽位可写还是可读
+ */
+struct LogSlot {
+    std::atomic<quint64> sequence;
+    LogRecord record;
+};
+
+/**
+ * @brief 日志单例：有界多生产者队列 + 后台输出线程
+ *
+ * 队列为按槽位序号同步的有界队列：生产者竞争入队位置后写入槽位再发布序号，
+ * 消费者按序号判断槽位是否写完。消费端由 consumerMutex_ 串行化，
+ * 后台线程与 flush() 都可以消费。
+ */
+class Logger {
+public:
+    Logger()
+        : slots_(new LogSlot[EventLog::kCapacity])
+        , enqueue_(0)
+        , dequeue_(0)
+        , dropped_(0)
+        , epoch_(std::chrono::steady_clock::now())
+        , stopping_(false)
+    {
+        for (int i = 0; i < EventLog::kCapacity; ++i) {
+            slots_[i].sequence.store(static_cast<quint64>(i), std::memory_order_relaxed);
+        }
+        flusher_ = std::thread([this]() { run(); });
+        std::atexit([]() { instance().shutdown(); });
+    }
+
+    static Logger& instance()
+    {
+        // 有意不析构：其他静态对象析构时仍可能记录，退出时由 atexit 输出剩余记录
+        static Logger* logger = new Logger();
+        return *logger;
+    }
+
+    qint64 now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch_).count();
+    }
+
+    void push(const LogRecord& record)
+    {
+        const quint64 mask = EventLog::kCapacity - 1;
+        quint64 pos = enqueue_.load(std::memory_order_relaxed);
+        for (;;) {
+            LogSlot& slot = slots_[pos & mask];
+            const quint64 sequence = slot.sequence.load(std::memory_order_acquire);
+            const qint64 diff = static_cast<qint64>(sequence - pos);
+            if (diff == 0) {
+                if (enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.record = record;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return;
+                }
+            } else if (diff < 0) {
+                // 环满：丢弃而不是等待
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void drain()
+    {
+        std::lock_guard<std::mutex> lock(consumerMutex_);
+        const quint64 mask = EventLog::kCapacity - 1;
+        bool wrote = false;
+        for (;;) {
+            LogSlot& slot = slots_[dequeue_ & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeue_ + 1) {
+                break;
+            }
+            const LogRecord record = slot.record;
+            slot.sequence.store(dequeue_ + EventLog::kCapacity, std::memory_order_release);
+            ++dequeue_;
+            print(record);
+            wrote = true;
+        }
+        if (wrote) {
+            std::fflush(stderr);
+        }
+    }
+
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        if (flusher_.joinable()) {
+            flusher_.join();
+        }
+        drain();
+    }
+
+    quint64 dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        while (!stopping_) {
+            wake_.wait_for(lock, std::chrono::milliseconds(EventLog::kFlushIntervalMs));
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    }
+
+    static void print(const LogRecord& record)
+    {
+        static const char kLevels[] = "DIWE";
+        const LogSite& site = *record.site;
+        const char* file = std::strrchr(site.file, '/');
+        const char* backslash = std::strrchr(file ? file : site.file, '\\');
+        file = backslash ? backslash + 1 : (file ? file + 1 : site.file);
+
+        char message[256];
+        std::snprintf(message, sizeof(message), site.format,
+                      static_cast<long long>(record.args[0]), static_cast<long long>(record.args[1]));
+        std::fprintf(stderr, "[%10.3f] %c %s:%d %s", record.time / 1e9,
+                     kLevels[static_cast<int>(site.level) & 3], file, site.line, message);
+        if (record.suppressed > 0) {
+            std::fprintf(stderr, " (%llu more suppressed)",
+                         static_cast<unsigned long long>(record.suppressed));
+        }
+        std::fputc('\n', stderr);
+    }
+
+    std::unique_ptr<LogSlot[]> slots_;  ///< 环形缓冲
+    std::atomic<quint64> enqueue_;      ///< 下一个入队位置
+    quint64 dequeue_;                   ///< 下一个出队位置（受 consumerMutex_ 保护）
+    std::atomic<quint64> dropped_;      ///< 环满丢弃的记录数
+    std::chrono::steady_clock::time_point epoch_;   ///< 时间起点
+    std::mutex consumerMutex_;          ///< 串行化消费端
+    std::mutex wakeMutex_;              ///< 后台线程等待用
+    std::condition_variable wake_;      ///< 退出时唤醒后台线程
+    bool stopping_;                     ///< 是否正在退出
+    std::thread flusher_;               ///< 后台输出线程
+};
+
+}  // namespace
+
+std::atomic<int> EventLog::runtimeLevel_{static_cast<int>(LogLevel::Debug)};
+
+void EventLog::setLevel(LogLevel level)
+{
+    runtimeLevel_.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel EventLog::level()
+{
+    return static_cast<LogLevel>(runtimeLevel_.load(std::memory_order_relaxed));
+}
+
+void EventLog::write(LogSite& site, qint64 arg0, qint64 arg1)
+{
+    Logger& logger = Logger::instance();
+    const qint64 now = logger.now();
+
+    // 每个调用点按固定窗口限流，窗口切换时的竞争最多多记或少记几条
+    qint64 start = site.windowStart.load(std::memory_order_relaxed);
+    if (now - start >= kSiteWindowNs &&
+        site.windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+        site.windowCount.store(0, std::memory_order_relaxed);
+    }
+    if (site.windowCount.fetch_add(1, std::memory_order_relaxed) >= kSiteBurst) {
+        site.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    LogRecord record;
+    record.time = now;
+    record.site = &site;
+    record.args[0] = arg0;
+    record.args[1] = arg1;
+    record.suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+    logger.push(record);
+}
+
+void EventLog::flush()
+{
+    Logger::instance().drain();
+}
+
+quint64 EventLog::droppedCount()
+{
+    return Logger::instance().dropped();
+}
+
+}  // namespace SnakeGame
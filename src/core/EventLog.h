@@ -0,0 +1,135 @@
+/**
+ * @file EventLog.h
+ * @brief 事件日志 - 定长二进制环形缓冲，后台线程格式化输出
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <QtGlobal>
+#include <atomic>
+
+/**
+ * @brief 编译期日志级别：低于该级别的调用点整段编译掉
+ *
+ * 0 Debug、1 Info、2 Warning、3 Error、4 全部关闭。
+ * 可由 CMake 的 SNAKE_LOG_LEVEL 覆盖，默认 Release 构建为 Info，其余为 Debug。
+ */
+#ifndef SNAKE_LOG_LEVEL
+#ifdef NDEBUG
+#define SNAKE_LOG_LEVEL 1
+#else
+#define SNAKE_LOG_LEVEL 0
+#endif
+#endif
+
+namespace SnakeGame {
+
+/**
+ * @brief 日志级别
+ */
+enum class LogLevel : int {
+    Debug = 0,      ///< 调试信息
+    Info = 1,       ///< 一般信息
+    Warning = 2,    ///< 异常但可继续
+    Error = 3       ///< 错误
+};
+
+/**
+ * @brief 调用点的静态信息与限流状态（每个 SNAKE_LOG 调用点一个静态实例）
+ */
+struct LogSite {
+    LogLevel level;                         ///< 级别
+    const char* format;                     ///< printf 格式，参数一律用 %lld
+    const char* file;                       ///< 源文件
+    int line;                               ///< 行号
+    std::atomic<qint64> windowStart{0};     ///< 当前限流窗口的开始时间（纳秒）
+    std::atomic<int> windowCount{0};        ///< 当前窗口内已记录的次数
+    std::atomic<quint64> suppressed{0};     ///< 被限流丢弃、尚未报告的次数
+};
+
+/**
+ * @brief 事件日志
+ *
+ * 调用点只把时间戳、调用点指针和至多两个整数参数写入定长环形缓冲
+ * （多生产者无锁，环满时丢弃并计数），不格式化、不分配内存、不等待；
+ * 后台线程定期取出、格式化并写到标准错误。
+ * 每个调用点每秒最多记录 kSiteBurst 次，超出的次数附在下一条记录上报告。
+ * 第一次记录时创建缓冲区和后台线程，程序退出时输出剩余记录。
+ *
+ * 编译期级别之上还有运行时级别（setLevel），低于它的调用只读一次原子变量即返回，
+ * 不计入限流，也不会创建后台线程。
+ */
+class EventLog {
+public:
+    static constexpr int kCapacity = 1 << 12;               ///< 环形缓冲容量（条，2 的幂）
+    static constexpr int kSiteBurst = 5;                    ///< 每个调用点每个窗口最多记录的条数
+    static constexpr qint64 kSiteWindowNs = 1000000000;     ///< 限流窗口（纳秒）
+    static constexpr int kFlushIntervalMs = 50;             ///< 后台线程输出间隔（毫秒）
+
+    /**
+     * @brief 记录一条事件
+     * @param site 调用点
+     * @param arg0 第一个参数
+     * @param arg1 第二个参数
+     */
+    static void write(LogSite& site, qint64 arg0, qint64 arg1);
+
+    static void log(LogSite& site) { write(site, 0, 0); }
+    static void log(LogSite& site, qint64 arg0) { write(site, arg0, 0); }
+    static void log(LogSite& site, qint64 arg0, qint64 arg1) { write(site, arg0, arg1); }
+
+    /**
+     * @brief 设置运行时级别（默认 Debug，即只受编译期级别限制）
+     * @param level 低于该级别的调用被丢弃
+     */
+    static void setLevel(LogLevel level);
+
+    /**
+     * @brief 当前运行时级别
+     */
+    static LogLevel level();
+
+    /**
+     * @brief 某一级别的调用是否会被记录（供 SNAKE_LOG 宏使用）
+     */
+    static bool isEnabled(LogLevel level) {
+        return static_cast<int>(level) >= runtimeLevel_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 立即输出缓冲区中的全部记录（在调用线程执行）
+     */
+    static void flush();
+
+    /**
+     * @brief 因缓冲区已满而丢弃的记录数
+     */
+    static quint64 droppedCount();
+
+private:
+    static std::atomic<int> runtimeLevel_;  ///< 运行时级别
+};
+
+}  // namespace SnakeGame
+
+/**
+ * @brief 记录事件：SNAKE_LOG(级别, "格式 %lld", 参数...)，参数至多两个整数
+ */
+#define SNAKE_LOG(level, format, ...)                                                   \
+    do {                                                                                \
+        if (static_cast<int>(level) >= SNAKE_LOG_LEVEL &&                               \
+            ::SnakeGame::EventLog::isEnabled(level)) {                                  \
+            static ::SnakeGame::LogSite snakeLogSite{level, format, __FILE__, __LINE__}; \
+            ::SnakeGame::EventLog::log(snakeLogSite, ##__VA_ARGS__);                    \
+        }                                                                               \
+    } while (false)
+
+#define SNAKE_LOG_DEBUG(...) SNAKE_LOG(::SnakeGame::LogLevel::Debug, __VA_ARGS__)
+#define SNAKE_LOG_INFO(...) SNAKE_LOG(::SnakeGame::LogLevel::Info, __VA_ARGS__)
+#define SNAKE_LOG_WARNING(...) SNAKE_LOG(::SnakeGame::LogLevel::Warning, __VA_ARGS__)
+#define SNAKE_LOG_ERROR(...) SNAKE_LOG(::SnakeGame::LogLevel::Error, __VA_ARGS__)
+
+#endif  // EVENTLOG_H
@@ -6,13 +6,24 @@
  */
 
 #include "Food.h"
+#include "EventLog.h"
 #include <QRandomGenerator>
-#include <QDebug>
+#include <algorithm>
 
 namespace SnakeGame {
 
+namespace {
+
+/** @brief 空闲格少于 1/kDenseFreeFraction 时改用空闲格列表（拒绝采样期望不超过该次数） */
+constexpr int kDenseFreeFraction = 8;
+
+/** @brief 拒绝采样的最大尝试次数，超过后退回整盘扫描 */
+constexpr int kMaxRejectionAttempts = 64;
+
+}  // namespace
+
 Food::Food(int boardWidth, int boardHeight)
-    : position_(-1, -1)
+    : count_(1)
     , boardWidth_(boardWidth)
     , boardHeight_(boardHeight)
 {
@@ -20,27 +31,102 @@ Food::Food(int boardWidth, int boardHeight)
     randomGenerator_ = [](int min, int max) {
         return QRandomGenerator::global()->bounded(min, max + 1);
     };
+    reserveScratch();
 }
 
 QPoint Food::getPosition() const
 {
-    return position_;
+    return positions_.isEmpty() ? QPoint(-1, -1) : positions_.first();
 }
 
-bool Food::respawn(const QVector<QPoint>& excludePositions)
+const QVector<QPoint>& Food::getPositions() const
 {
-    QVector<QPoint> availablePositions = getAvailablePositions(excludePositions);
+    return positions_;
+}
 
-    if (availablePositions.isEmpty()) {
-        qWarning() << "Food::respawn() - No available positions";
-        return false;
+void Food::setCount(int count)
+{
+    count_ = std::max(1, count);
+    positions_.reserve(count_);
+}
+
+int Food::getCount() const
+{
+    return count_;
+}
+
+void Food::remove(int index)
+{
+    if (index < 0 || index >= positions_.size()) {
+        return;
     }
 
-    // 随机选择一个可用位置
-    int index = randomGenerator_(0, availablePositions.size() - 1);
-    position_ = availablePositions[index];
+    // 与末尾交换后删除，保持 positions_ 紧凑
+    const QPoint eaten = positions_[index];
+    const QPoint last = positions_.last();
+    positions_[index] = last;
+    foodAt_[static_cast<size_t>(last.y() * boardWidth_ + last.x())] = index;
+    foodAt_[static_cast<size_t>(eaten.y() * boardWidth_ + eaten.x())] = -1;
+    positions_.removeLast();
+}
 
-    return true;
+void Food::restore(int index, const QPoint& pos)
+{
+    if (index < 0 || index > positions_.size()) {
+        return;
+    }
+
+    // remove() 把末尾的食物移到了 index，这里把它移回末尾
+    if (index < positions_.size()) {
+        const QPoint moved = positions_[index];
+        positions_.append(moved);
+        foodAt_[static_cast<size_t>(moved.y() * boardWidth_ + moved.x())] = positions_.size() - 1;
+        positions_[index] = pos;
+    } else {
+        positions_.append(pos);
+    }
+    foodAt_[static_cast<size_t>(pos.y() * boardWidth_ + pos.x())] = index;
+}
+
+void Food::removeLast()
+{
+    if (positions_.isEmpty()) {
+        return;
+    }
+
+    const QPoint last = positions_.last();
+    foodAt_[static_cast<size_t>(last.y() * boardWidth_ + last.x())] = -1;
+    positions_.removeLast();
+}
+
+int Food::refill(OccupancyGrid& occupancy)
+{
+    const int cells = occupancy.cellCount();
+    int vacant = cells - occupancy.count() - positions_.size();
+
+    if (vacant <= 0 && positions_.isEmpty()) {
+        SNAKE_LOG_WARNING("Food::refill() - No available positions");
+        return 0;
+    }
+
+    // 空闲格所剩无几时拒绝采样的期望次数过高，改用空闲格列表
+    if (!occupancy.tracksFreeCells() &&
+        static_cast<qint64>(cells - occupancy.count()) * kDenseFreeFraction < cells) {
+        occupancy.setTrackFreeCells(true);
+    }
+
+    int placed = 0;
+    while (positions_.size() < count_ && vacant > 0) {
+        QPoint pos;
+        if (!pickCell(occupancy, &pos)) {
+            break;
+        }
+        foodAt_[static_cast<size_t>(pos.y() * boardWidth_ + pos.x())] = positions_.size();
+        positions_.append(pos);
+        --vacant;
+        ++placed;
+    }
+    return placed;
 }
 
 void Food::setRandomGenerator(RandomGenerator generator)
@@ -54,24 +140,74 @@ void Food::reset(int boardWidth, int boardHeight)
 {
     boardWidth_ = boardWidth;
     boardHeight_ = boardHeight;
-    position_ = QPoint(-1, -1);
+    reserveScratch();
 }
 
-QVector<QPoint> Food::getAvailablePositions(const QVector<QPoint>& excludePositions) const
+bool Food::pickCell(OccupancyGrid& occupancy, QPoint* pos)
 {
-    QVector<QPoint> available;
-    available.reserve(boardWidth_ * boardHeight_ - excludePositions.size());
-
-    for (int x = 0; x < boardWidth_; ++x) {
-        for (int y = 0; y < boardHeight_; ++y) {
-            QPoint pos(x, y);
-            if (!excludePositions.contains(pos)) {
-                available.append(pos);
+    const int cells = occupancy.cellCount();
+
+    if (occupancy.tracksFreeCells()) {
+        // 空闲格列表不区分食物，命中已有食物时重抽
+        const int freeCells = cells - occupancy.count();
+        for (int attempt = 0; attempt < kMaxRejectionAttempts; ++attempt) {
+            const QPoint candidate = occupancy.freeCell(randomGenerator_(0, freeCells - 1));
+            if (indexAt(candidate) < 0) {
+                *pos = candidate;
+                return true;
             }
         }
+        return pickByScan(occupancy, pos);
+    }
+
+    // 稀疏时随机抽格子，命中可用格即可，结果在可用格上均匀分布
+    for (int attempt = 0; attempt < kMaxRejectionAttempts; ++attempt) {
+        const int cell = randomGenerator_(0, cells - 1);
+        const QPoint candidate(cell % boardWidth_, cell / boardWidth_);
+        if (isVacant(occupancy, candidate)) {
+            *pos = candidate;
+            return true;
+        }
     }
 
-    return available;
+    return pickByScan(occupancy, pos);
+}
+
+bool Food::pickByScan(const OccupancyGrid& occupancy, QPoint* pos)
+{
+    // clear() 保留容量，不会重新分配
+    available_.clear();
+    for (int y = 0; y < boardHeight_; ++y) {
+        for (int x = 0; x < boardWidth_; ++x) {
+            const QPoint candidate(x, y);
+            if (isVacant(occupancy, candidate)) {
+                available_.append(candidate);
+            }
+        }
+    }
+
+    if (available_.isEmpty()) {
+        return false;
+    }
+    *pos = available_[randomGenerator_(0, available_.size() - 1)];
+    return true;
+}
+
+void Food::reserveScratch()
+{
+    const int cells = boardWidth_ * boardHeight_;
+    available_.reserve(cells);
+
+    // 只清除现有食物所在的格子，不必整表重写
+    if (foodAt_.size() != static_cast<size_t>(cells)) {
+        foodAt_.assign(static_cast<size_t>(cells), -1);
+    } else {
+        for (const QPoint& pos : positions_) {
+            foodAt_[static_cast<size_t>(pos.y() * boardWidth_ + pos.x())] = -1;
+        }
+    }
+    positions_.clear();
+    positions_.reserve(count_);
 }
 
 }  // namespace SnakeGame
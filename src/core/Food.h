@@ -11,6 +11,9 @@
 #include <QPoint>
 #include <QVector>
 #include <functional>
+#include <vector>
+
+#include "OccupancyGrid.h"
 
 namespace SnakeGame {
 
@@ -18,8 +21,11 @@ namespace SnakeGame {
  * @brief 食物类 - 管理食物的位置和重新生成
  * 
  * 职责：
- * - 存储食物当前位置
+ * - 存储食物当前位置（可同时存在 K 个）
  * - 在空白区域随机生成新食物
+ *
+ * 食物坐标紧凑存放在 positions_ 中，另有按格索引的反查表，
+ * 每帧判断蛇头是否吃到食物为 O(1)，与 K 无关。
  */
 class Food {
 public:
@@ -40,16 +46,72 @@ public:
 
     /**
      * @brief 获取食物当前位置
-     * @return 食物坐标
+     * @return 第一个食物的坐标，没有食物时为 (-1, -1)
      */
     QPoint getPosition() const;
 
     /**
-     * @brief 在排除指定位置后重新生成食物
-     * @param excludePositions 需要排除的位置（如蛇身）
-     * @return true 生成成功，false 表示没有可用位置
+     * @brief 获取全部食物位置
+     * @return 食物坐标（只含棋盘上现有的食物，顺序不固定）
+     */
+    const QVector<QPoint>& getPositions() const;
+
+    /**
+     * @brief 查找格子上的食物
+     * @param pos 格子坐标
+     * @return 食物在 getPositions() 中的下标，没有食物时为 -1
+     */
+    int indexAt(const QPoint& pos) const {
+        if (pos.x() < 0 || pos.x() >= boardWidth_ || pos.y() < 0 || pos.y() >= boardHeight_) {
+            return -1;
+        }
+        return foodAt_[static_cast<size_t>(pos.y() * boardWidth_ + pos.x())];
+    }
+
+    /**
+     * @brief 设置同时存在的食物数量
+     * @param count 食物数量 K（至少为 1），下一次 refill() 时生效
+     */
+    void setCount(int count);
+
+    /**
+     * @brief 获取同时存在的食物数量
+     * @return 食物数量 K
+     */
+    int getCount() const;
+
+    /**
+     * @brief 移除一个食物（被吃掉）
+     * @param index 食物下标，末尾的食物会移到该下标
+     */
+    void remove(int index);
+
+    /**
+     * @brief 撤销一次 remove()：把被吃掉的食物放回原下标
+     * @param index remove() 时的下标
+     * @param pos 被吃掉的食物坐标
      */
-    bool respawn(const QVector<QPoint>& excludePositions);
+    void restore(int index, const QPoint& pos);
+
+    /**
+     * @brief 移除最后一个食物（撤销一次生成）
+     */
+    void removeLast();
+
+    /**
+     * @brief 在未被占据的格子中补足食物，一次补齐到 K 个
+     * @param occupancy 棋盘占用位图（蛇身等）
+     * @return 本次新生成的食物数，新食物位于 getPositions() 末尾
+     *
+     * 每个食物在既不被占据、也没有其他食物的格子上均匀随机选取，
+     * 按占用率自适应选择策略：
+     * - 稀疏：随机抽格子并查询位图，期望尝试次数 = 格数 / 空闲格数；
+     *   连续失败多次后退回整盘扫描，分布仍然均匀
+     * - 密集（空闲格少于 1/8）：为位图开启空闲格列表，
+     *   之后直接按下标抽取，O(1)
+     * 所有随机数都来自 setRandomGenerator() 设置的生成器，结果可复现。
+     */
+    int refill(OccupancyGrid& occupancy);
 
     /**
      * @brief 设置随机数生成器（用于测试）
@@ -58,24 +120,49 @@ public:
     void setRandomGenerator(RandomGenerator generator);
 
     /**
-     * @brief 重置食物状态
+     * @brief 重置食物状态（移除所有食物）
      * @param boardWidth 新的游戏区域宽度
      * @param boardHeight 新的游戏区域高度
      */
     void reset(int boardWidth, int boardHeight);
 
 private:
-    QPoint position_;           ///< 食物当前位置
+    QVector<QPoint> positions_;         ///< 现有食物坐标
+    std::vector<int> foodAt_;           ///< 格索引 → 食物下标（-1 表示没有食物）
+    int count_;                         ///< 同时存在的食物数量 K
     int boardWidth_;            ///< 游戏区域宽度
     int boardHeight_;           ///< 游戏区域高度
     RandomGenerator randomGenerator_;   ///< 随机数生成器
 
+    QVector<QPoint> available_;         ///< 退回扫描时复用的可用位置列表（容量按格数预留）
+
+    /**
+     * @brief 格子是否可以放置食物
+     */
+    bool isVacant(const OccupancyGrid& occupancy, const QPoint& pos) const {
+        return !occupancy.test(pos) && indexAt(pos) < 0;
+    }
+
+    /**
+     * @brief 均匀随机地选取一个可放置食物的格子
+     * @param occupancy 棋盘占用位图
+     * @param pos 输出坐标
+     * @return false 表示没有可用位置
+     */
+    bool pickCell(OccupancyGrid& occupancy, QPoint* pos);
+
+    /**
+     * @brief 整盘扫描收集可用位置并均匀抽取一个
+     * @param occupancy 棋盘占用位图
+     * @param pos 输出坐标
+     * @return false 表示没有可用位置
+     */
+    bool pickByScan(const OccupancyGrid& occupancy, QPoint* pos);
+
     /**
-     * @brief 获取所有可用位置
-     * @param excludePositions 需要排除的位置
-     * @return 可用位置列表
+     * @brief 按当前棋盘尺寸预留缓冲区并清空反查表
      */
-    QVector<QPoint> getAvailablePositions(const QVector<QPoint>& excludePositions) const;
+    void reserveScratch();
 };
 
 }  // namespace SnakeGame
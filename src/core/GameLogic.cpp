@@ -6,7 +6,10 @@
  */
 
 #include "GameLogic.h"
-#include <QDebug>
+#include <QMetaMethod>
+#include "EventLog.h"
+#include "ReplayWriter.h"
+#include "Trace.h"
 
 namespace SnakeGame {
 
@@ -14,16 +17,26 @@ GameLogic::GameLogic(int boardWidth, int boardHeight, QObject* parent)
     : QObject(parent)
     , snake_(std::make_unique<Snake>())
     , food_(std::make_unique<Food>(boardWidth, boardHeight))
+    , occupancy_(boardWidth, boardHeight)
+    , rewindCount_(0)
+    , observer_(nullptr)
+    , recorder_(nullptr)
     , gameTimer_(new QTimer(this))  // 使用 Qt 父子对象机制管理内存
+    , autoTick_(true)
     , state_(GameState::Ready)
+    , gameOverReason_(GameOverReason::None)
     , score_(0)
     , boardWidth_(boardWidth)
     , boardHeight_(boardHeight)
 {
+    // 蛇身最长填满棋盘，一次预留后每帧移动不再分配内存
+    snake_->reserve(boardWidth * boardHeight);
+
     // 连接定时器信号到游戏循环槽函数
     connect(gameTimer_, &QTimer::timeout, this, &GameLogic::onGameTick);
 
-    // 设置定时器间隔
+    // 设置定时器间隔，使用精确定时器保证节拍稳定
+    gameTimer_->setTimerType(Qt::PreciseTimer);
     gameTimer_->setInterval(Constants::kGameTickInterval);
 }
 
@@ -44,11 +57,13 @@ void GameLogic::startGame()
 
     if (state_ == GameState::Ready) {
         setState(GameState::Running);
-        gameTimer_->start();
+        if (autoTick_) {
+            gameTimer_->start();
+        }
 
         // 发送初始状态
         emit snakeMoved(snake_->getBody());
-        emit foodSpawned(food_->getPosition());
+        emit foodsChanged(food_->getPositions());
         emit scoreChanged(score_);
     }
 }
@@ -65,7 +80,9 @@ void GameLogic::resumeGame()
 {
     if (state_ == GameState::Paused) {
         setState(GameState::Running);
-        gameTimer_->start();
+        if (autoTick_) {
+            gameTimer_->start();
+        }
     }
 }
 
@@ -75,25 +92,137 @@ void GameLogic::resetGame()
     gameTimer_->stop();
 
     // 重置蛇
-    QPoint startPos(boardWidth_ / 2, boardHeight_ / 2);
-    snake_->reset(startPos, Constants::kInitialSnakeLength, Direction::Right);
+    snake_->reset(startPosition(), Constants::kInitialSnakeLength, Direction::Right);
+    // 新的一局从稀疏开始，空闲格列表等到棋盘接近填满时再由 Food 开启
+    occupancy_.setTrackFreeCells(false);
+    // 障碍物位图整块复制为底，再叠加蛇身
+    occupancy_.assign(level_ ? level_->obstacleWords() : nullptr, snake_->getBody());
+    if (distance_) {
+        distance_->reset(occupancy_, level_ && level_->wraps());
+    }
+    if (reachability_) {
+        reachability_->reset(level_ && level_->wraps());
+    }
 
     // 重置食物
     food_->reset(boardWidth_, boardHeight_);
     spawnFood();
+    rewind_.clear();
 
     // 重置分数
     score_ = 0;
+    gameOverReason_ = GameOverReason::None;
+
+    if (controller_) {
+        controller_->reset();
+    }
 
     // 重置状态
     setState(GameState::Ready);
 
+    if (recorder_) {
+        recorder_->writeKeyframe(*this);
+    }
+
     // 发送重置后的状态
     emit snakeMoved(snake_->getBody());
-    emit foodSpawned(food_->getPosition());
+    emit foodsChanged(food_->getPositions());
     emit scoreChanged(score_);
 }
 
+void GameLogic::step()
+{
+    onGameTick();
+}
+
+void GameLogic::setAutoTick(bool enabled)
+{
+    autoTick_ = enabled;
+    if (!autoTick_) {
+        gameTimer_->stop();
+    } else if (state_ == GameState::Running) {
+        gameTimer_->start();
+    }
+}
+
+void GameLogic::setRewindCapacity(int ticks)
+{
+    rewind_.setCapacity(ticks);
+}
+
+int GameLogic::getRewindDepth() const
+{
+    return rewind_.size();
+}
+
+int GameLogic::getRewindCount() const
+{
+    return rewindCount_;
+}
+
+int GameLogic::rewind(int ticks)
+{
+    if (state_ == GameState::Ready) {
+        return 0;
+    }
+
+    int undone = 0;
+    for (; undone < ticks && !rewind_.isEmpty(); ++undone) {
+        const RewindBuffer::Delta delta = rewind_.pop();
+
+        // 按与 onGameTick() 相反的顺序撤销：先去掉新食物，再放回被吃掉的食物
+        for (int i = 0; i < delta.spawned; ++i) {
+            food_->removeLast();
+        }
+        if (delta.grew) {
+            food_->restore(delta.eatenIndex, delta.head);
+            snake_->undoGrow();
+        } else {
+            snake_->undoMove(delta.tail);
+        }
+        score_ -= delta.scoreDelta;
+    }
+    if (undone == 0) {
+        return 0;
+    }
+    ++rewindCount_;
+
+    // 撞到自身的那一帧新蛇头与蛇身重叠，逐格撤销位图会误清蛇身，因此整体重建一次
+    occupancy_.assign(level_ ? level_->obstacleWords() : nullptr, snake_->getBody());
+    resyncAnalysis();
+
+    // 方向取蛇头到第二节的朝向（越界回绕时两节坐标相差整行）
+    const QVector<QPoint>& body = snake_->getBody();
+    if (body.size() >= 2) {
+        QPoint offset = body[0] - body[1];
+        if (qAbs(offset.x()) > 1) {
+            offset.setX(offset.x() > 0 ? -1 : 1);
+        }
+        if (qAbs(offset.y()) > 1) {
+            offset.setY(offset.y() > 0 ? -1 : 1);
+        }
+        snake_->restoreDirection(DirectionHelper::fromOffset(offset));
+    }
+
+    if (controller_) {
+        controller_->reset();
+    }
+
+    gameTimer_->stop();
+    gameOverReason_ = GameOverReason::None;
+    setState(GameState::Paused);
+
+    if (recorder_) {
+        recorder_->writeKeyframe(*this);
+    }
+
+    emit rewound(undone);
+    emit scoreChanged(score_);
+    emit foodsChanged(food_->getPositions());
+    emit snakeMoved(snake_->getBody());
+    return undone;
+}
+
 // ==================== 输入处理 ====================
 
 void GameLogic::setDirection(Direction direction)
@@ -103,6 +232,100 @@ void GameLogic::setDirection(Direction direction)
     }
 }
 
+void GameLogic::setController(std::unique_ptr<Controller> controller)
+{
+    controller_ = std::move(controller);
+}
+
+void GameLogic::setRandomGenerator(Food::RandomGenerator generator)
+{
+    food_->setRandomGenerator(std::move(generator));
+}
+
+void GameLogic::setFoodCount(int count)
+{
+    food_->setCount(count);
+}
+
+bool GameLogic::setLevel(std::shared_ptr<const Level> level)
+{
+    if (level) {
+        if (!level->isOpen() || level->getWidth() != boardWidth_ ||
+            level->getHeight() != boardHeight_) {
+            SNAKE_LOG_WARNING("GameLogic::setLevel() - level size does not match the board");
+            return false;
+        }
+        if (snake_->isCompact() && level->wraps()) {
+            SNAKE_LOG_WARNING("GameLogic::setLevel() - compact snake body does not support wrapping");
+            return false;
+        }
+        const QPoint head = startPosition();
+        for (int i = 0; i < Constants::kInitialSnakeLength; ++i) {
+            const QPoint segment = head - QPoint(i, 0);
+            if (!occupancy_.contains(segment) || level->isObstacle(segment)) {
+                SNAKE_LOG_WARNING("GameLogic::setLevel() - start position is blocked");
+                return false;
+            }
+        }
+    }
+    level_ = std::move(level);
+    return true;
+}
+
+void GameLogic::setObserver(GameObserver* observer)
+{
+    observer_ = observer;
+}
+
+void GameLogic::setRecorder(ReplayWriter* recorder)
+{
+    recorder_ = recorder;
+    if (recorder_ && state_ != GameState::Ready) {
+        // 中途开始录制时先记下当前局面作为起点
+        recorder_->writeKeyframe(*this);
+    }
+}
+
+void GameLogic::setDistanceFieldEnabled(bool enabled)
+{
+    if (!enabled) {
+        distance_.reset();
+        return;
+    }
+    if (!distance_) {
+        distance_ = std::make_unique<DistanceField>(boardWidth_, boardHeight_);
+        distance_->reset(occupancy_, level_ && level_->wraps());
+        distance_->rebuild(food_->getPositions());
+    }
+}
+
+bool GameLogic::setCompactBodyEnabled(bool enabled)
+{
+    if (enabled && level_ && level_->wraps()) {
+        SNAKE_LOG_WARNING("GameLogic::setCompactBodyEnabled() - wrapping levels are not supported");
+        return false;
+    }
+    snake_->setCompact(enabled);
+    return true;
+}
+
+bool GameLogic::isCompactBodyEnabled() const
+{
+    return snake_->isCompact();
+}
+
+void GameLogic::setReachabilityEnabled(bool enabled)
+{
+    if (!enabled) {
+        reachability_.reset();
+        return;
+    }
+    if (!reachability_) {
+        reachability_ = std::make_unique<Reachability>(occupancy_);
+        reachability_->reset(level_ && level_->wraps());
+    }
+}
+
 // ==================== 状态查询 ====================
 
 GameState GameLogic::getState() const
@@ -115,16 +338,51 @@ int GameLogic::getScore() const
     return score_;
 }
 
-QVector<QPoint> GameLogic::getSnakeBody() const
+const QVector<QPoint>& GameLogic::getSnakeBody() const
 {
     return snake_->getBody();
 }
 
+QPoint GameLogic::getSnakeHead() const
+{
+    return snake_->getHead();
+}
+
+QPoint GameLogic::getSnakeTail() const
+{
+    return snake_->getTail();
+}
+
+int GameLogic::getSnakeLength() const
+{
+    return snake_->getLength();
+}
+
+Direction GameLogic::getDirection() const
+{
+    return snake_->getDirection();
+}
+
 QPoint GameLogic::getFoodPosition() const
 {
     return food_->getPosition();
 }
 
+const QVector<QPoint>& GameLogic::getFoodPositions() const
+{
+    return food_->getPositions();
+}
+
+bool GameLogic::isFood(const QPoint& pos) const
+{
+    return food_->indexAt(pos) >= 0;
+}
+
+int GameLogic::getFoodCount() const
+{
+    return food_->getCount();
+}
+
 int GameLogic::getBoardWidth() const
 {
     return boardWidth_;
@@ -135,6 +393,41 @@ int GameLogic::getBoardHeight() const
     return boardHeight_;
 }
 
+bool GameLogic::isOccupied(const QPoint& pos) const
+{
+    return occupancy_.contains(pos) && occupancy_.test(pos);
+}
+
+bool GameLogic::isObstacle(const QPoint& pos) const
+{
+    return level_ && level_->isObstacle(pos);
+}
+
+const Level* GameLogic::getLevel() const
+{
+    return level_.get();
+}
+
+const OccupancyGrid& GameLogic::getOccupancy() const
+{
+    return occupancy_;
+}
+
+const DistanceField* GameLogic::getDistanceField() const
+{
+    return distance_.get();
+}
+
+const Reachability* GameLogic::getReachability() const
+{
+    return reachability_.get();
+}
+
+GameOverReason GameLogic::getGameOverReason() const
+{
+    return gameOverReason_;
+}
+
 // ==================== 私有槽函数 ====================
 
 void GameLogic::onGameTick()
@@ -142,6 +435,12 @@ void GameLogic::onGameTick()
     if (state_ != GameState::Running) {
         return;
     }
+    const TraceSpan span("GameLogic::onGameTick");
+
+    // 自动驾驶：由控制器决定本帧方向
+    if (controller_) {
+        snake_->setDirection(controller_->nextDirection(*this));
+    }
 
     // 获取蛇头当前位置
     QPoint currentHead = snake_->getHead();
@@ -150,39 +449,86 @@ void GameLogic::onGameTick()
     QPoint offset = DirectionHelper::toOffset(snake_->getDirection());
     QPoint nextHead = currentHead + offset;
 
-    // 检查墙壁碰撞
+    // 回绕关卡：越过边界从对侧出现
+    if (level_ && level_->wraps()) {
+        nextHead.setX((nextHead.x() + boardWidth_) % boardWidth_);
+        nextHead.setY((nextHead.y() + boardHeight_) % boardHeight_);
+    }
+
+    // 检查墙壁碰撞（含障碍物）
     if (checkWallCollision(nextHead)) {
-        handleGameOver();
+        handleGameOver(GameOverReason::WallCollision);
         return;
     }
 
-    // 检查自身碰撞（需要在移动后检查，但这里先预判）
-    // 注意：移动后蛇尾会消失，所以如果下一步是当前蛇尾位置，不算碰撞
-    // 为简化逻辑，先移动再检查
-    bool ateFood = checkFoodCollision(nextHead);
+    const int eatenFood = checkFoodCollision(nextHead);
+    const bool ateFood = eatenFood >= 0;
+
+    // 吃到食物时距离场在补足食物后整体重建，本帧无需修补
+    if (distance_ && ateFood) {
+        distance_->invalidate();
+    }
+
+    // 不吃食物时蛇尾在本帧让出位置，因此下一步走到当前蛇尾不算碰撞
+    if (!ateFood) {
+        const QPoint tail = snake_->getTail();
+        occupancy_.reset(tail);
+        if (distance_) {
+            distance_->unblock(tail);
+        }
+        if (reachability_) {
+            reachability_->unblock(tail);
+        }
+    }
+    const bool selfCollision = checkSelfCollision(nextHead);
+    occupancy_.set(nextHead);
+    if (distance_) {
+        distance_->block(nextHead);
+    }
+    if (reachability_) {
+        reachability_->block(nextHead);
+    }
 
+    RewindBuffer::Delta delta;
     if (ateFood) {
         // 吃到食物，蛇增长
-        snake_->grow();
+        snake_->grow(nextHead);
         
         // 增加分数
         score_ += Constants::kScorePerFood;
         emit scoreChanged(score_);
 
-        // 生成新食物
-        spawnFood();
+        // 移除被吃掉的食物并补足
+        food_->remove(eatenFood);
+        const int spawned = spawnFood();
+        delta = {nextHead, nextHead, Constants::kScorePerFood, eatenFood, spawned, true};
     } else {
         // 正常移动
-        snake_->move();
+        delta = {nextHead, snake_->getTail(), 0, -1, 0, false};
+        snake_->move(nextHead);
+    }
+    rewind_.push(delta);
+    if (recorder_) {
+        recorder_->writeTick(*this, delta);
+    }
+
+    if (observer_) {
+        observer_->onHeadMoved(snake_->getHead());
+    }
+
+    // 自身碰撞在移动前已经判定，这里统一在移动之后结束游戏
+    if (selfCollision) {
+        handleGameOver(GameOverReason::SelfCollision);
+        return;
     }
 
-    // 检查自身碰撞（移动后检查）
-    if (checkSelfCollision(snake_->getHead())) {
-        handleGameOver();
+    // 紧凑蛇身展开为坐标列表是 O(n)，没有接收方时不展开
+    if (snake_->isCompact() && !isSignalConnected(QMetaMethod::fromSignal(&GameLogic::snakeMoved))) {
         return;
     }
 
-    // 发送蛇移动信号
+    // 发送蛇移动信号（直连的渲染器槽函数都在这个片段内执行）
+    const TraceSpan fanOut("GameLogic::snakeMoved");
     emit snakeMoved(snake_->getBody());
 }
 
@@ -190,45 +536,79 @@ void GameLogic::onGameTick()
 
 bool GameLogic::checkWallCollision(const QPoint& head) const
 {
-    return head.x() < 0 || head.x() >= boardWidth_ ||
-           head.y() < 0 || head.y() >= boardHeight_;
+    if (head.x() < 0 || head.x() >= boardWidth_ ||
+        head.y() < 0 || head.y() >= boardHeight_) {
+        return true;
+    }
+    // 障碍物与边界墙同样结束游戏，但要先于占用位图判断，否则会被当成撞到自身
+    return level_ && level_->isObstacle(head);
 }
 
 bool GameLogic::checkSelfCollision(const QPoint& head) const
 {
-    const QVector<QPoint>& body = snake_->getBody();
-    
-    // 从索引 1 开始检查，跳过蛇头本身，轮询检查复杂度高，可优化
-    for (int i = 1; i < body.size(); ++i) {
-        if (head == body[i]) {
-            return true;
-        }
-    }
-    return false;
+    // 占用位图与蛇身同步，查询与蛇长无关
+    return occupancy_.test(head);
 }
 
-bool GameLogic::checkFoodCollision(const QPoint& head) const
+int GameLogic::checkFoodCollision(const QPoint& head) const
 {
-    return head == food_->getPosition();
+    // 按格反查，与食物数量无关
+    return food_->indexAt(head);
 }
 
-void GameLogic::handleGameOver()
+QPoint GameLogic::startPosition() const
 {
+    return QPoint(boardWidth_ / 2, boardHeight_ / 2);
+}
+
+void GameLogic::handleGameOver(GameOverReason reason)
+{
+    gameOverReason_ = reason;
+    if (observer_) {
+        observer_->onGameOver(snake_->getHead(), reason);
+    }
     gameTimer_->stop();
     setState(GameState::GameOver);
     emit gameOver(score_);
 }
 
-void GameLogic::spawnFood()
+int GameLogic::spawnFood()
 {
-    bool success = food_->respawn(snake_->getBody());
-    
-    if (success) {
-        emit foodSpawned(food_->getPosition());
-    } else {
+    const TraceSpan span("GameLogic::spawnFood");
+
+    const int spawned = food_->refill(occupancy_);
+    const QVector<QPoint>& foods = food_->getPositions();
+    if (distance_) {
+        distance_->rebuild(foods);
+    }
+
+    if (foods.isEmpty()) {
         // 没有可用位置，玩家获胜（蛇填满整个游戏区域）
-        qDebug() << "Player wins! Snake filled the entire board.";
-        handleGameOver();
+        SNAKE_LOG_INFO("Player wins! Snake filled the entire board (score %lld)", static_cast<qint64>(score_));
+        handleGameOver(GameOverReason::BoardFilled);
+        return 0;
+    }
+
+    // 新食物位于列表末尾
+    for (int i = foods.size() - spawned; i < foods.size(); ++i) {
+        if (observer_) {
+            observer_->onFoodSpawned(foods[i]);
+        }
+        emit foodSpawned(foods[i]);
+    }
+    emit foodsChanged(foods);
+    return spawned;
+}
+
+void GameLogic::resyncAnalysis()
+{
+    const bool wrap = level_ && level_->wraps();
+    if (distance_) {
+        distance_->reset(occupancy_, wrap);
+        distance_->rebuild(food_->getPositions());
+    }
+    if (reachability_) {
+        reachability_->reset(wrap);
     }
 }
 
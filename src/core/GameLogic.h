@@ -19,12 +19,22 @@
 
 #include "Snake.h"
 #include "Food.h"
+#include "Level.h"
+#include "DistanceField.h"
+#include "Reachability.h"
+#include "RewindBuffer.h"
+#include "Controller.h"
+#include "GameObserver.h"
+#include "OccupancyGrid.h"
 #include "Direction.h"
 #include "GameState.h"
+#include "GameOverReason.h"
 #include "Constants.h"
 
 namespace SnakeGame {
 
+class ReplayWriter;
+
 /**
  * @brief 游戏逻辑类 - 管理整个游戏流程
  * 
@@ -76,6 +86,49 @@ public:
      */
     void resetGame();
 
+    /**
+     * @brief 同步推进一帧（不经过定时器）
+     *
+     * 用于无界面批量运行或测试，游戏需处于运行状态。
+     */
+    void step();
+
+    /**
+     * @brief 设置是否由内部定时器自动推进
+     * @param enabled false 时开始/恢复游戏不启动定时器，由调用方通过 step() 驱动
+     */
+    void setAutoTick(bool enabled);
+
+    /**
+     * @brief 设置回退缓冲区容量
+     * @param ticks 最多可回退的帧数，0 表示不记录（默认）
+     *
+     * 每帧只记录一条固定大小的增量，内存与蛇长无关。设置时清空已记录的帧。
+     */
+    void setRewindCapacity(int ticks);
+
+    /**
+     * @brief 当前可回退的帧数
+     */
+    int getRewindDepth() const;
+
+    /**
+     * @brief 累计回退次数（每次成功的 rewind() 加一，重开不清零）
+     *
+     * 只看快照的消费者（模拟线程的状态帧、观测张量）据此发现蛇身不再连续。
+     */
+    int getRewindCount() const;
+
+    /**
+     * @brief 逆序撤销最近的若干帧
+     * @param ticks 要回退的帧数
+     * @return 实际回退的帧数（受已记录帧数限制）
+     *
+     * 回退后游戏进入暂停状态（包括已结束的对局），由 resumeGame() 继续，并发出 rewound()。
+     * 被撤销的帧不可重做；继续游戏后新食物的位置与原来不同。
+     */
+    int rewind(int ticks);
+
     // ==================== 输入处理 ====================
 
     /**
@@ -84,6 +137,86 @@ public:
      */
     void setDirection(Direction direction);
 
+    /**
+     * @brief 设置自动驾驶控制器
+     * @param controller 控制器，传入空指针恢复玩家操作
+     */
+    void setController(std::unique_ptr<Controller> controller);
+
+    /**
+     * @brief 设置食物位置使用的随机数生成器
+     * @param generator 随机数生成器，返回 [min, max] 内的整数
+     *
+     * 批量模拟时每个工作线程使用独立的带种子生成器，
+     * 避免争用全局生成器并使结果可复现。
+     */
+    void setRandomGenerator(Food::RandomGenerator generator);
+
+    /**
+     * @brief 设置同时存在的食物数量
+     * @param count 食物数量 K（至少为 1）
+     *
+     * 下一次生成食物时生效（新的一局或吃到食物之后）。
+     */
+    void setFoodCount(int count);
+
+    /**
+     * @brief 设置关卡（静态障碍物与边界规则）
+     * @param level 关卡，传入空指针恢复空白棋盘
+     * @return false 表示尺寸与棋盘不符或开局位置被障碍物占据，关卡未生效
+     *
+     * 关卡只读，可由多个 GameLogic 共享。下一次开局（resetGame/startGame）时生效。
+     */
+    bool setLevel(std::shared_ptr<const Level> level);
+
+    /**
+     * @brief 设置事件观察者（不转移所有权）
+     * @param observer 观察者，传入空指针取消观察
+     *
+     * 未设置观察者时每帧只多一次空指针判断。
+     */
+    void setObserver(GameObserver* observer);
+
+    /**
+     * @brief 设置录像写入器（不转移所有权）
+     * @param recorder 已打开的写入器，传入空指针停止录制
+     *
+     * 开局和回退后写入关键帧，每帧写入一条增量。
+     */
+    void setRecorder(ReplayWriter* recorder);
+
+    /**
+     * @brief 开启或关闭到食物的距离场
+     * @param enabled true 开启
+     *
+     * 开启后每帧随蛇头蛇尾局部修补，食物变化时整体重建；开启时立即按当前局面建好。
+     * 关闭时不占用内存，也没有任何每帧开销。
+     */
+    void setDistanceFieldEnabled(bool enabled);
+
+    /**
+     * @brief 切换紧凑蛇身存储（每节 2 位方向码，见 CompactBody）
+     * @param enabled true 开启
+     * @return false 表示当前关卡边界回绕，紧凑存储不支持，设置未生效
+     *
+     * 开启后移动为 O(1)，蛇身只在 getSnakeBody() 或 snakeMoved 有接收方时才展开，
+     * 适合超大棋盘上的无界面对局。控制器应优先使用 getSnakeHead/Tail/Length。
+     */
+    bool setCompactBodyEnabled(bool enabled);
+
+    /**
+     * @brief 是否使用紧凑蛇身存储
+     */
+    bool isCompactBodyEnabled() const;
+
+    /**
+     * @brief 开启或关闭可达区域查询
+     * @param enabled true 开启
+     *
+     * 开启后每帧随蛇头蛇尾增量维护空闲格的连通分量，关闭时没有任何开销。
+     */
+    void setReachabilityEnabled(bool enabled);
+
     // ==================== 状态查询 ====================
 
     /**
@@ -102,14 +235,57 @@ public:
      * @brief 获取蛇身坐标
      * @return 蛇身坐标列表
      */
-    QVector<QPoint> getSnakeBody() const;
+    const QVector<QPoint>& getSnakeBody() const;
+
+    /**
+     * @brief 获取蛇头位置（紧凑存储下不展开蛇身）
+     * @return 蛇头坐标
+     */
+    QPoint getSnakeHead() const;
+
+    /**
+     * @brief 获取蛇尾位置（紧凑存储下不展开蛇身）
+     * @return 蛇尾坐标
+     */
+    QPoint getSnakeTail() const;
+
+    /**
+     * @brief 获取蛇长（紧凑存储下不展开蛇身）
+     * @return 蛇身节数
+     */
+    int getSnakeLength() const;
+
+    /**
+     * @brief 获取蛇当前移动方向
+     * @return 移动方向
+     */
+    Direction getDirection() const;
 
     /**
      * @brief 获取食物位置
-     * @return 食物坐标
+     * @return 第一个食物的坐标，没有食物时为 (-1, -1)
      */
     QPoint getFoodPosition() const;
 
+    /**
+     * @brief 获取全部食物位置
+     * @return 食物坐标列表
+     */
+    const QVector<QPoint>& getFoodPositions() const;
+
+    /**
+     * @brief 检查格子上是否有食物（O(1)）
+     * @param pos 格子坐标，棋盘外返回 false
+     * @return true 表示有食物
+     */
+    bool isFood(const QPoint& pos) const;
+
+    /**
+     * @brief 获取同时存在的食物数量
+     * @return 食物数量 K
+     */
+    int getFoodCount() const;
+
     /**
      * @brief 获取游戏区域宽度
      * @return 宽度（格数）
@@ -122,6 +298,50 @@ public:
      */
     int getBoardHeight() const;
 
+    /**
+     * @brief 检查格子是否被蛇身或障碍物占据（O(1)）
+     * @param pos 格子坐标，棋盘外返回 false
+     * @return true 表示被占据
+     */
+    bool isOccupied(const QPoint& pos) const;
+
+    /**
+     * @brief 检查格子是否为关卡障碍物（O(1)）
+     * @param pos 格子坐标，棋盘外返回 false
+     * @return true 表示障碍物
+     */
+    bool isObstacle(const QPoint& pos) const;
+
+    /**
+     * @brief 获取当前关卡
+     * @return 关卡，空白棋盘时为空指针
+     */
+    const Level* getLevel() const;
+
+    /**
+     * @brief 获取棋盘占用位图（障碍物为底，与蛇身同步维护）
+     * @return 占用位图
+     */
+    const OccupancyGrid& getOccupancy() const;
+
+    /**
+     * @brief 获取到最近食物的距离场（只读，供控制器与观测导出使用）
+     * @return 距离场，未开启时为空指针
+     */
+    const DistanceField* getDistanceField() const;
+
+    /**
+     * @brief 获取可达区域查询（"从某格能走到多少空闲格""蛇头能否走到蛇尾"）
+     * @return 查询对象，未开启时为空指针
+     */
+    const Reachability* getReachability() const;
+
+    /**
+     * @brief 获取上一局的结束原因
+     * @return 结束原因，游戏未结束时为 None
+     */
+    GameOverReason getGameOverReason() const;
+
 signals:
     // ==================== 信号（后端 → 前端） ====================
 
@@ -137,6 +357,15 @@ signals:
      */
     void foodSpawned(const QPoint& position);
 
+    /**
+     * @brief 食物集合变化后发出（每帧至多一次）
+     * @param positions 全部食物位置
+     *
+     * 同时存在多个食物时，界面连接该信号一次性重绘食物层，
+     * 无需逐个处理 foodSpawned。
+     */
+    void foodsChanged(const QVector<QPoint>& positions);
+
     /**
      * @brief 分数变化后发出
      * @param score 新分数
@@ -155,6 +384,14 @@ signals:
      */
     void gameOver(int finalScore);
 
+    /**
+     * @brief 回退后发出（在随后的 foodsChanged 与 snakeMoved 之前）
+     * @param ticks 实际回退的帧数
+     *
+     * 回退后的蛇身与上一帧无关，增量渲染器据此整帧重绘。
+     */
+    void rewound(int ticks);
+
 private slots:
     /**
      * @brief 游戏主循环回调
@@ -166,9 +403,20 @@ private:
 
     std::unique_ptr<Snake> snake_;      ///< 蛇对象
     std::unique_ptr<Food> food_;        ///< 食物对象
+    std::unique_ptr<Controller> controller_;    ///< 自动驾驶控制器（可为空）
+    std::shared_ptr<const Level> level_;        ///< 关卡（可为空，多个对局共享）
+    OccupancyGrid occupancy_;           ///< 障碍物与蛇身占用位图
+    std::unique_ptr<DistanceField> distance_;   ///< 到食物的距离场（未开启时为空）
+    std::unique_ptr<Reachability> reachability_;    ///< 空闲格连通分量（未开启时为空）
+    RewindBuffer rewind_;               ///< 最近若干帧的增量（容量为 0 时不记录）
+    int rewindCount_;                   ///< 累计回退次数
+    GameObserver* observer_;            ///< 事件观察者（不持有，可为空）
+    ReplayWriter* recorder_;            ///< 录像写入器（不持有，可为空）
     QTimer* gameTimer_;                 ///< 游戏循环定时器
+    bool autoTick_;                     ///< 是否由定时器自动推进
 
     GameState state_;                   ///< 当前游戏状态
+    GameOverReason gameOverReason_;     ///< 游戏结束原因
     int score_;                         ///< 当前分数
     int boardWidth_;                    ///< 游戏区域宽度
     int boardHeight_;                   ///< 游戏区域高度
@@ -176,7 +424,7 @@ private:
     // ==================== 内部方法 ====================
 
     /**
-     * @brief 检查蛇头是否撞墙
+     * @brief 检查蛇头是否撞墙（越出不回绕的边界或撞上障碍物）
      * @param head 蛇头坐标
      * @return true 表示撞墙
      */
@@ -184,7 +432,7 @@ private:
 
     /**
      * @brief 检查蛇头是否撞到自身
-     * @param head 蛇头坐标
+     * @param head 新蛇头坐标（须在蛇尾让出位置之后、标记新蛇头之前调用）
      * @return true 表示撞到自身
      */
     bool checkSelfCollision(const QPoint& head) const;
@@ -192,19 +440,32 @@ private:
     /**
      * @brief 检查蛇头是否吃到食物
      * @param head 蛇头坐标
-     * @return true 表示吃到食物
+     * @return 吃到的食物下标，没有吃到时为 -1
      */
-    bool checkFoodCollision(const QPoint& head) const;
+    int checkFoodCollision(const QPoint& head) const;
+
+    /**
+     * @brief 初始蛇头位置（棋盘中央，蛇身向左延伸，向右移动）
+     * @return 蛇头坐标
+     */
+    QPoint startPosition() const;
 
     /**
      * @brief 处理游戏结束
+     * @param reason 结束原因
+     */
+    void handleGameOver(GameOverReason reason);
+
+    /**
+     * @brief 补足食物，没有空位且食物吃完时判定玩家获胜
+     * @return 新生成的食物数
      */
-    void handleGameOver();
+    int spawnFood();
 
     /**
-     * @brief 生成新食物
+     * @brief 占用位图或食物被整体改写后，重新同步距离场和可达区域
      */
-    void spawnFood();
+    void resyncAnalysis();
 
     /**
      * @brief 设置游戏状态并发出信号
@@ -0,0 +1,53 @@
+/**
+ * @file GameObserver.h
+ * @brief 游戏事件观察者接口 - 供统计分析使用的轻量回调
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef GAMEOBSERVER_H
+#define GAMEOBSERVER_H
+
+#include <QPoint>
+#include "GameOverReason.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 游戏事件观察者接口
+ *
+ * 与 Qt 信号不同，观察者由 GameLogic 直接虚函数调用，
+ * 不经过元对象系统，也不复制参数，适合每帧都要更新的统计。
+ * 回调在 GameLogic 所在线程执行，实现方不应阻塞。
+ */
+class GameObserver {
+public:
+    virtual ~GameObserver() = default;
+
+    /**
+     * @brief 蛇头移动到新格子后调用（每帧一次）
+     * @param head 新蛇头坐标
+     */
+    virtual void onHeadMoved(const QPoint& head) { Q_UNUSED(head); }
+
+    /**
+     * @brief 食物生成后调用
+     * @param position 食物坐标
+     */
+    virtual void onFoodSpawned(const QPoint& position) { Q_UNUSED(position); }
+
+    /**
+     * @brief 游戏结束时调用
+     * @param cell 结束时蛇头所在格子（撞墙时为撞墙前的格子）
+     * @param reason 结束原因
+     */
+    virtual void onGameOver(const QPoint& cell, GameOverReason reason)
+    {
+        Q_UNUSED(cell);
+        Q_UNUSED(reason);
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // GAMEOBSERVER_H
@@ -0,0 +1,92 @@
+/**
+ * @file GameSnapshot.h
+ * @brief 游戏状态快照 - 供渲染线程使用的不可变数据
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef GAMESNAPSHOT_H
+#define GAMESNAPSHOT_H
+
+#include <QPoint>
+#include <QVector>
+#include <algorithm>
+#include <vector>
+#include "GameState.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 某一时刻的完整游戏画面数据
+ *
+ * 按值传递；QVector 隐式共享，复制快照不会复制蛇身数据。
+ */
+struct GameSnapshot {
+    QVector<QPoint> body;               ///< 蛇身坐标（body[0] 为蛇头）
+    QVector<QPoint> foods;              ///< 食物位置（可同时存在多个）
+    GameState state = GameState::Ready; ///< 游戏状态
+    int score = 0;                      ///< 当前分数
+    int rewinds = 0;                    ///< 累计回退次数（变化说明蛇身与上一快照不连续）
+};
+
+/**
+ * @brief 固定容量的状态帧 - 经 TripleBuffer 在模拟线程与渲染之间交换
+ *
+ * 蛇身与食物存储按棋盘格数预先分配，写入时只复制坐标，不分配内存，
+ * 也不与其他容器隐式共享。
+ */
+struct StateFrame {
+    std::vector<QPoint> body;           ///< 蛇身坐标，容量固定为棋盘格数
+    int length = 0;                     ///< 有效蛇身节数
+    std::vector<QPoint> foods;          ///< 食物位置，容量固定为棋盘格数
+    int foodCount = 0;                  ///< 有效食物数
+    GameState state = GameState::Ready; ///< 游戏状态
+    int score = 0;                      ///< 当前分数
+    int rewinds = 0;                    ///< 累计回退次数
+
+    /**
+     * @brief 构造函数
+     * @param capacity 蛇身最大节数（棋盘格数）
+     */
+    explicit StateFrame(int capacity = 0)
+        : body(static_cast<size_t>(capacity))
+        , foods(static_cast<size_t>(capacity))
+    {
+    }
+
+    /**
+     * @brief 写入蛇身（超出容量部分截断）
+     * @param source 蛇身坐标
+     */
+    void setBody(const QVector<QPoint>& source) {
+        length = std::min<int>(static_cast<int>(source.size()), static_cast<int>(body.size()));
+        std::copy(source.constData(), source.constData() + length, body.begin());
+    }
+
+    /**
+     * @brief 写入食物位置（超出容量部分截断）
+     * @param source 食物坐标
+     */
+    void setFoods(const QVector<QPoint>& source) {
+        foodCount = std::min<int>(static_cast<int>(source.size()), static_cast<int>(foods.size()));
+        std::copy(source.constData(), source.constData() + foodCount, foods.begin());
+    }
+
+    /**
+     * @brief 转换为快照（消费者侧复制）
+     * @param snapshot 输出快照，复用其已有容量
+     */
+    void copyTo(GameSnapshot* snapshot) const {
+        snapshot->body.resize(length);
+        std::copy(body.begin(), body.begin() + length, snapshot->body.data());
+        snapshot->foods.resize(foodCount);
+        std::copy(foods.begin(), foods.begin() + foodCount, snapshot->foods.data());
+        snapshot->state = state;
+        snapshot->score = score;
+        snapshot->rewinds = rewinds;
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // GAMESNAPSHOT_H
@@ -0,0 +1,71 @@
+/**
+ * @file GreedyController.cpp
+ * @brief 贪心控制器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "GreedyController.h"
+#include "GameLogic.h"
+#include <algorithm>
+#include <climits>
+
+namespace SnakeGame {
+
+namespace {
+
+constexpr Direction kAllDirections[] = {
+    Direction::Up, Direction::Down, Direction::Left, Direction::Right
+};
+
+}  // namespace
+
+Direction GreedyController::nextDirection(const GameLogic& game)
+{
+    const QPoint head = game.getSnakeHead();
+    const QPoint tail = game.getSnakeTail();
+    const QVector<QPoint>& foods = game.getFoodPositions();
+    const Direction current = game.getDirection();
+    const DistanceField* field = game.getDistanceField();
+    const int cells = game.getBoardWidth() * game.getBoardHeight();
+
+    Direction best = current;
+    int bestDistance = INT_MAX;
+
+    for (Direction dir : kAllDirections) {
+        if (DirectionHelper::isOpposite(current, dir)) {
+            continue;
+        }
+
+        QPoint next = head + DirectionHelper::toOffset(dir);
+        if (next.x() < 0 || next.x() >= game.getBoardWidth() ||
+            next.y() < 0 || next.y() >= game.getBoardHeight()) {
+            continue;
+        }
+        // 不吃食物时蛇尾会让出位置
+        if (game.isOccupied(next) && (next != tail || game.isFood(next))) {
+            continue;
+        }
+
+        // 多个食物时朝最近的一个前进
+        int distance = INT_MAX;
+        if (field && field->distance(next) != DistanceField::kUnreachable) {
+            distance = field->distance(next);
+        } else {
+            for (const QPoint& food : foods) {
+                distance = std::min(distance, (next - food).manhattanLength());
+            }
+            if (field && distance != INT_MAX) {
+                distance += cells;
+            }
+        }
+        if (distance < bestDistance) {
+            best = dir;
+            bestDistance = distance;
+        }
+    }
+
+    return best;
+}
+
+}  // namespace SnakeGame
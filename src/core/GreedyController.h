@@ -0,0 +1,31 @@
+/**
+ * @file GreedyController.h
+ * @brief 贪心控制器 - 朝食物方向前进并避开必死的格子
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef GREEDYCONTROLLER_H
+#define GREEDYCONTROLLER_H
+
+#include "Controller.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 贪心控制器
+ *
+ * 每帧在不会立即撞墙或撞到自身的方向中，
+ * 选择到食物曼哈顿距离最小的一个；都不安全时保持当前方向。
+ * GameLogic 开启了距离场时改用绕开蛇身与障碍物的实际步数，
+ * 走不到任何食物的格子排在所有可达格子之后。
+ * 不做前瞻，容易把自己困死，适合作为批量模拟的对照组。
+ */
+class GreedyController : public Controller {
+public:
+    Direction nextDirection(const GameLogic& game) override;
+};
+
+}  // namespace SnakeGame
+
+#endif  // GREEDYCONTROLLER_H
@@ -0,0 +1,185 @@
+/**
+ * @file HamiltonController.cpp
+ * @brief 哈密顿回路自动驾驶控制器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "HamiltonController.h"
+#include "GameLogic.h"
+#include <algorithm>
+
+namespace SnakeGame {
+
+namespace {
+
+constexpr Direction kAllDirections[] = {
+    Direction::Up, Direction::Down, Direction::Left, Direction::Right
+};
+
+/** @brief 走捷径时为生长保留的最小间距 */
+constexpr int kGrowthMargin = 3;
+
+/**
+ * @brief 相邻两格之间的方向
+ */
+Direction directionTo(const QPoint& from, const QPoint& to)
+{
+    QPoint delta = to - from;
+    if (delta.y() < 0) return Direction::Up;
+    if (delta.y() > 0) return Direction::Down;
+    if (delta.x() < 0) return Direction::Left;
+    return Direction::Right;
+}
+
+bool isInside(const QPoint& pos, int boardWidth, int boardHeight)
+{
+    return pos.x() >= 0 && pos.x() < boardWidth && pos.y() >= 0 && pos.y() < boardHeight;
+}
+
+}  // namespace
+
+HamiltonController::HamiltonController()
+    : ordered_(false)
+{
+}
+
+Direction HamiltonController::nextDirection(const GameLogic& game)
+{
+    if (!cycle_ || cycle_->getBoardWidth() != game.getBoardWidth() ||
+        cycle_->getBoardHeight() != game.getBoardHeight()) {
+        cycle_ = HamiltonCycle::forBoard(game.getBoardWidth(), game.getBoardHeight());
+        ordered_ = false;
+    }
+
+    if (!cycle_) {
+        // 面积为奇数的棋盘不存在哈密顿回路
+        return game.getDirection();
+    }
+
+    // 障碍物会截断回路，捷径的"前方到蛇尾均为空"不再成立，只走带避让的回退策略
+    const Level* level = game.getLevel();
+    if (level && level->getObstacleCount() > 0) {
+        return chooseFallback(game);
+    }
+
+    // 对齐后只要始终在空区内前进，顺序就不会被破坏，无需逐帧检查
+    if (!ordered_) {
+        ordered_ = isOrdered(game.getSnakeBody());
+    }
+
+    return ordered_ ? chooseShortcut(game) : chooseFallback(game);
+}
+
+void HamiltonController::reset()
+{
+    ordered_ = false;
+}
+
+bool HamiltonController::isOrdered(const QVector<QPoint>& body) const
+{
+    const int tailIndex = cycle_->indexOf(body.last());
+    int previous = cycle_->size();
+
+    for (const QPoint& segment : body) {
+        int d = cycle_->distance(tailIndex, cycle_->indexOf(segment));
+        if (d >= previous) {
+            return false;
+        }
+        previous = d;
+    }
+    return true;
+}
+
+Direction HamiltonController::chooseShortcut(const GameLogic& game) const
+{
+    const QPoint head = game.getSnakeHead();
+    const int headIndex = cycle_->indexOf(head);
+    const int cellCount = cycle_->size();
+    const int length = game.getSnakeLength();
+
+    // 蛇头前方到蛇尾之间的格子均为空
+    const int distToTail = cycle_->distance(headIndex, cycle_->indexOf(game.getSnakeTail()));
+
+    // 多个食物时以沿回路最近的一个为目标
+    int distToFood = cellCount;
+    for (const QPoint& food : game.getFoodPositions()) {
+        distToFood = std::min(distToFood, cycle_->distance(headIndex, cycle_->indexOf(food)));
+    }
+
+    int cutAvailable = distToTail - kGrowthMargin;
+    const int emptyCells = cellCount - length;
+    if (emptyCells < cellCount / 2) {
+        // 占用过半后严格沿回路前进
+        cutAvailable = 1;
+    } else if (distToFood < distToTail) {
+        cutAvailable -= 1;
+        if ((distToTail - distToFood) * 4 > emptyCells) {
+            cutAvailable -= 10;
+        }
+    }
+    cutAvailable = std::min(cutAvailable, distToFood);
+
+    // 默认走回路后继格
+    const QPoint successor = cycle_->at((headIndex + 1) % cellCount);
+    Direction best = directionTo(head, successor);
+    int bestDist = 1;
+
+    for (Direction dir : kAllDirections) {
+        QPoint next = head + DirectionHelper::toOffset(dir);
+        if (!isInside(next, game.getBoardWidth(), game.getBoardHeight())) {
+            continue;
+        }
+        int d = cycle_->distance(headIndex, cycle_->indexOf(next));
+        if (d > bestDist && d <= cutAvailable && d < distToTail) {
+            best = dir;
+            bestDist = d;
+        }
+    }
+
+    return best;
+}
+
+Direction HamiltonController::chooseFallback(const GameLogic& game) const
+{
+    const QPoint head = game.getSnakeHead();
+    const QPoint tail = game.getSnakeTail();
+    const int headIndex = cycle_->indexOf(head);
+    const int cellCount = cycle_->size();
+
+    const QPoint successor = cycle_->at((headIndex + 1) % cellCount);
+    const QPoint predecessor = cycle_->at((headIndex + cellCount - 1) % cellCount);
+
+    auto isFree = [&](const QPoint& pos) {
+        if (!isInside(pos, game.getBoardWidth(), game.getBoardHeight())) {
+            return false;
+        }
+        // 不吃食物时蛇尾会让出位置
+        return !game.isOccupied(pos) || (pos == tail && !game.isFood(pos));
+    };
+
+    if (isFree(successor)) {
+        return directionTo(head, successor);
+    }
+
+    // 避免走到回路前驱格，否则下一帧的后继又是当前蛇头
+    bool hasFree = false;
+    Direction anyFree = game.getDirection();
+    for (Direction dir : kAllDirections) {
+        QPoint next = head + DirectionHelper::toOffset(dir);
+        if (!isFree(next)) {
+            continue;
+        }
+        if (next != predecessor) {
+            return dir;
+        }
+        if (!hasFree) {
+            hasFree = true;
+            anyFree = dir;
+        }
+    }
+
+    return anyFree;
+}
+
+}  // namespace SnakeGame
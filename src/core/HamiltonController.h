@@ -0,0 +1,60 @@
+/**
+ * @file HamiltonController.h
+ * @brief 哈密顿回路自动驾驶控制器（带安全捷径）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef HAMILTONCONTROLLER_H
+#define HAMILTONCONTROLLER_H
+
+#include <QPoint>
+#include <memory>
+
+#include "Controller.h"
+#include "HamiltonCycle.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 哈密顿回路自动驾驶控制器
+ *
+ * 蛇身沿回路顺序排列时（蛇尾 → 蛇头的回路序号单调递增），
+ * 蛇头前方直到蛇尾之间的格子必然为空。控制器在这段空区内
+ * 向食物方向跳跃前进，并为生长保留余量；棋盘占用过半后
+ * 不再走捷径，严格沿回路前进，从而保证能够填满棋盘。
+ *
+ * 开局蛇身未必与回路对齐，此时优先走回路后继格，
+ * 对齐后每帧决策为 O(1)。关卡带障碍物时始终使用回退策略，不再保证填满棋盘。
+ */
+class HamiltonController : public Controller {
+public:
+    HamiltonController();
+
+    Direction nextDirection(const GameLogic& game) override;
+
+    void reset() override;
+
+private:
+    std::shared_ptr<const HamiltonCycle> cycle_;    ///< 当前棋盘的回路
+    bool ordered_;                                  ///< 蛇身是否已按回路顺序排列
+
+    /**
+     * @brief 检查蛇身是否按回路顺序排列
+     */
+    bool isOrdered(const QVector<QPoint>& body) const;
+
+    /**
+     * @brief 蛇身已对齐时的捷径决策
+     */
+    Direction chooseShortcut(const GameLogic& game) const;
+
+    /**
+     * @brief 蛇身未对齐时的回退决策
+     */
+    Direction chooseFallback(const GameLogic& game) const;
+};
+
+}  // namespace SnakeGame
+
+#endif  // HAMILTONCONTROLLER_H
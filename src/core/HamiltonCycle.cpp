@@ -0,0 +1,83 @@
+/**
+ * @file HamiltonCycle.cpp
+ * @brief 哈密顿回路生成与缓存实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "HamiltonCycle.h"
+#include <QMutex>
+#include <QMutexLocker>
+#include <map>
+#include <utility>
+
+namespace SnakeGame {
+
+std::shared_ptr<const HamiltonCycle> HamiltonCycle::forBoard(int boardWidth, int boardHeight)
+{
+    if (!isSupported(boardWidth, boardHeight)) {
+        return nullptr;
+    }
+
+    static QMutex mutex;
+    static std::map<std::pair<int, int>, std::shared_ptr<const HamiltonCycle>> cache;
+
+    QMutexLocker locker(&mutex);
+    std::shared_ptr<const HamiltonCycle>& cycle = cache[std::make_pair(boardWidth, boardHeight)];
+    if (!cycle) {
+        cycle = std::make_shared<const HamiltonCycle>(boardWidth, boardHeight);
+    }
+    return cycle;
+}
+
+bool HamiltonCycle::isSupported(int boardWidth, int boardHeight)
+{
+    return boardWidth >= 2 && boardHeight >= 2 &&
+           (boardWidth % 2 == 0 || boardHeight % 2 == 0);
+}
+
+HamiltonCycle::HamiltonCycle(int boardWidth, int boardHeight)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+{
+    if (!isSupported(boardWidth, boardHeight)) {
+        return;
+    }
+
+    // 行数为偶数时直接按行构造，否则转置后构造（此时列数必为偶数）
+    const bool transposed = boardHeight % 2 != 0;
+    const int cols = transposed ? boardHeight : boardWidth;
+    const int rows = transposed ? boardWidth : boardHeight;
+
+    order_.reserve(boardWidth * boardHeight);
+    auto append = [&](int c, int r) {
+        int x = transposed ? r : c;
+        int y = transposed ? c : r;
+        order_.append(y * boardWidth_ + x);
+    };
+
+    // 第 1 列及之后的列按行蛇形往返，最后一行（奇数行）止于第 1 列
+    for (int r = 0; r < rows; ++r) {
+        if (r % 2 == 0) {
+            for (int c = 1; c < cols; ++c) {
+                append(c, r);
+            }
+        } else {
+            for (int c = cols - 1; c >= 1; --c) {
+                append(c, r);
+            }
+        }
+    }
+
+    // 沿第 0 列返回起点
+    for (int r = rows - 1; r >= 0; --r) {
+        append(0, r);
+    }
+
+    indexOf_.resize(order_.size());
+    for (int i = 0; i < order_.size(); ++i) {
+        indexOf_[order_[i]] = i;
+    }
+}
+
+}  // namespace SnakeGame
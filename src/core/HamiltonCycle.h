@@ -0,0 +1,106 @@
+/**
+ * @file HamiltonCycle.h
+ * @brief 哈密顿回路生成与缓存
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef HAMILTONCYCLE_H
+#define HAMILTONCYCLE_H
+
+#include <QPoint>
+#include <QVector>
+#include <memory>
+
+namespace SnakeGame {
+
+/**
+ * @brief 覆盖整个棋盘的哈密顿回路
+ *
+ * 回路在面积为偶数（宽或高为偶数）且宽高均不小于 2 的棋盘上一定存在。
+ * 构造方式：第 0 列作为回程通道，其余列按行蛇形往返；
+ * 行数为奇数时转置构造。同一尺寸的回路在进程内只生成一次。
+ */
+class HamiltonCycle {
+public:
+    /**
+     * @brief 获取指定尺寸的回路（带缓存，线程安全）
+     * @param boardWidth 游戏区域宽度
+     * @param boardHeight 游戏区域高度
+     * @return 回路，棋盘不支持时返回空指针
+     */
+    static std::shared_ptr<const HamiltonCycle> forBoard(int boardWidth, int boardHeight);
+
+    /**
+     * @brief 检查棋盘是否存在哈密顿回路
+     * @param boardWidth 游戏区域宽度
+     * @param boardHeight 游戏区域高度
+     * @return true 表示存在
+     */
+    static bool isSupported(int boardWidth, int boardHeight);
+
+    /**
+     * @brief 构造函数（直接生成，不经过缓存）
+     * @param boardWidth 游戏区域宽度
+     * @param boardHeight 游戏区域高度
+     */
+    HamiltonCycle(int boardWidth, int boardHeight);
+
+    /**
+     * @brief 获取格子在回路中的序号
+     * @param pos 格子坐标（必须在棋盘内）
+     * @return 序号 [0, size)
+     */
+    int indexOf(const QPoint& pos) const {
+        return indexOf_[pos.y() * boardWidth_ + pos.x()];
+    }
+
+    /**
+     * @brief 获取回路中指定序号的格子
+     * @param index 序号
+     * @return 格子坐标
+     */
+    QPoint at(int index) const {
+        int cell = order_[index];
+        return QPoint(cell % boardWidth_, cell / boardWidth_);
+    }
+
+    /**
+     * @brief 沿回路从 from 前进到 to 需要的步数
+     * @param from 起点序号
+     * @param to 终点序号
+     * @return 步数 [0, size)
+     */
+    int distance(int from, int to) const {
+        int d = to - from;
+        return d < 0 ? d + size() : d;
+    }
+
+    /**
+     * @brief 获取回路长度（即棋盘格数）
+     * @return 格数
+     */
+    int size() const { return order_.size(); }
+
+    /**
+     * @brief 获取棋盘宽度
+     * @return 宽度（格数）
+     */
+    int getBoardWidth() const { return boardWidth_; }
+
+    /**
+     * @brief 获取棋盘高度
+     * @return 高度（格数）
+     */
+    int getBoardHeight() const { return boardHeight_; }
+
+private:
+    int boardWidth_;            ///< 棋盘宽度
+    int boardHeight_;           ///< 棋盘高度
+    QVector<int> order_;        ///< 序号 → 格索引
+    QVector<int> indexOf_;      ///< 格索引 → 序号
+};
+
+}  // namespace SnakeGame
+
+#endif  // HAMILTONCYCLE_H
@@ -0,0 +1,165 @@
+/**
+ * @file Level.cpp
+ * @brief 关卡实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "Level.h"
+#include <QtAlgorithms>
+#include <QtEndian>
+#include <vector>
+
+namespace SnakeGame {
+
+namespace {
+
+/** @brief 位图所需的 64 位字数 */
+qint64 wordCountFor(qint64 cells)
+{
+    return (cells + 63) / 64;
+}
+
+}  // namespace
+
+Level::Level()
+    : words_(nullptr)
+    , width_(0)
+    , height_(0)
+    , wrap_(false)
+    , obstacleCount_(0)
+{
+}
+
+Level::~Level()
+{
+    close();
+}
+
+bool Level::open(const QString& path)
+{
+    close();
+
+    file_.setFileName(path);
+    if (!file_.open(QIODevice::ReadOnly) || file_.size() < kHeaderSize) {
+        close();
+        return false;
+    }
+
+    const uchar* data = file_.map(0, file_.size());
+    if (!data || qFromLittleEndian<quint32>(data) != kMagic ||
+        qFromLittleEndian<quint32>(data + 4) != kVersion) {
+        close();
+        return false;
+    }
+
+    const qint64 width = qFromLittleEndian<quint32>(data + 8);
+    const qint64 height = qFromLittleEndian<quint32>(data + 12);
+    const quint32 flags = qFromLittleEndian<quint32>(data + 16);
+    const qint64 obstacleCount = qFromLittleEndian<quint32>(data + 20);
+    const qint64 cells = width * height;
+    if (width < 1 || height < 1 || cells > kMaxCells || (flags & ~kFlagWrap) != 0) {
+        close();
+        return false;
+    }
+
+    const qint64 words = wordCountFor(cells);
+    if (file_.size() < kHeaderSize + words * 8) {
+        close();
+        return false;
+    }
+
+    // 障碍物数要与位图一致，且最后一个字中棋盘外的位必须为 0，
+    // 否则开局复制到占用位图后计数会出错
+    const uchar* bitmap = data + kHeaderSize;
+    qint64 counted = 0;
+    quint64 last = 0;
+    for (qint64 i = 0; i < words; ++i) {
+        last = qFromLittleEndian<quint64>(bitmap + i * 8);
+        counted += qPopulationCount(last);
+    }
+    const int tailBits = static_cast<int>(cells & 63);
+    if (counted != obstacleCount || (tailBits != 0 && (last >> tailBits) != 0)) {
+        close();
+        return false;
+    }
+
+    words_ = bitmap;
+    width_ = static_cast<int>(width);
+    height_ = static_cast<int>(height);
+    wrap_ = (flags & kFlagWrap) != 0;
+    obstacleCount_ = static_cast<int>(obstacleCount);
+    return true;
+}
+
+void Level::close()
+{
+    // QFile::close() 会自动解除所有映射
+    file_.close();
+    words_ = nullptr;
+    width_ = 0;
+    height_ = 0;
+    wrap_ = false;
+    obstacleCount_ = 0;
+}
+
+bool Level::write(const QString& path, int width, int height, bool wrap,
+                  const QVector<QPoint>& obstacles)
+{
+    const qint64 cells = static_cast<qint64>(width) * height;
+    if (width < 1 || height < 1 || cells > kMaxCells) {
+        return false;
+    }
+
+    std::vector<quint64> words(static_cast<size_t>(wordCountFor(cells)), 0);
+    for (const QPoint& pos : obstacles) {
+        if (pos.x() >= 0 && pos.x() < width && pos.y() >= 0 && pos.y() < height) {
+            const qint64 bit = static_cast<qint64>(pos.y()) * width + pos.x();
+            words[static_cast<size_t>(bit >> 6)] |= quint64(1) << (bit & 63);
+        }
+    }
+
+    quint32 obstacleCount = 0;
+    for (quint64 word : words) {
+        obstacleCount += qPopulationCount(word);
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    uchar header[kHeaderSize] = {};
+    qToLittleEndian<quint32>(kMagic, header);
+    qToLittleEndian<quint32>(kVersion, header + 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(width), header + 8);
+    qToLittleEndian<quint32>(static_cast<quint32>(height), header + 12);
+    qToLittleEndian<quint32>(wrap ? kFlagWrap : 0, header + 16);
+    qToLittleEndian<quint32>(obstacleCount, header + 20);
+    if (file.write(reinterpret_cast<const char*>(header), sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+
+    QByteArray bitmap(static_cast<int>(words.size() * 8), '\0');
+    uchar* out = reinterpret_cast<uchar*>(bitmap.data());
+    for (size_t i = 0; i < words.size(); ++i) {
+        qToLittleEndian<quint64>(words[i], out + i * 8);
+    }
+    return file.write(bitmap) == bitmap.size();
+}
+
+QVector<QPoint> Level::getObstacles() const
+{
+    QVector<QPoint> obstacles;
+    obstacles.reserve(obstacleCount_);
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            if (isObstacle(QPoint(x, y))) {
+                obstacles.append(QPoint(x, y));
+            }
+        }
+    }
+    return obstacles;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,131 @@
+/**
+ * @file Level.h
+ * @brief 关卡 - 以内存映射方式读取的静态障碍物地图
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <QFile>
+#include <QPoint>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+namespace SnakeGame {
+
+/**
+ * @brief 关卡（障碍物地图与边界规则）
+ *
+ * 文件格式（小端）：
+ * - 头部 32 字节：魔数、版本、宽度、高度、标志位、障碍物数、保留 8 字节
+ * - 障碍物位图：每格 1 位，按行优先存放在 ceil(宽 × 高 / 64) 个 64 位字中，
+ *   布局与 OccupancyGrid 相同，开局时可整块复制
+ *
+ * 打开时只映射文件并校验头部与位图，不整体读入，数百万格的地图也能立即打开。
+ * 打开后只读，可通过 std::shared_ptr<const Level> 在多个模拟线程间共享。
+ */
+class Level {
+public:
+    static constexpr quint32 kMagic = 0x4C4B4E53;  ///< "SNKL"
+    static constexpr quint32 kVersion = 1;         ///< 文件版本
+    static constexpr int kHeaderSize = 32;         ///< 头部字节数（保证位图 8 字节对齐）
+    static constexpr quint32 kFlagWrap = 0x1;      ///< 标志位：越过边界从对侧出现
+    static constexpr qint64 kMaxCells = qint64(1) << 28;   ///< 格数上限
+
+    Level();
+    ~Level();
+
+    Level(const Level&) = delete;
+    Level& operator=(const Level&) = delete;
+
+    /**
+     * @brief 打开并映射关卡文件
+     * @param path 文件路径
+     * @return true 打开成功且格式有效
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief 关闭文件并解除映射
+     */
+    void close();
+
+    /**
+     * @brief 写出关卡文件（用于制作关卡）
+     * @param path 文件路径
+     * @param width 棋盘宽度
+     * @param height 棋盘高度
+     * @param wrap 是否越界回绕
+     * @param obstacles 障碍物坐标（棋盘外的坐标被忽略）
+     * @return true 写入成功
+     */
+    static bool write(const QString& path, int width, int height, bool wrap,
+                      const QVector<QPoint>& obstacles);
+
+    /**
+     * @brief 是否已打开
+     */
+    bool isOpen() const { return words_ != nullptr; }
+
+    /**
+     * @brief 检查格子是否为障碍物（O(1)）
+     * @param pos 格子坐标，棋盘外返回 false
+     * @return true 表示障碍物
+     */
+    bool isObstacle(const QPoint& pos) const {
+        if (!words_ || pos.x() < 0 || pos.x() >= width_ || pos.y() < 0 || pos.y() >= height_) {
+            return false;
+        }
+        const int bit = pos.y() * width_ + pos.x();
+        // 逐字节读取，与主机字节序无关
+        return (words_[bit >> 3] >> (bit & 7)) & 1;
+    }
+
+    /**
+     * @brief 获取障碍物位图（小端 64 位字，布局与 OccupancyGrid 相同）
+     * @return 映射内存中的位图起始地址，未打开时为空
+     */
+    const uchar* obstacleWords() const { return words_; }
+
+    /**
+     * @brief 列出全部障碍物坐标（O(格数)，供渲染等一次性使用）
+     */
+    QVector<QPoint> getObstacles() const;
+
+    /**
+     * @brief 获取棋盘宽度
+     * @return 宽度（格数），未打开时为 0
+     */
+    int getWidth() const { return width_; }
+
+    /**
+     * @brief 获取棋盘高度
+     * @return 高度（格数），未打开时为 0
+     */
+    int getHeight() const { return height_; }
+
+    /**
+     * @brief 越过边界时是否从对侧出现
+     */
+    bool wraps() const { return wrap_; }
+
+    /**
+     * @brief 获取障碍物数量
+     */
+    int getObstacleCount() const { return obstacleCount_; }
+
+private:
+    QFile file_;                ///< 关卡文件
+    const uchar* words_;        ///< 映射后的位图起始地址
+    int width_;                 ///< 棋盘宽度
+    int height_;                ///< 棋盘高度
+    bool wrap_;                 ///< 是否越界回绕
+    int obstacleCount_;         ///< 障碍物数量
+};
+
+}  // namespace SnakeGame
+
+#endif  // LEVEL_H
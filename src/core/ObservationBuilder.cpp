@@ -0,0 +1,214 @@
+/**
+ * @file ObservationBuilder.cpp
+ * @brief 观测张量构建器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ObservationBuilder.h"
+#include "GameLogic.h"
+#include "Level.h"
+#include <cstring>
+
+namespace SnakeGame {
+
+ObservationBuilder::ObservationBuilder(int boardWidth, int boardHeight, Format format,
+                                       int padding, void* external)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , padding_(padding)
+    , width_(boardWidth + 2 * padding)
+    , height_(boardHeight + 2 * padding)
+    , format_(format)
+    , rowStride_(static_cast<qsizetype>(boardWidth + 2 * padding) * (format == Format::UInt8 ? 1 : 4))
+    , planeStride_(rowStride_ * (boardHeight + 2 * padding))
+    , data_(static_cast<uchar*>(external))
+    , tick_(0)
+    , diff_(boardWidth, boardHeight)
+    , prevState_(GameState::Ready)
+    , prevRewinds_(0)
+    , level_(nullptr)
+{
+    if (!data_) {
+        storage_.resize(static_cast<size_t>(byteSize()));
+        data_ = storage_.data();
+    }
+    std::memset(data_, 0, static_cast<size_t>(byteSize()));
+
+    setLevel(nullptr);
+}
+
+qsizetype ObservationBuilder::byteSizeFor(int boardWidth, int boardHeight, Format format, int padding)
+{
+    const qsizetype element = format == Format::UInt8 ? 1 : 4;
+    return element * (boardWidth + 2 * padding) * (boardHeight + 2 * padding) * PlaneCount;
+}
+
+void ObservationBuilder::update(const GameLogic& game)
+{
+    // 回退或状态变化（重开、结束）后蛇身可能与上一帧无关
+    if (game.getState() != prevState_ || game.getRewindCount() != prevRewinds_) {
+        diff_.invalidate();
+        prevState_ = game.getState();
+        prevRewinds_ = game.getRewindCount();
+    }
+    if (game.getLevel() != level_) {
+        setLevel(game.getLevel());
+    }
+    update(game.getSnakeBody(), game.getFoodPositions());
+}
+
+void ObservationBuilder::update(const QVector<QPoint>& body, const QVector<QPoint>& foods)
+{
+    if (body.isEmpty()) {
+        return;
+    }
+
+    if (diff_.setSnake(body)) {
+        rebuild(body);
+    } else if (!diff_.changes().empty()) {
+        // 没有变化说明本帧没有移动（暂停或重复调用），帧序号不前进
+        ++tick_;
+        applyChanges();
+    }
+
+    // 食物只在被吃掉后变化，多数帧没有改动
+    diff_.setFoods(foods);
+    applyChanges();
+}
+
+void ObservationBuilder::reset()
+{
+    clearPlane(Head);
+    clearPlane(Body);
+    clearPlane(Age);
+    clearPlane(Food);
+    tick_ = 0;
+    diff_.clear();
+}
+
+void ObservationBuilder::setWall(const QPoint& pos)
+{
+    if (isInside(pos)) {
+        store(Wall, pos, 1.0f);
+    }
+}
+
+void ObservationBuilder::setLevel(const Level* level)
+{
+    level_ = level;
+    clearPlane(Wall);
+
+    // 四周 padding 环；回绕关卡从对侧穿出，边界不是墙
+    if (!level || !level->wraps()) {
+        for (int y = 0; y < height_; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                if (x < padding_ || x >= padding_ + boardWidth_ ||
+                    y < padding_ || y >= padding_ + boardHeight_) {
+                    storeAt(Wall, x, y, 1.0f);
+                }
+            }
+        }
+    }
+
+    // 障碍物只在更换关卡时写入一次，O(格数)
+    if (level && level->getObstacleCount() > 0) {
+        for (int y = 0; y < boardHeight_; ++y) {
+            for (int x = 0; x < boardWidth_; ++x) {
+                if (level->isObstacle(QPoint(x, y))) {
+                    store(Wall, QPoint(x, y), 1.0f);
+                }
+            }
+        }
+    }
+}
+
+void ObservationBuilder::rebuild(const QVector<QPoint>& body)
+{
+    clearPlane(Head);
+    clearPlane(Body);
+    clearPlane(Age);
+    clearPlane(Food);
+
+    // 蛇尾最早进入，蛇头最新：第 i 节的帧序号为 length - i
+    tick_ = static_cast<quint32>(body.size());
+    for (int i = body.size() - 1; i >= 0; --i) {
+        store(Body, body[i], 1.0f);
+        storeAge(body[i], tick_ - static_cast<quint32>(i));
+    }
+    store(Head, body.first(), 1.0f);
+
+    // 被蛇盖住的食物不出现在食物平面上，与增量更新一致
+    for (const QPoint& food : diff_.foods()) {
+        if (diff_.cellAt(food.x(), food.y()) == BoardDiff::Cell::Food) {
+            store(Food, food, 1.0f);
+        }
+    }
+}
+
+void ObservationBuilder::applyChanges()
+{
+    for (const BoardDiff::Change& change : diff_.changes()) {
+        const QPoint& pos = change.pos;
+        switch (change.cell) {
+            case BoardDiff::Cell::Head:
+                store(Head, pos, 1.0f);
+                store(Body, pos, 1.0f);
+                store(Food, pos, 0.0f);
+                storeAge(pos, tick_);
+                break;
+            case BoardDiff::Cell::Body:
+                // 旧蛇头变为蛇身，占据帧序号不变
+                store(Head, pos, 0.0f);
+                break;
+            case BoardDiff::Cell::Food:
+                store(Food, pos, 1.0f);
+                break;
+            case BoardDiff::Cell::Empty:
+                store(Head, pos, 0.0f);
+                store(Body, pos, 0.0f);
+                store(Age, pos, 0.0f);
+                store(Food, pos, 0.0f);
+                break;
+        }
+    }
+}
+
+void ObservationBuilder::store(Plane plane, const QPoint& pos, float value)
+{
+    if (isInside(pos)) {
+        storeAt(plane, pos.x() + padding_, pos.y() + padding_, value);
+    }
+}
+
+void ObservationBuilder::storeAge(const QPoint& pos, quint32 tick)
+{
+    if (!isInside(pos)) {
+        return;
+    }
+
+    if (format_ == Format::UInt8) {
+        // 取帧序号的低 8 位，年龄按 256 取模
+        data_[Age * planeStride_ + (pos.y() + padding_) * rowStride_ + pos.x() + padding_] =
+            static_cast<uchar>(tick & 0xFF);
+    } else {
+        storeAt(Age, pos.x() + padding_, pos.y() + padding_, static_cast<float>(tick));
+    }
+}
+
+void ObservationBuilder::storeAt(Plane plane, int x, int y, float value)
+{
+    uchar* element = data_ + plane * planeStride_ + y * rowStride_ + x * elementSize();
+    if (format_ == Format::UInt8) {
+        *element = static_cast<uchar>(value);
+    } else {
+        std::memcpy(element, &value, sizeof(float));
+    }
+}
+
+void ObservationBuilder::clearPlane(Plane plane)
+{
+    std::memset(data_ + plane * planeStride_, 0, static_cast<size_t>(planeStride_));
+}
+
+}  // namespace SnakeGame
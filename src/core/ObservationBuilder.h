@@ -0,0 +1,226 @@
+/**
+ * @file ObservationBuilder.h
+ * @brief 观测张量构建器 - 为外部训练的机器人提供增量更新的棋盘平面
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef OBSERVATIONBUILDER_H
+#define OBSERVATIONBUILDER_H
+
+#include <QPoint>
+#include <QVector>
+#include <QtGlobal>
+#include <vector>
+#include "BoardDiff.h"
+#include "GameState.h"
+
+namespace SnakeGame {
+
+class GameLogic;
+class Level;
+
+/**
+ * @brief 观测张量构建器
+ *
+ * 张量布局为 [平面][行][列]，行优先连续存放，
+ * 棋盘四周各留 padding 格，用墙平面标出边界：
+ *   - Head：蛇头所在格为 1
+ *   - Body：蛇身（含蛇头）所在格为 1
+ *   - Age：蛇身格子被占据时的帧序号（float 精确到 2^24，uint8 取低 8 位），
+ *          当前帧序号减去该值即为该节的年龄，无需每帧改写整条蛇
+ *   - Food：食物所在格为 1
+ *   - Wall：边界与障碍物为 1（回绕关卡没有边界，padding 环为 0）
+ *
+ * update() 与渲染器共用 BoardDiff，只改写它给出的变化格子，
+ * 每帧开销与棋盘大小和蛇长无关；无法增量时整帧重建。
+ *
+ * 缓冲区可以自有，也可以指向外部内存（C 接口直接写入调用方的缓冲区），
+ * 调用方通过 data() 与 strides 直接读取，无需复制。
+ */
+class ObservationBuilder {
+public:
+    /**
+     * @brief 元素类型
+     */
+    enum class Format {
+        UInt8,      ///< 每个元素 1 字节
+        Float32     ///< 每个元素 4 字节
+    };
+
+    /**
+     * @brief 平面序号
+     */
+    enum Plane {
+        Head,
+        Body,
+        Age,
+        Food,
+        Wall,
+        PlaneCount
+    };
+
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度
+     * @param boardHeight 游戏区域高度
+     * @param format 元素类型
+     * @param padding 四周墙的宽度（格数）
+     * @param external 外部缓冲区（至少 byteSize() 字节），为空时自行分配
+     */
+    ObservationBuilder(int boardWidth, int boardHeight, Format format = Format::Float32,
+                       int padding = 1, void* external = nullptr);
+
+    // data_ 可能指向自有缓冲区，复制会导致两个对象共用同一块内存
+    ObservationBuilder(const ObservationBuilder&) = delete;
+    ObservationBuilder& operator=(const ObservationBuilder&) = delete;
+    ObservationBuilder(ObservationBuilder&&) = default;
+
+    /**
+     * @brief 计算指定尺寸所需的缓冲区字节数
+     */
+    static qsizetype byteSizeFor(int boardWidth, int boardHeight, Format format, int padding);
+
+    /**
+     * @brief 按当前局面增量更新
+     * @param game 游戏逻辑
+     *
+     * 游戏状态或回退次数与上次调用不同时整帧重建；
+     * 关卡与上次不同时按其障碍物和回绕方式重写墙平面。
+     */
+    void update(const GameLogic& game);
+
+    /**
+     * @brief 按蛇身和食物增量更新
+     * @param body 蛇身坐标（body[0] 为蛇头）
+     * @param foods 全部食物坐标
+     */
+    void update(const QVector<QPoint>& body, const QVector<QPoint>& foods);
+
+    /**
+     * @brief 清空动态平面并在下次 update() 时整帧重建（新的一局开始时调用）
+     */
+    void reset();
+
+    /**
+     * @brief 将棋盘内的格子标记为障碍物（更换关卡时会被覆盖）
+     * @param pos 格子坐标
+     */
+    void setWall(const QPoint& pos);
+
+    /**
+     * @brief 按关卡重写墙平面
+     * @param level 关卡（为空表示无障碍物、不回绕的空棋盘）
+     */
+    void setLevel(const Level* level);
+
+    /**
+     * @brief 张量首地址
+     */
+    const void* data() const { return data_; }
+
+    /**
+     * @brief 张量总字节数
+     */
+    qsizetype byteSize() const { return planeStride_ * PlaneCount; }
+
+    /**
+     * @brief 张量宽度（含 padding）
+     */
+    int width() const { return width_; }
+
+    /**
+     * @brief 张量高度（含 padding）
+     */
+    int height() const { return height_; }
+
+    /**
+     * @brief 元素类型
+     */
+    Format format() const { return format_; }
+
+    /**
+     * @brief 单个元素字节数（列步长）
+     */
+    qsizetype elementSize() const { return format_ == Format::UInt8 ? 1 : 4; }
+
+    /**
+     * @brief 行步长（字节）
+     */
+    qsizetype rowStride() const { return rowStride_; }
+
+    /**
+     * @brief 平面步长（字节）
+     */
+    qsizetype planeStride() const { return planeStride_; }
+
+    /**
+     * @brief 当前帧序号（Age 平面的参照）
+     */
+    quint32 tick() const { return tick_; }
+
+private:
+    int boardWidth_;                ///< 游戏区域宽度
+    int boardHeight_;               ///< 游戏区域高度
+    int padding_;                   ///< 四周墙的宽度
+    int width_;                     ///< 张量宽度
+    int height_;                    ///< 张量高度
+    Format format_;                 ///< 元素类型
+    qsizetype rowStride_;           ///< 行步长（字节）
+    qsizetype planeStride_;         ///< 平面步长（字节）
+
+    std::vector<uchar> storage_;    ///< 自有缓冲区（使用外部缓冲区时为空）
+    uchar* data_;                   ///< 张量首地址
+
+    quint32 tick_;                  ///< 当前帧序号
+    BoardDiff diff_;                ///< 上一帧的格子内容与本次变化
+    GameState prevState_;           ///< 上次 update(game) 时的游戏状态
+    int prevRewinds_;               ///< 上次 update(game) 时的累计回退次数
+    const Level* level_;            ///< 墙平面对应的关卡（不持有，仅用于比较）
+
+    /**
+     * @brief 整帧重建蛇与食物平面
+     */
+    void rebuild(const QVector<QPoint>& body);
+
+    /**
+     * @brief 按 diff_ 给出的变化改写各平面
+     */
+    void applyChanges();
+
+    /**
+     * @brief 写入一个元素
+     * @param plane 平面
+     * @param pos 棋盘坐标（不含 padding）
+     * @param value 数值
+     */
+    void store(Plane plane, const QPoint& pos, float value);
+
+    /**
+     * @brief 写入 Age 平面（uint8 直接取帧序号低 8 位，不经过 float）
+     * @param pos 棋盘坐标（不含 padding）
+     * @param tick 帧序号
+     */
+    void storeAge(const QPoint& pos, quint32 tick);
+
+    /**
+     * @brief 按张量坐标写入一个元素
+     */
+    void storeAt(Plane plane, int x, int y, float value);
+
+    /**
+     * @brief 清空一个平面
+     */
+    void clearPlane(Plane plane);
+
+    /**
+     * @brief 检查坐标是否在棋盘内
+     */
+    bool isInside(const QPoint& pos) const {
+        return pos.x() >= 0 && pos.x() < boardWidth_ && pos.y() >= 0 && pos.y() < boardHeight_;
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // OBSERVATIONBUILDER_H
@@ -0,0 +1,102 @@
+/**
+ * @file OccupancyGrid.cpp
+ * @brief 棋盘占用位图实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "OccupancyGrid.h"
+#include <QtAlgorithms>
+#include <QtEndian>
+#include <algorithm>
+
+namespace SnakeGame {
+
+OccupancyGrid::OccupancyGrid(int width, int height)
+    : width_(0)
+    , height_(0)
+    , count_(0)
+    , trackFreeCells_(false)
+{
+    resize(width, height);
+}
+
+void OccupancyGrid::resize(int width, int height)
+{
+    width_ = width;
+    height_ = height;
+    const size_t cells = static_cast<size_t>(width) * static_cast<size_t>(height);
+    words_.assign((cells + 63) / 64, 0);
+    count_ = 0;
+
+    // 尺寸变化后列表需按新格数重建
+    freeCells_.clear();
+    freeSlot_.clear();
+    if (trackFreeCells_) {
+        trackFreeCells_ = false;
+        setTrackFreeCells(true);
+    }
+}
+
+void OccupancyGrid::clear()
+{
+    std::fill(words_.begin(), words_.end(), quint64(0));
+    count_ = 0;
+    if (trackFreeCells_) {
+        trackFreeCells_ = false;
+        setTrackFreeCells(true);
+    }
+}
+
+void OccupancyGrid::assign(const QVector<QPoint>& cells)
+{
+    assign(nullptr, cells);
+}
+
+void OccupancyGrid::assign(const uchar* base, const QVector<QPoint>& cells)
+{
+    if (!base) {
+        clear();
+    } else {
+        count_ = 0;
+        for (size_t i = 0; i < words_.size(); ++i) {
+            words_[i] = qFromLittleEndian<quint64>(base + i * sizeof(quint64));
+            count_ += qPopulationCount(words_[i]);
+        }
+        if (trackFreeCells_) {
+            trackFreeCells_ = false;
+            setTrackFreeCells(true);
+        }
+    }
+
+    for (const QPoint& pos : cells) {
+        if (contains(pos)) {
+            set(pos);
+        }
+    }
+}
+
+void OccupancyGrid::setTrackFreeCells(bool enabled)
+{
+    if (enabled == trackFreeCells_) {
+        return;
+    }
+    trackFreeCells_ = enabled;
+    if (!enabled) {
+        // 保留容量，下一局再次开启时不必重新分配
+        freeCells_.clear();
+        return;
+    }
+
+    const int cells = cellCount();
+    freeCells_.reserve(cells);
+    freeSlot_.resize(cells);
+    freeCells_.clear();
+    for (int cell = 0; cell < cells; ++cell) {
+        if (!((words_[cell >> 6] >> (cell & 63)) & 1)) {
+            addFreeCell(cell);
+        }
+    }
+}
+
+}  // namespace SnakeGame
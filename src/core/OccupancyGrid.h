@@ -0,0 +1,191 @@
+/**
+ * @file OccupancyGrid.h
+ * @brief 棋盘占用位图 - O(1) 判断格子是否被占据
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef OCCUPANCYGRID_H
+#define OCCUPANCYGRID_H
+
+#include <QPoint>
+#include <QVector>
+#include <QtGlobal>
+#include <vector>
+
+namespace SnakeGame {
+
+/**
+ * @brief 棋盘占用位图
+ *
+ * 每格 1 位，按行优先存放在 64 位字中。GameLogic 随蛇头前进和蛇尾离开
+ * 同步维护，自身碰撞检测因此与蛇长无关；4096×4096 的棋盘只需 2 MB。
+ * test()/set()/reset() 不做边界检查，调用方需保证坐标在棋盘内。
+ *
+ * 可选地同步维护空闲格列表（setTrackFreeCells），用于棋盘接近填满时
+ * O(1) 均匀抽取空闲格；列表按格数预留容量，开启后每次增删不再分配内存。
+ */
+class OccupancyGrid {
+public:
+    /**
+     * @brief 构造函数
+     * @param width 棋盘宽度（格数）
+     * @param height 棋盘高度（格数）
+     */
+    explicit OccupancyGrid(int width = 0, int height = 0);
+
+    /**
+     * @brief 调整尺寸并清空
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief 清空所有格子
+     */
+    void clear();
+
+    /**
+     * @brief 清空后标记一组格子
+     * @param cells 需要标记的格子（棋盘外的坐标被忽略）
+     */
+    void assign(const QVector<QPoint>& cells);
+
+    /**
+     * @brief 以一张静态位图为底，再标记一组格子
+     * @param base 底图（小端 64 位字，布局与本类相同，如关卡障碍物），为空时等同 assign(cells)
+     * @param cells 需要标记的格子（棋盘外的坐标被忽略）
+     *
+     * 底图按字整块复制，开销为 O(格数 / 64)，与障碍物数量无关。
+     */
+    void assign(const uchar* base, const QVector<QPoint>& cells);
+
+    /**
+     * @brief 检查格子是否被占据
+     */
+    bool test(const QPoint& pos) const {
+        const int bit = index(pos);
+        return (words_[bit >> 6] >> (bit & 63)) & 1;
+    }
+
+    /**
+     * @brief 标记格子
+     */
+    void set(const QPoint& pos) {
+        const int bit = index(pos);
+        const quint64 mask = quint64(1) << (bit & 63);
+        quint64& word = words_[bit >> 6];
+        if (!(word & mask)) {
+            word |= mask;
+            ++count_;
+            if (trackFreeCells_) {
+                removeFreeCell(bit);
+            }
+        }
+    }
+
+    /**
+     * @brief 取消标记
+     */
+    void reset(const QPoint& pos) {
+        const int bit = index(pos);
+        const quint64 mask = quint64(1) << (bit & 63);
+        quint64& word = words_[bit >> 6];
+        if (word & mask) {
+            word &= ~mask;
+            --count_;
+            if (trackFreeCells_) {
+                addFreeCell(bit);
+            }
+        }
+    }
+
+    /**
+     * @brief 检查坐标是否在棋盘内
+     */
+    bool contains(const QPoint& pos) const {
+        return pos.x() >= 0 && pos.x() < width_ && pos.y() >= 0 && pos.y() < height_;
+    }
+
+    /**
+     * @brief 被占据的格子数（O(1)）
+     */
+    int count() const { return count_; }
+
+    /**
+     * @brief 棋盘格数
+     */
+    int cellCount() const { return width_ * height_; }
+
+    /**
+     * @brief 开启或关闭空闲格列表
+     * @param enabled true 时按当前位图重建列表（O(格数)），之后随 set()/reset() 同步
+     */
+    void setTrackFreeCells(bool enabled);
+
+    /**
+     * @brief 是否正在维护空闲格列表
+     */
+    bool tracksFreeCells() const { return trackFreeCells_; }
+
+    /**
+     * @brief 空闲格列表中的第 i 个格子（须已开启空闲格列表）
+     * @param i 序号 [0, cellCount() - count())
+     */
+    QPoint freeCell(int i) const {
+        const int cell = freeCells_[i];
+        return QPoint(cell % width_, cell / width_);
+    }
+
+    /**
+     * @brief 棋盘宽度
+     */
+    int width() const { return width_; }
+
+    /**
+     * @brief 棋盘高度
+     */
+    int height() const { return height_; }
+
+    /**
+     * @brief 位图与空闲格列表占用的字节数
+     */
+    qsizetype memoryBytes() const {
+        return static_cast<qsizetype>(words_.size() * sizeof(quint64) +
+                                      (freeCells_.capacity() + freeSlot_.capacity()) * sizeof(int));
+    }
+
+private:
+    int width_;                     ///< 棋盘宽度
+    int height_;                    ///< 棋盘高度
+    int count_;                     ///< 被占据的格子数
+    std::vector<quint64> words_;    ///< 位图
+
+    bool trackFreeCells_;           ///< 是否维护空闲格列表
+    std::vector<int> freeCells_;    ///< 空闲格索引（无序）
+    std::vector<int> freeSlot_;     ///< 格索引 → 在 freeCells_ 中的位置
+
+    int index(const QPoint& pos) const { return pos.y() * width_ + pos.x(); }
+
+    /**
+     * @brief 从空闲格列表移除（与末尾交换后弹出）
+     */
+    void removeFreeCell(int cell) {
+        const int slot = freeSlot_[cell];
+        const int last = freeCells_.back();
+        freeCells_[slot] = last;
+        freeSlot_[last] = slot;
+        freeCells_.pop_back();
+    }
+
+    /**
+     * @brief 加入空闲格列表末尾
+     */
+    void addFreeCell(int cell) {
+        freeSlot_[cell] = static_cast<int>(freeCells_.size());
+        freeCells_.push_back(cell);
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // OCCUPANCYGRID_H
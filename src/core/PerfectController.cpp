@@ -0,0 +1,69 @@
+/**
+ * @file PerfectController.cpp
+ * @brief 最优策略自动驾驶控制器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "PerfectController.h"
+#include "EventLog.h"
+#include "GameLogic.h"
+
+namespace SnakeGame {
+
+PerfectController::PerfectController(std::shared_ptr<const PolicyTable> policy, int stateLimit)
+    : policy_(std::move(policy))
+    , stateLimit_(stateLimit)
+    , policyMisses_(0)
+{
+}
+
+Direction PerfectController::nextDirection(const GameLogic& game)
+{
+    const QVector<QPoint>& body = game.getSnakeBody();
+    // 策略表与求解器按单个食物建模，多个食物时只针对第一个
+    const QPoint food = game.getFoodPosition();
+    Direction move = game.getDirection();
+
+    if (policy_ && policy_->getBoardWidth() == game.getBoardWidth() &&
+        policy_->getBoardHeight() == game.getBoardHeight() &&
+        policy_->lookup(body, food, &move)) {
+        return move;
+    }
+    ++policyMisses_;
+
+    if (!fallback_) {
+        if (!solver_) {
+            solver_ = std::make_unique<PerfectSolver>(game.getBoardWidth(), game.getBoardHeight());
+            solver_->setStateLimit(stateLimit_);
+        }
+
+        if (solver_->isSupported()) {
+            PerfectSolver::Result result;
+            if (solver_->solve(body, food, &result)) {
+                return result.hasMove ? result.bestMove : move;
+            }
+            SNAKE_LOG_WARNING("PerfectController - solver exceeded %lld states, "
+                              "following the Hamiltonian cycle", static_cast<qint64>(stateLimit_));
+        } else {
+            SNAKE_LOG_WARNING("PerfectController - %lldx%lld board is too large, "
+                              "following the Hamiltonian cycle",
+                              static_cast<qint64>(game.getBoardWidth()),
+                              static_cast<qint64>(game.getBoardHeight()));
+        }
+        // 求解器的记忆表已经没有用处，释放内存
+        solver_.reset();
+        fallback_ = std::make_unique<HamiltonController>();
+    }
+
+    return fallback_->nextDirection(game);
+}
+
+void PerfectController::reset()
+{
+    if (fallback_) {
+        fallback_->reset();
+    }
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,63 @@
+/**
+ * @file PerfectController.h
+ * @brief 最优策略自动驾驶控制器
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef PERFECTCONTROLLER_H
+#define PERFECTCONTROLLER_H
+
+#include <memory>
+
+#include "Controller.h"
+#include "HamiltonController.h"
+#include "PerfectSolver.h"
+#include "PolicyTable.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 最优策略自动驾驶控制器
+ *
+ * 优先查询预先导出的策略表；表中没有的局面在小棋盘上现场求解，
+ * 求解结果保留在内存中供后续帧复用。棋盘超过 PerfectSolver::kMaxCells 格
+ * 或求解超出局面数上限时，记一条警告并改由 HamiltonController 驾驶到对局结束。
+ */
+class PerfectController : public Controller {
+public:
+    /**
+     * @brief 构造函数
+     * @param policy 预先计算的策略表（可为空）
+     * @param stateLimit 现场求解的局面数上限
+     */
+    explicit PerfectController(std::shared_ptr<const PolicyTable> policy = nullptr,
+                               int stateLimit = PerfectSolver::kDefaultStateLimit);
+
+    Direction nextDirection(const GameLogic& game) override;
+
+    void reset() override;
+
+    /**
+     * @brief 是否已改由哈密顿回路驾驶
+     * @return true 表示棋盘不受支持或求解器超出了局面数上限
+     */
+    bool isFallingBack() const { return fallback_ != nullptr; }
+
+    /**
+     * @brief 策略表未命中、需要现场求解的次数
+     * @return 次数（策略表覆盖完整时为 0）
+     */
+    quint64 policyMisses() const { return policyMisses_; }
+
+private:
+    std::shared_ptr<const PolicyTable> policy_;     ///< 预先计算的策略表
+    std::unique_ptr<PerfectSolver> solver_;         ///< 现场求解器（按棋盘尺寸惰性创建）
+    std::unique_ptr<HamiltonController> fallback_;  ///< 无法求解时的替代控制器
+    int stateLimit_;                                ///< 现场求解的局面数上限
+    quint64 policyMisses_;                          ///< 策略表未命中次数
+};
+
+}  // namespace SnakeGame
+
+#endif  // PERFECTCONTROLLER_H
@@ -0,0 +1,401 @@
+/**
+ * @file PerfectSolver.cpp
+ * @brief 小棋盘穷举求解器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "PerfectSolver.h"
+#include "PolicyTable.h"
+#include <QFile>
+#include <QtEndian>
+#include <algorithm>
+#include <unordered_set>
+
+namespace SnakeGame {
+
+namespace {
+
+constexpr double kEpsilon = 1e-9;
+
+constexpr Direction kAllDirections[] = {
+    Direction::Up, Direction::Down, Direction::Left, Direction::Right
+};
+
+/**
+ * @brief 按位追加写入 128 位局面键
+ */
+class KeyWriter {
+public:
+    void put(quint64 value, int bits) {
+        if (bit_ < 64) {
+            key_.low |= value << bit_;
+            if (bit_ + bits > 64) {
+                key_.high |= value >> (64 - bit_);
+            }
+        } else {
+            key_.high |= value << (bit_ - 64);
+        }
+        bit_ += bits;
+    }
+
+    SolverStateKey key() const { return key_; }
+
+private:
+    SolverStateKey key_;
+    int bit_ = 0;
+};
+
+/**
+ * @brief 相邻两节之间的方向编码（0 上，1 下，2 左，3 右）
+ */
+quint64 directionCode(int dx, int dy)
+{
+    if (dy < 0) return 0;
+    if (dy > 0) return 1;
+    if (dx < 0) return 2;
+    return 3;
+}
+
+/**
+ * @brief 比较两个结果：先比获胜概率，再比期望步数
+ */
+bool isBetter(const PerfectSolver::Result& a, const PerfectSolver::Result& b)
+{
+    if (a.winProbability > b.winProbability + kEpsilon) return true;
+    if (a.winProbability < b.winProbability - kEpsilon) return false;
+    return a.expectedMoves < b.expectedMoves - kEpsilon;
+}
+
+/**
+ * @brief 蛇身是否完整位于棋盘内
+ */
+bool insideBoard(const QVector<QPoint>& body, int boardWidth, int boardHeight)
+{
+    for (const QPoint& p : body) {
+        if (p.x() < 0 || p.x() >= boardWidth || p.y() < 0 || p.y() >= boardHeight) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+PerfectSolver::PerfectSolver(int boardWidth, int boardHeight)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , cellCount_(boardWidth * boardHeight)
+    , stateLimit_(kDefaultStateLimit)
+    , aborted_(false)
+    , liveStates_(0)
+{
+}
+
+bool PerfectSolver::isSupported() const
+{
+    return boardWidth_ > 0 && boardHeight_ > 0 && cellCount_ <= kMaxCells;
+}
+
+void PerfectSolver::setStateLimit(int limit)
+{
+    stateLimit_ = limit;
+}
+
+bool PerfectSolver::solve(const QVector<QPoint>& body, const QPoint& food, Result* result)
+{
+    if (!isSupported() || body.isEmpty() || !insideBoard(body, boardWidth_, boardHeight_)) {
+        return false;
+    }
+
+    Body cells;
+    cells.reserve(body.size());
+    for (const QPoint& p : body) {
+        cells.push_back(static_cast<quint8>(p.y() * boardWidth_ + p.x()));
+    }
+
+    aborted_ = false;
+    liveStates_ = 0;
+    Result solved = evaluate(cells, food.y() * boardWidth_ + food.x());
+    if (aborted_) {
+        return false;
+    }
+
+    if (result) {
+        *result = solved;
+    }
+    return true;
+}
+
+bool PerfectSolver::solveOpening(const QVector<QPoint>& body, Result* result)
+{
+    if (!isSupported() || body.isEmpty() || !insideBoard(body, boardWidth_, boardHeight_)) {
+        return false;
+    }
+
+    std::vector<bool> occupied(cellCount_, false);
+    for (const QPoint& p : body) {
+        occupied[p.y() * boardWidth_ + p.x()] = true;
+    }
+
+    // 开局食物在所有空格中均匀出现，与吃到食物后的处理相同
+    Result opening;
+    opening.hasMove = true;
+    int freeCount = 0;
+    for (int cell = 0; cell < cellCount_; ++cell) {
+        if (occupied[cell]) {
+            continue;
+        }
+        Result cellResult;
+        if (!solve(body, QPoint(cell % boardWidth_, cell / boardWidth_), &cellResult)) {
+            return false;
+        }
+        opening.winProbability += cellResult.winProbability;
+        opening.expectedMoves += cellResult.expectedMoves;
+        ++freeCount;
+    }
+    if (freeCount == 0) {
+        return false;
+    }
+
+    if (result) {
+        opening.winProbability /= freeCount;
+        opening.expectedMoves /= freeCount;
+        *result = opening;
+    }
+    return true;
+}
+
+int PerfectSolver::stateCount() const
+{
+    return static_cast<int>(memo_.size());
+}
+
+void PerfectSolver::clear()
+{
+    memo_.clear();
+}
+
+bool PerfectSolver::savePolicy(const QString& path) const
+{
+    std::vector<std::pair<SolverStateKey, Direction>> entries;
+    entries.reserve(memo_.size());
+    for (const auto& item : memo_) {
+        if (item.second.hasMove) {
+            entries.emplace_back(item.first, item.second.bestMove);
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    uchar header[PolicyTable::kHeaderSize];
+    qToLittleEndian<quint32>(PolicyTable::kMagic, header);
+    qToLittleEndian<quint32>(PolicyTable::kVersion, header + 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(boardWidth_), header + 8);
+    qToLittleEndian<quint32>(static_cast<quint32>(boardHeight_), header + 12);
+    qToLittleEndian<quint64>(static_cast<quint64>(entries.size()), header + 16);
+    if (file.write(reinterpret_cast<const char*>(header), sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+
+    uchar record[PolicyTable::kRecordSize];
+    for (const auto& entry : entries) {
+        qToLittleEndian<quint64>(entry.first.low, record);
+        qToLittleEndian<quint64>(entry.first.high, record + 8);
+        record[16] = static_cast<uchar>(entry.second);
+        if (file.write(reinterpret_cast<const char*>(record), sizeof(record)) != sizeof(record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SolverStateKey PerfectSolver::encode(int boardWidth, const QVector<QPoint>& body, const QPoint& food)
+{
+    KeyWriter writer;
+    const QPoint& head = body.first();
+    writer.put(static_cast<quint64>(head.y() * boardWidth + head.x()), 6);
+    writer.put(static_cast<quint64>(body.size()), 6);
+    writer.put(static_cast<quint64>(food.y() * boardWidth + food.x()), 6);
+    for (int i = 0; i + 1 < body.size(); ++i) {
+        QPoint delta = body[i + 1] - body[i];
+        writer.put(directionCode(delta.x(), delta.y()), 2);
+    }
+    return writer.key();
+}
+
+SolverStateKey PerfectSolver::encodeCells(const Body& body, int food) const
+{
+    KeyWriter writer;
+    writer.put(body.front(), 6);
+    writer.put(static_cast<quint64>(body.size()), 6);
+    writer.put(static_cast<quint64>(food), 6);
+    for (size_t i = 0; i + 1 < body.size(); ++i) {
+        int delta = body[i + 1] - body[i];
+        int dx = delta == 1 ? 1 : (delta == -1 ? -1 : 0);
+        int dy = delta == boardWidth_ ? 1 : (delta == -boardWidth_ ? -1 : 0);
+        writer.put(directionCode(dx, dy), 2);
+    }
+    return writer.key();
+}
+
+int PerfectSolver::neighbor(int cell, Direction dir) const
+{
+    QPoint p(cell % boardWidth_, cell / boardWidth_);
+    p += DirectionHelper::toOffset(dir);
+    if (p.x() < 0 || p.x() >= boardWidth_ || p.y() < 0 || p.y() >= boardHeight_) {
+        return -1;
+    }
+    return p.y() * boardWidth_ + p.x();
+}
+
+PerfectSolver::Result PerfectSolver::evaluate(const Body& start, int food)
+{
+    const SolverStateKey startKey = encodeCells(start, food);
+    auto cached = memo_.find(startKey);
+    if (cached != memo_.end()) {
+        return cached->second;
+    }
+    if (aborted_ || reserveState()) {
+        return Result();
+    }
+
+    // 同一食物周期内蛇长不变，BFS 求到达每个局面的最短步数
+    struct Node {
+        Body body;
+        int depth;
+        int parent;             ///< 父节点在队列中的下标（起点为 -1）
+        Direction move;         ///< 从父节点走到本节点的方向
+    };
+    std::vector<Node> queue;
+    queue.push_back({start, 0, -1, Direction::Right});
+    std::unordered_set<SolverStateKey, KeyHash> visited;
+    visited.insert(startKey);
+
+    Result best;
+    bool foundEat = false;
+    int bestParent = -1;        ///< 最优吃食路径上吃食前的节点
+    Direction bestEatMove = Direction::Right;
+
+    for (size_t head = 0; head < queue.size() && !aborted_; ++head) {
+        const Body body = queue[head].body;
+        const int depth = queue[head].depth;
+        const int length = static_cast<int>(body.size());
+
+        for (Direction dir : kAllDirections) {
+            int next = neighbor(body[0], dir);
+            if (next < 0 || (length > 1 && next == body[1])) {
+                continue;
+            }
+
+            // 与 GameLogic 一致：不吃食物时蛇尾先离开，可以走进蛇尾所在格
+            const bool eat = next == food;
+            const int checked = eat ? length : length - 1;
+            if (std::find(body.begin(), body.begin() + checked, next) != body.begin() + checked) {
+                continue;
+            }
+
+            Body moved;
+            moved.reserve(length + 1);
+            moved.push_back(static_cast<quint8>(next));
+            moved.insert(moved.end(), body.begin(), body.begin() + checked);
+
+            if (!best.hasMove) {
+                // 即使注定失败也给出一个合法走法
+                best.hasMove = true;
+                best.bestMove = dir;
+                best.expectedMoves = depth + 1;
+            }
+
+            if (!eat) {
+                if (visited.insert(encodeCells(moved, food)).second) {
+                    // BFS 节点与记忆表共用上限，超出时整体中止
+                    if (reserveState()) {
+                        break;
+                    }
+                    queue.push_back({std::move(moved), depth + 1, static_cast<int>(head), dir});
+                }
+                continue;
+            }
+
+            Result candidate;
+            candidate.hasMove = true;
+
+            if (static_cast<int>(moved.size()) == cellCount_) {
+                // 填满棋盘，获胜
+                candidate.winProbability = 1.0;
+                candidate.expectedMoves = depth + 1;
+            } else {
+                // 新食物在所有空格中均匀出现，取平均
+                std::vector<bool> occupied(cellCount_, false);
+                for (quint8 cell : moved) {
+                    occupied[cell] = true;
+                }
+                double winSum = 0.0;
+                double moveSum = 0.0;
+                int freeCount = 0;
+                for (int cell = 0; cell < cellCount_ && !aborted_; ++cell) {
+                    if (occupied[cell]) {
+                        continue;
+                    }
+                    Result child = evaluate(moved, cell);
+                    winSum += child.winProbability;
+                    moveSum += child.expectedMoves;
+                    ++freeCount;
+                }
+                candidate.winProbability = winSum / freeCount;
+                candidate.expectedMoves = depth + 1 + moveSum / freeCount;
+            }
+
+            if (!foundEat || isBetter(candidate, best)) {
+                best = candidate;
+                foundEat = true;
+                bestParent = static_cast<int>(head);
+                bestEatMove = dir;
+            }
+        }
+    }
+
+    // 本周期的 BFS 节点随函数返回释放
+    liveStates_ -= static_cast<qint64>(queue.size());
+
+    if (aborted_) {
+        return Result();
+    }
+
+    if (foundEat) {
+        // 沿最优路径回溯，路径上每个局面都记入记忆表：
+        // 最短路的后缀仍是最短路，从中间局面出发的最优走法就是沿路径继续，
+        // 控制器在周期中途查询时直接命中，不必重新搜索
+        Direction nextMove = bestEatMove;
+        for (int index = bestParent; index > 0; index = queue[index].parent) {
+            const Node& node = queue[index];
+            Result step = best;
+            step.bestMove = nextMove;
+            step.expectedMoves = best.expectedMoves - node.depth;
+            memo_.emplace(encodeCells(node.body, food), step);
+            nextMove = node.move;
+        }
+        best.bestMove = nextMove;
+    }
+
+    memo_.emplace(startKey, best);
+    return best;
+}
+
+bool PerfectSolver::reserveState()
+{
+    if (static_cast<qint64>(memo_.size()) + liveStates_ >= stateLimit_) {
+        aborted_ = true;
+        return true;
+    }
+    ++liveStates_;
+    return false;
+}
+
+}  // namespace SnakeGame
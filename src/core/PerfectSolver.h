@@ -0,0 +1,189 @@
+/**
+ * @file PerfectSolver.h
+ * @brief 小棋盘穷举求解器 - 计算最优走法策略
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef PERFECTSOLVER_H
+#define PERFECTSOLVER_H
+
+#include <QPoint>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include <unordered_map>
+#include <vector>
+
+#include "Direction.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 压缩后的局面键（蛇身 + 食物）
+ *
+ * 布局：蛇头格索引(6 位) | 长度(6 位) | 食物格索引(6 位) | 每节相对方向(2 位/节)
+ */
+struct SolverStateKey {
+    quint64 low = 0;    ///< 低 64 位
+    quint64 high = 0;   ///< 高 64 位
+
+    bool operator==(const SolverStateKey& other) const {
+        return low == other.low && high == other.high;
+    }
+
+    bool operator<(const SolverStateKey& other) const {
+        return high != other.high ? high < other.high : low < other.low;
+    }
+};
+
+/**
+ * @brief 小棋盘穷举求解器
+ *
+ * 规则与 GameLogic 完全一致（撞墙/撞自身判负，食物在空格中均匀生成）。
+ * 目标按字典序优化：先最大化获胜（填满棋盘）概率，再最小化期望步数。
+ *
+ * 同一食物周期内（长度不变）的走法用 BFS 求最短路，
+ * 吃到食物后的局面按所有可能的新食物位置取平均并递归求解。
+ * 每个周期起点以及最优路径上的每个中间局面都记入内存表，
+ * 按最优策略走出的每一步都能查到，可导出为策略文件供 PolicyTable 查询。
+ */
+class PerfectSolver {
+public:
+    /** @brief 支持的最大格数（受局面键位宽限制） */
+    static constexpr int kMaxCells = 56;
+
+    /** @brief 默认局面数上限（记忆表加上搜索中的 BFS 节点），超出后放弃求解 */
+    static constexpr int kDefaultStateLimit = 4000000;
+
+    /**
+     * @brief 单个局面的求解结果
+     */
+    struct Result {
+        double winProbability = 0.0;    ///< 最优策略下的获胜概率
+        double expectedMoves = 0.0;     ///< 最优策略下到结束的期望步数
+        Direction bestMove = Direction::Right;  ///< 最优的下一步
+        bool hasMove = false;           ///< 是否存在合法的下一步
+    };
+
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     */
+    PerfectSolver(int boardWidth, int boardHeight);
+
+    /**
+     * @brief 当前棋盘是否可由本求解器处理
+     * @return true 表示格数不超过 kMaxCells
+     */
+    bool isSupported() const;
+
+    /**
+     * @brief 设置局面数上限
+     *
+     * 记忆表中的局面和递归中尚未释放的 BFS 节点（队列与已访问集合）一并计数，
+     * 上限大致对应求解器的峰值内存。
+     *
+     * @param limit 上限
+     */
+    void setStateLimit(int limit);
+
+    /**
+     * @brief 求解指定局面
+     * @param body 蛇身坐标（body[0] 为蛇头）
+     * @param food 食物位置
+     * @param result 输出结果
+     * @return true 求解完成，false 表示棋盘不支持、蛇身越出棋盘或超出局面数上限
+     */
+    bool solve(const QVector<QPoint>& body, const QPoint& food, Result* result);
+
+    /**
+     * @brief 求解开局：初始蛇身配合每一个可能的初始食物位置
+     *
+     * 完成后记忆表覆盖按最优策略从开局起可能遇到的所有局面，可直接导出策略文件。
+     *
+     * @param body 初始蛇身坐标
+     * @param result 输出按食物位置平均后的结果（bestMove 无意义）
+     * @return true 求解完成，false 表示棋盘不支持、蛇身越出棋盘或超出局面数上限
+     */
+    bool solveOpening(const QVector<QPoint>& body, Result* result);
+
+    /**
+     * @brief 已记忆的局面数
+     * @return 局面数
+     */
+    int stateCount() const;
+
+    /**
+     * @brief 清空记忆表
+     */
+    void clear();
+
+    /**
+     * @brief 将所有已求解局面的最优走法写入策略文件
+     * @param path 文件路径
+     * @return true 写入成功
+     */
+    bool savePolicy(const QString& path) const;
+
+    /**
+     * @brief 计算局面键
+     * @param boardWidth 游戏区域宽度
+     * @param body 蛇身坐标
+     * @param food 食物位置
+     * @return 局面键
+     */
+    static SolverStateKey encode(int boardWidth, const QVector<QPoint>& body, const QPoint& food);
+
+private:
+    using Body = std::vector<quint8>;
+
+    /**
+     * @brief 局面键哈希
+     */
+    struct KeyHash {
+        size_t operator()(const SolverStateKey& key) const {
+            return static_cast<size_t>(key.low * 0x9E3779B97F4A7C15ULL ^ key.high);
+        }
+    };
+
+    int boardWidth_;    ///< 游戏区域宽度
+    int boardHeight_;   ///< 游戏区域高度
+    int cellCount_;     ///< 总格数
+    int stateLimit_;    ///< 局面数上限
+    bool aborted_;      ///< 是否因超出上限而中止
+    qint64 liveStates_; ///< 递归中尚未释放的 BFS 节点数
+    std::unordered_map<SolverStateKey, Result, KeyHash> memo_;  ///< 记忆表
+
+    /**
+     * @brief 递归求解（蛇身以格索引表示）
+     * @param body 蛇身格索引
+     * @param food 食物格索引
+     * @return 求解结果
+     */
+    Result evaluate(const Body& body, int food);
+
+    /**
+     * @brief 为一个新局面占用配额
+     * @return true 表示已达上限（同时置 aborted_）
+     */
+    bool reserveState();
+
+    /**
+     * @brief 计算格索引形式的局面键
+     */
+    SolverStateKey encodeCells(const Body& body, int food) const;
+
+    /**
+     * @brief 计算相邻格索引
+     * @param cell 当前格
+     * @param dir 方向
+     * @return 相邻格索引，越界返回 -1
+     */
+    int neighbor(int cell, Direction dir) const;
+};
+
+}  // namespace SnakeGame
+
+#endif  // PERFECTSOLVER_H
@@ -0,0 +1,114 @@
+/**
+ * @file PolicyTable.cpp
+ * @brief 最优策略查询表实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "PolicyTable.h"
+#include "PerfectSolver.h"
+#include <QtEndian>
+
+namespace SnakeGame {
+
+PolicyTable::PolicyTable()
+    : records_(nullptr)
+    , count_(0)
+    , boardWidth_(0)
+    , boardHeight_(0)
+{
+}
+
+PolicyTable::~PolicyTable()
+{
+    close();
+}
+
+bool PolicyTable::open(const QString& path)
+{
+    close();
+
+    file_.setFileName(path);
+    if (!file_.open(QIODevice::ReadOnly) || file_.size() < kHeaderSize) {
+        close();
+        return false;
+    }
+
+    const uchar* data = file_.map(0, file_.size());
+    if (!data || qFromLittleEndian<quint32>(data) != kMagic ||
+        qFromLittleEndian<quint32>(data + 4) != kVersion) {
+        close();
+        return false;
+    }
+
+    const qint64 count = static_cast<qint64>(qFromLittleEndian<quint64>(data + 16));
+    if (file_.size() < kHeaderSize + count * kRecordSize) {
+        close();
+        return false;
+    }
+
+    boardWidth_ = static_cast<int>(qFromLittleEndian<quint32>(data + 8));
+    boardHeight_ = static_cast<int>(qFromLittleEndian<quint32>(data + 12));
+    records_ = data + kHeaderSize;
+    count_ = count;
+    return true;
+}
+
+void PolicyTable::close()
+{
+    // QFile::close() 会自动解除所有映射
+    file_.close();
+    records_ = nullptr;
+    count_ = 0;
+    boardWidth_ = 0;
+    boardHeight_ = 0;
+}
+
+bool PolicyTable::lookup(const QVector<QPoint>& body, const QPoint& food, Direction* move) const
+{
+    if (!records_ || body.isEmpty()) {
+        return false;
+    }
+
+    const SolverStateKey key = PerfectSolver::encode(boardWidth_, body, food);
+
+    qint64 lo = 0;
+    qint64 hi = count_;
+    while (lo < hi) {
+        const qint64 mid = lo + (hi - lo) / 2;
+        const uchar* record = records_ + mid * kRecordSize;
+        SolverStateKey probe;
+        probe.low = qFromLittleEndian<quint64>(record);
+        probe.high = qFromLittleEndian<quint64>(record + 8);
+
+        if (probe == key) {
+            if (move) {
+                *move = static_cast<Direction>(record[16]);
+            }
+            return true;
+        }
+        if (probe < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return false;
+}
+
+int PolicyTable::getBoardWidth() const
+{
+    return boardWidth_;
+}
+
+int PolicyTable::getBoardHeight() const
+{
+    return boardHeight_;
+}
+
+qint64 PolicyTable::size() const
+{
+    return count_;
+}
+
+}  // namespace SnakeGame
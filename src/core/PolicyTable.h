@@ -0,0 +1,92 @@
+/**
+ * @file PolicyTable.h
+ * @brief 最优策略查询表 - 以内存映射方式读取求解器导出的策略文件
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef POLICYTABLE_H
+#define POLICYTABLE_H
+
+#include <QFile>
+#include <QPoint>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "Direction.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 最优策略查询表
+ *
+ * 文件格式（小端）：
+ * - 头部 24 字节：魔数、版本、宽度、高度、记录数
+ * - 记录 17 字节：局面键低 64 位、高 64 位、最优方向
+ *
+ * 记录按局面键排序，查询时在映射内存上二分查找，无需整体读入。
+ */
+class PolicyTable {
+public:
+    static constexpr quint32 kMagic = 0x504B4E53;  ///< "SNKP"
+    static constexpr quint32 kVersion = 1;         ///< 文件版本
+    static constexpr int kHeaderSize = 24;         ///< 头部字节数
+    static constexpr int kRecordSize = 17;         ///< 每条记录字节数
+
+    PolicyTable();
+    ~PolicyTable();
+
+    PolicyTable(const PolicyTable&) = delete;
+    PolicyTable& operator=(const PolicyTable&) = delete;
+
+    /**
+     * @brief 打开并映射策略文件
+     * @param path 文件路径
+     * @return true 打开成功且格式有效
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief 关闭文件并解除映射
+     */
+    void close();
+
+    /**
+     * @brief 查询局面的最优走法
+     * @param body 蛇身坐标
+     * @param food 食物位置
+     * @param move 输出最优方向
+     * @return true 表中存在该局面
+     */
+    bool lookup(const QVector<QPoint>& body, const QPoint& food, Direction* move) const;
+
+    /**
+     * @brief 获取策略对应的棋盘宽度
+     * @return 宽度（格数），未打开时为 0
+     */
+    int getBoardWidth() const;
+
+    /**
+     * @brief 获取策略对应的棋盘高度
+     * @return 高度（格数），未打开时为 0
+     */
+    int getBoardHeight() const;
+
+    /**
+     * @brief 获取记录数
+     * @return 记录数
+     */
+    qint64 size() const;
+
+private:
+    QFile file_;                ///< 策略文件
+    const uchar* records_;      ///< 映射后的记录起始地址
+    qint64 count_;              ///< 记录数
+    int boardWidth_;            ///< 棋盘宽度
+    int boardHeight_;           ///< 棋盘高度
+};
+
+}  // namespace SnakeGame
+
+#endif  // POLICYTABLE_H
@@ -0,0 +1,49 @@
+/**
+ * @file RandomController.cpp
+ * @brief 随机控制器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "RandomController.h"
+#include "GameLogic.h"
+#include <QRandomGenerator>
+
+namespace SnakeGame {
+
+namespace {
+
+constexpr Direction kAllDirections[] = {
+    Direction::Up, Direction::Down, Direction::Left, Direction::Right
+};
+
+}  // namespace
+
+RandomController::RandomController(Food::RandomGenerator generator)
+    : randomGenerator_(std::move(generator))
+{
+    if (!randomGenerator_) {
+        randomGenerator_ = [](int min, int max) {
+            return QRandomGenerator::global()->bounded(min, max + 1);
+        };
+    }
+}
+
+Direction RandomController::nextDirection(const GameLogic& game)
+{
+    const Direction current = game.getDirection();
+
+    // 跳过反向，避免 Snake::setDirection 拒绝并输出警告
+    int choice = randomGenerator_(0, 2);
+    for (Direction dir : kAllDirections) {
+        if (DirectionHelper::isOpposite(current, dir)) {
+            continue;
+        }
+        if (choice-- == 0) {
+            return dir;
+        }
+    }
+    return current;
+}
+
+}  // namespace SnakeGame
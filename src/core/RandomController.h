@@ -0,0 +1,38 @@
+/**
+ * @file RandomController.h
+ * @brief 随机控制器 - 批量模拟的基线策略
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef RANDOMCONTROLLER_H
+#define RANDOMCONTROLLER_H
+
+#include "Controller.h"
+#include "Food.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 随机控制器
+ *
+ * 每帧在三个非反向的方向中等概率选择一个，不做任何避障。
+ * 随机数生成器与 Food 使用相同的签名，便于批量模拟时共用同一个种子。
+ */
+class RandomController : public Controller {
+public:
+    /**
+     * @brief 构造函数
+     * @param generator 随机数生成器，返回 [min, max] 内的整数；为空时使用全局生成器
+     */
+    explicit RandomController(Food::RandomGenerator generator = nullptr);
+
+    Direction nextDirection(const GameLogic& game) override;
+
+private:
+    Food::RandomGenerator randomGenerator_;     ///< 随机数生成器
+};
+
+}  // namespace SnakeGame
+
+#endif  // RANDOMCONTROLLER_H
@@ -0,0 +1,316 @@
+/**
+ * @file Reachability.cpp
+ * @brief 可达区域查询实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "Reachability.h"
+#include "OccupancyGrid.h"
+#include <algorithm>
+
+namespace SnakeGame {
+
+Reachability::Reachability(const OccupancyGrid& occupancy)
+    : occupancy_(occupancy)
+    , width_(occupancy.width())
+    , height_(occupancy.height())
+    , wrap_(false)
+    , epoch_(1)
+    , labelEpoch_(0)
+    , relabels_(0)
+    , nextId_(0)
+{
+    const int cells = width_ * height_;
+    // 两次重新填充之间每让出一格消耗一个新编号，多留 1/4 使重新填充的开销均摊到每帧为常数
+    const int ids = cells + cells / 4 + 1;
+    label_.assign(static_cast<size_t>(cells), -1);
+    parent_.assign(static_cast<size_t>(ids), 0);
+    size_.assign(static_cast<size_t>(ids), 0);
+    stack_.reserve(static_cast<size_t>(cells));
+}
+
+void Reachability::reset(bool wrap)
+{
+    wrap_ = wrap;
+    ++epoch_;
+}
+
+void Reachability::block(const QPoint& pos)
+{
+    if (labelEpoch_ != epoch_) {
+        return;
+    }
+
+    const int cell = pos.y() * width_ + pos.x();
+    const int id = label_[static_cast<size_t>(cell)];
+    if (id < 0) {
+        return;
+    }
+    --size_[static_cast<size_t>(find(id))];
+    label_[static_cast<size_t>(cell)] = -1;
+
+    // 绕过该格的路径都能改走周围一圈时分量保持连通，否则可能被切开
+    if (!ringConnected(cell)) {
+        ++epoch_;
+    }
+}
+
+void Reachability::unblock(const QPoint& pos)
+{
+    if (labelEpoch_ != epoch_) {
+        return;
+    }
+
+    const int cell = pos.y() * width_ + pos.x();
+    if (label_[static_cast<size_t>(cell)] >= 0) {
+        return;
+    }
+    if (nextId_ == static_cast<int>(parent_.size())) {
+        ++epoch_;
+        return;
+    }
+
+    const int id = nextId_++;
+    parent_[static_cast<size_t>(id)] = id;
+    size_[static_cast<size_t>(id)] = 1;
+    label_[static_cast<size_t>(cell)] = id;
+
+    int around[4];
+    for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+        const int other = label_[static_cast<size_t>(around[i])];
+        if (other >= 0) {
+            unite(id, other);
+        }
+    }
+}
+
+int Reachability::regionSize(const QPoint& pos) const
+{
+    if (!occupancy_.contains(pos) || occupancy_.test(pos)) {
+        return 0;
+    }
+    ensureLabels();
+    return size_[static_cast<size_t>(find(label_[static_cast<size_t>(pos.y() * width_ + pos.x())]))];
+}
+
+int Reachability::reachableArea(const QPoint& from) const
+{
+    ensureLabels();
+
+    int roots[4];
+    int area = 0;
+    for (int i = 0, n = rootsAround(from, roots); i < n; ++i) {
+        area += size_[static_cast<size_t>(roots[i])];
+    }
+    return area;
+}
+
+bool Reachability::connected(const QPoint& from, const QPoint& to) const
+{
+    if (!occupancy_.contains(from) || !occupancy_.contains(to)) {
+        return false;
+    }
+    if (from == to) {
+        return true;
+    }
+
+    int around[4];
+    const int target = to.y() * width_ + to.x();
+    for (int i = 0, n = neighbors(from.y() * width_ + from.x(), around); i < n; ++i) {
+        if (around[i] == target) {
+            return true;
+        }
+    }
+
+    ensureLabels();
+
+    int fromRoots[4];
+    int toRoots[4];
+    const int fromCount = rootsAround(from, fromRoots);
+    const int toCount = rootsAround(to, toRoots);
+    for (int i = 0; i < fromCount; ++i) {
+        for (int j = 0; j < toCount; ++j) {
+            if (fromRoots[i] == toRoots[j]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool Reachability::isFree(int cell) const
+{
+    return !occupancy_.test(QPoint(cell % width_, cell / width_));
+}
+
+int Reachability::neighbors(int cell, int out[4]) const
+{
+    const int x = cell % width_;
+    const int y = cell / width_;
+    int n = 0;
+    if (x > 0) {
+        out[n++] = cell - 1;
+    } else if (wrap_) {
+        out[n++] = cell + width_ - 1;
+    }
+    if (x < width_ - 1) {
+        out[n++] = cell + 1;
+    } else if (wrap_) {
+        out[n++] = cell - width_ + 1;
+    }
+    if (y > 0) {
+        out[n++] = cell - width_;
+    } else if (wrap_) {
+        out[n++] = cell + (height_ - 1) * width_;
+    }
+    if (y < height_ - 1) {
+        out[n++] = cell + width_;
+    } else if (wrap_) {
+        out[n++] = cell - (height_ - 1) * width_;
+    }
+    return n;
+}
+
+bool Reachability::ringConnected(int cell) const
+{
+    // 周围 8 格按顺时针排列，相邻两项在棋盘上也相邻；奇数位是 4 邻居
+    static constexpr int kRingX[8] = {-1, 0, 1, 1, 1, 0, -1, -1};
+    static constexpr int kRingY[8] = {-1, -1, -1, 0, 1, 1, 1, 0};
+
+    const int cx = cell % width_;
+    const int cy = cell / width_;
+    bool free[8];
+    int freeNeighbors = 0;
+    int blockedAt = -1;
+    for (int i = 0; i < 8; ++i) {
+        int x = cx + kRingX[i];
+        int y = cy + kRingY[i];
+        if (wrap_) {
+            x = (x + width_) % width_;
+            y = (y + height_) % height_;
+        }
+        const bool inside = x >= 0 && x < width_ && y >= 0 && y < height_;
+        const int ringCell = y * width_ + x;
+        free[i] = inside && ringCell != cell && isFree(ringCell);
+        if (!free[i]) {
+            blockedAt = i;
+        } else if (i & 1) {
+            ++freeNeighbors;
+        }
+    }
+    if (freeNeighbors <= 1 || blockedAt < 0) {
+        return true;
+    }
+
+    // 从一个被占据的位置开始绕一圈，统计含有 4 邻居的连续空闲段数
+    int runs = 0;
+    bool inRun = false;
+    bool runHasNeighbor = false;
+    for (int step = 1; step <= 8; ++step) {
+        const int i = (blockedAt + step) & 7;
+        if (free[i]) {
+            inRun = true;
+            runHasNeighbor = runHasNeighbor || (i & 1);
+        } else if (inRun) {
+            runs += runHasNeighbor ? 1 : 0;
+            inRun = false;
+            runHasNeighbor = false;
+        }
+    }
+    return runs == 1;
+}
+
+void Reachability::ensureLabels() const
+{
+    if (labelEpoch_ == epoch_) {
+        return;
+    }
+
+    std::fill(label_.begin(), label_.end(), -1);
+    nextId_ = 0;
+
+    int around[4];
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            const int start = y * width_ + x;
+            if (label_[static_cast<size_t>(start)] >= 0 || occupancy_.test(QPoint(x, y))) {
+                continue;
+            }
+
+            const int id = nextId_++;
+            int count = 0;
+            label_[static_cast<size_t>(start)] = id;
+            stack_.push_back(start);
+            while (!stack_.empty()) {
+                const int cell = stack_.back();
+                stack_.pop_back();
+                ++count;
+                for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+                    const int next = around[i];
+                    if (label_[static_cast<size_t>(next)] < 0 && isFree(next)) {
+                        label_[static_cast<size_t>(next)] = id;
+                        stack_.push_back(next);
+                    }
+                }
+            }
+            parent_[static_cast<size_t>(id)] = id;
+            size_[static_cast<size_t>(id)] = count;
+        }
+    }
+
+    labelEpoch_ = epoch_;
+    ++relabels_;
+}
+
+int Reachability::find(int id) const
+{
+    while (parent_[static_cast<size_t>(id)] != id) {
+        parent_[static_cast<size_t>(id)] = parent_[static_cast<size_t>(parent_[static_cast<size_t>(id)])];
+        id = parent_[static_cast<size_t>(id)];
+    }
+    return id;
+}
+
+void Reachability::unite(int a, int b)
+{
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+        return;
+    }
+    if (size_[static_cast<size_t>(a)] < size_[static_cast<size_t>(b)]) {
+        std::swap(a, b);
+    }
+    parent_[static_cast<size_t>(b)] = a;
+    size_[static_cast<size_t>(a)] += size_[static_cast<size_t>(b)];
+}
+
+int Reachability::rootsAround(const QPoint& pos, int out[4]) const
+{
+    if (!occupancy_.contains(pos)) {
+        return 0;
+    }
+
+    const int cell = pos.y() * width_ + pos.x();
+    if (label_[static_cast<size_t>(cell)] >= 0) {
+        out[0] = find(label_[static_cast<size_t>(cell)]);
+        return 1;
+    }
+
+    int around[4];
+    int count = 0;
+    for (int i = 0, n = neighbors(cell, around); i < n; ++i) {
+        const int id = label_[static_cast<size_t>(around[i])];
+        if (id < 0) {
+            continue;
+        }
+        const int root = find(id);
+        if (std::find(out, out + count, root) == out + count) {
+            out[count++] = root;
+        }
+    }
+    return count;
+}
+
+}  // namespace SnakeGame
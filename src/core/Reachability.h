@@ -0,0 +1,140 @@
+/**
+ * @file Reachability.h
+ * @brief 可达区域查询 - 增量维护的空闲格连通分量
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef REACHABILITY_H
+#define REACHABILITY_H
+
+#include <QPoint>
+#include <QtGlobal>
+#include <vector>
+
+namespace SnakeGame {
+
+class OccupancyGrid;
+
+/**
+ * @brief 空闲格的连通分量（4 邻接）
+ *
+ * 回答"从某格出发能走到多少空闲格""蛇头还能否走到蛇尾"之类的安全性查询。
+ * 分量标号在首次查询时由一次洪水填充得到，并以轮次标记缓存：
+ *
+ * - 格子被让出（蛇尾离开）：新建一个单格分量，与相邻分量做并查集合并，O(α)
+ * - 格子被占据（新蛇头）：若它的空闲邻居在周围 8 格组成的环上彼此相连，
+ *   去掉它不会切断任何路径，只需把所在分量的格数减 1；否则作废缓存，
+ *   下一次查询时重新填充
+ *
+ * 因此每帧维护为 O(1)，查询在缓存有效时也是 O(1)；只有蛇身真正把区域
+ * 一分为二的那一帧才需要一次 O(格数) 的重新填充，且同一帧内的多次查询共享这一次。
+ *
+ * 占用位图由调用方维护，本类只保存其引用；block()/unblock() 须在位图更新之后调用。
+ * 所有缓冲区在构造时分配，之后不再分配内存。查询会更新缓存，但对外表现为只读。
+ */
+class Reachability {
+public:
+    /**
+     * @brief 构造函数
+     * @param occupancy 占用位图（须比本对象存活更久）
+     */
+    explicit Reachability(const OccupancyGrid& occupancy);
+
+    /**
+     * @brief 占用位图整体改变后调用（如新的一局），作废缓存
+     * @param wrap 越过边界是否从对侧出现
+     */
+    void reset(bool wrap);
+
+    /**
+     * @brief 格子已被占据
+     */
+    void block(const QPoint& pos);
+
+    /**
+     * @brief 格子已被让出
+     */
+    void unblock(const QPoint& pos);
+
+    /**
+     * @brief 空闲格所在区域的格数
+     * @param pos 格子坐标
+     * @return 格数，格子被占据或在棋盘外时为 0
+     */
+    int regionSize(const QPoint& pos) const;
+
+    /**
+     * @brief 从某格出发沿空闲格能走到的格数
+     * @param from 出发格，可以被占据（如蛇头）：此时为各相邻区域格数之和
+     * @return 格数（出发格本身空闲时计入）
+     */
+    int reachableArea(const QPoint& from) const;
+
+    /**
+     * @brief 两格之间是否存在只经过空闲格的路径
+     * @param from 起点，可以被占据（如蛇头）
+     * @param to 终点，可以被占据（如蛇尾）
+     * @return true 表示可达（两格相邻时总是可达）
+     */
+    bool connected(const QPoint& from, const QPoint& to) const;
+
+    /**
+     * @brief 累计重新填充的次数（用于评估增量维护的效果）
+     */
+    quint64 getRelabelCount() const { return relabels_; }
+
+private:
+    const OccupancyGrid& occupancy_;    ///< 占用位图
+    int width_;                         ///< 棋盘宽度
+    int height_;                        ///< 棋盘高度
+    bool wrap_;                         ///< 越界回绕
+
+    quint64 epoch_;                     ///< 占用位图的轮次，发生可能的分裂时加一
+    mutable quint64 labelEpoch_;        ///< 标号对应的轮次
+    mutable quint64 relabels_;          ///< 累计重新填充次数
+
+    mutable std::vector<int> label_;    ///< 格子 → 分量编号，被占据为 -1
+    mutable std::vector<int> parent_;   ///< 并查集父节点（按分量编号）
+    mutable std::vector<int> size_;     ///< 根分量的空闲格数
+    mutable int nextId_;                ///< 下一个可用的分量编号
+    mutable std::vector<int> stack_;    ///< 洪水填充栈
+
+    bool isFree(int cell) const;
+
+    /**
+     * @brief 取格子的 4 个邻居（棋盘外且不回绕的方向跳过）
+     * @return 邻居数
+     */
+    int neighbors(int cell, int out[4]) const;
+
+    /**
+     * @brief 格子周围 8 格环上，空闲的 4 邻居是否位于同一段连续空闲格中
+     */
+    bool ringConnected(int cell) const;
+
+    /**
+     * @brief 缓存失效时重新填充全部分量
+     */
+    void ensureLabels() const;
+
+    /**
+     * @brief 并查集查找（路径减半）
+     */
+    int find(int id) const;
+
+    /**
+     * @brief 合并两个分量（按格数）
+     */
+    void unite(int a, int b);
+
+    /**
+     * @brief 收集与格子连通的分量根（格子空闲时为其自身分量，否则为各空闲邻居的分量）
+     * @return 分量根个数（已去重）
+     */
+    int rootsAround(const QPoint& pos, int out[4]) const;
+};
+
+}  // namespace SnakeGame
+
+#endif  // REACHABILITY_H
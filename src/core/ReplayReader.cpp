@@ -0,0 +1,307 @@
+/**
+ * @file ReplayReader.cpp
+ * @brief 录像读取实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ReplayReader.h"
+#include <QtEndian>
+#include <algorithm>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief 由相邻两帧的蛇头推出移动方向（越界回绕时两格坐标相差整行）
+ */
+Direction directionBetween(const QPoint& from, const QPoint& to)
+{
+    QPoint offset = to - from;
+    if (qAbs(offset.x()) > 1) {
+        offset.setX(offset.x() > 0 ? -1 : 1);
+    }
+    if (qAbs(offset.y()) > 1) {
+        offset.setY(offset.y() > 0 ? -1 : 1);
+    }
+    return DirectionHelper::fromOffset(offset);
+}
+
+}  // namespace
+
+ReplayReader::ReplayReader()
+    : data_(nullptr)
+    , index_(nullptr)
+    , recordsEnd_(0)
+    , cursor_(0)
+    , frameCount_(0)
+    , keyframeCount_(0)
+    , boardWidth_(0)
+    , boardHeight_(0)
+{
+}
+
+ReplayReader::~ReplayReader()
+{
+    close();
+}
+
+bool ReplayReader::open(const QString& path)
+{
+    close();
+
+    file_.setFileName(path);
+    if (!file_.open(QIODevice::ReadOnly) || file_.size() < kHeaderSize) {
+        close();
+        return false;
+    }
+
+    const qint64 size = file_.size();
+    const uchar* data = file_.map(0, size);
+    if (!data || qFromLittleEndian<quint32>(data) != kMagic ||
+        qFromLittleEndian<quint32>(data + 4) != kVersion) {
+        close();
+        return false;
+    }
+
+    const qint64 width = qFromLittleEndian<quint32>(data + 8);
+    const qint64 height = qFromLittleEndian<quint32>(data + 12);
+    if (width <= 0 || height <= 0 || width * height > (qint64(1) << 32)) {
+        close();
+        return false;
+    }
+    data_ = data;
+    boardWidth_ = static_cast<int>(width);
+    boardHeight_ = static_cast<int>(height);
+
+    const uchar* trailer = data + size - kTrailerSize;
+    const qint64 frames = size >= kHeaderSize + kTrailerSize
+        ? static_cast<qint64>(qFromLittleEndian<quint64>(trailer)) : 0;
+    const qint64 keyframes = size >= kHeaderSize + kTrailerSize
+        ? static_cast<qint64>(qFromLittleEndian<quint64>(trailer + 8)) : 0;
+    if (frames > 0 && keyframes > 0 &&
+        keyframes <= (size - kHeaderSize - kTrailerSize) / kIndexEntrySize &&
+        qFromLittleEndian<quint32>(trailer + 16) == kIndexMagic) {
+        recordsEnd_ = size - kTrailerSize - keyframes * kIndexEntrySize;
+        index_ = data + recordsEnd_;
+        frameCount_ = frames;
+        keyframeCount_ = keyframes;
+    } else if (!rebuildIndex(size)) {
+        close();
+        return false;
+    }
+
+    if (!seek(0)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void ReplayReader::close()
+{
+    // QFile::close() 会自动解除所有映射
+    file_.close();
+    data_ = nullptr;
+    index_ = nullptr;
+    rebuiltIndex_.clear();
+    recordsEnd_ = 0;
+    cursor_ = 0;
+    frameCount_ = 0;
+    keyframeCount_ = 0;
+    boardWidth_ = 0;
+    boardHeight_ = 0;
+    current_ = ReplayFrame();
+}
+
+bool ReplayReader::rebuildIndex(qint64 size)
+{
+    // 没有尾部说明写入方未能执行 close()（进程被杀死或崩溃）：顺序扫描记录区，
+    // 按文件中的格式在内存里重建索引，截掉末尾写了一半的记录
+    recordsEnd_ = size;
+    cursor_ = kHeaderSize;
+    qint64 validEnd = kHeaderSize;
+    while (cursor_ < recordsEnd_) {
+        const qint64 offset = cursor_;
+        const bool keyframe = data_[offset] == RecordKeyframe;
+        if (!readRecord()) {
+            break;
+        }
+        if (keyframe) {
+            uchar entry[kIndexEntrySize];
+            qToLittleEndian<quint64>(static_cast<quint64>(current_.frame), entry);
+            qToLittleEndian<quint64>(static_cast<quint64>(offset), entry + 8);
+            rebuiltIndex_.append(reinterpret_cast<const char*>(entry), kIndexEntrySize);
+        }
+        validEnd = cursor_;
+    }
+
+    if (rebuiltIndex_.isEmpty()) {
+        return false;
+    }
+    recordsEnd_ = validEnd;
+    index_ = reinterpret_cast<const uchar*>(rebuiltIndex_.constData());
+    frameCount_ = current_.frame + 1;
+    keyframeCount_ = rebuiltIndex_.size() / kIndexEntrySize;
+    return true;
+}
+
+bool ReplayReader::seek(qint64 frame)
+{
+    if (!data_) {
+        return false;
+    }
+    frame = qBound<qint64>(0, frame, frameCount_ - 1);
+
+    // 二分查找帧号不大于目标的最后一个关键帧
+    qint64 low = 0;
+    qint64 high = keyframeCount_;
+    while (low < high) {
+        const qint64 mid = low + (high - low) / 2;
+        const qint64 keyframe = static_cast<qint64>(
+            qFromLittleEndian<quint64>(index_ + mid * kIndexEntrySize));
+        if (keyframe <= frame) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == 0) {
+        return false;
+    }
+
+    const uchar* entry = index_ + (low - 1) * kIndexEntrySize;
+    const qint64 offset = static_cast<qint64>(qFromLittleEndian<quint64>(entry + 8));
+    if (offset < kHeaderSize || offset >= recordsEnd_ || data_[offset] != RecordKeyframe) {
+        return false;
+    }
+
+    cursor_ = offset;
+    if (!readRecord()) {
+        return false;
+    }
+    while (current_.frame < frame) {
+        if (!step()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReplayReader::step()
+{
+    // 周期性关键帧重复上一帧的局面，继续读到帧号前进为止
+    const qint64 before = current_.frame;
+    while (cursor_ < recordsEnd_) {
+        if (!readRecord()) {
+            return false;
+        }
+        if (current_.frame > before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReplayReader::readRecord()
+{
+    const quint8 type = data_[cursor_++];
+
+    if (type == RecordKeyframe) {
+        if (recordsEnd_ - cursor_ < 21) {
+            return false;
+        }
+        const uchar* p = data_ + cursor_;
+        const qint64 frame = static_cast<qint64>(qFromLittleEndian<quint64>(p));
+        const int score = qFromLittleEndian<qint32>(p + 8);
+        const quint8 direction = p[12];
+        const qint64 length = qFromLittleEndian<quint32>(p + 13);
+        const qint64 foods = qFromLittleEndian<quint32>(p + 17);
+        cursor_ += 21;
+        if (direction > static_cast<quint8>(Direction::Right) ||
+            (length + foods) * 4 > recordsEnd_ - cursor_) {
+            return false;
+        }
+
+        current_.frame = frame;
+        current_.score = score;
+        current_.direction = static_cast<Direction>(direction);
+        current_.body.resize(static_cast<int>(length));
+        current_.foods.resize(static_cast<int>(foods));
+        for (QPoint& pos : current_.body) {
+            if (!readCell(&pos)) {
+                return false;
+            }
+        }
+        for (QPoint& pos : current_.foods) {
+            if (!readCell(&pos)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (type != RecordMove && type != RecordGrow) {
+        return false;
+    }
+
+    QPoint head;
+    if (!readCell(&head) || current_.body.isEmpty()) {
+        return false;
+    }
+    current_.direction = directionBetween(current_.body.first(), head);
+
+    if (type == RecordMove) {
+        // 与 Snake::move() 相同：整体后移一节，丢掉蛇尾
+        QPoint* data = current_.body.data();
+        std::move_backward(data, data + current_.body.size() - 1, data + current_.body.size());
+        data[0] = head;
+        ++current_.frame;
+        return true;
+    }
+
+    if (recordsEnd_ - cursor_ < 12) {
+        return false;
+    }
+    const uchar* p = data_ + cursor_;
+    const qint64 eaten = qFromLittleEndian<quint32>(p);
+    const int scoreDelta = qFromLittleEndian<qint32>(p + 4);
+    const qint64 spawned = qFromLittleEndian<quint32>(p + 8);
+    cursor_ += 12;
+    if (eaten >= current_.foods.size() || spawned * 4 > recordsEnd_ - cursor_) {
+        return false;
+    }
+
+    // 与 Food::remove() 相同：末尾的食物移到被吃掉的位置
+    current_.foods[static_cast<int>(eaten)] = current_.foods.last();
+    current_.foods.removeLast();
+    for (qint64 i = 0; i < spawned; ++i) {
+        QPoint pos;
+        if (!readCell(&pos)) {
+            return false;
+        }
+        current_.foods.append(pos);
+    }
+
+    current_.body.prepend(head);
+    current_.score += scoreDelta;
+    ++current_.frame;
+    return true;
+}
+
+bool ReplayReader::readCell(QPoint* pos)
+{
+    if (recordsEnd_ - cursor_ < 4) {
+        return false;
+    }
+    const qint64 cell = qFromLittleEndian<quint32>(data_ + cursor_);
+    cursor_ += 4;
+    if (cell >= qint64(boardWidth_) * boardHeight_) {
+        return false;
+    }
+    *pos = QPoint(static_cast<int>(cell % boardWidth_), static_cast<int>(cell / boardWidth_));
+    return true;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,180 @@
+/**
+ * @file ReplayReader.h
+ * @brief 录像读取 - 以内存映射方式打开录像文件，按关键帧索引跳转
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef REPLAYREADER_H
+#define REPLAYREADER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QPoint>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "Direction.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 录像中某一帧的完整局面
+ */
+struct ReplayFrame {
+    qint64 frame = 0;                   ///< 帧号
+    int score = 0;                      ///< 分数
+    Direction direction = Direction::Right;     ///< 移动方向
+    QVector<QPoint> body;               ///< 蛇身坐标（蛇头在前）
+    QVector<QPoint> foods;              ///< 食物坐标（与 Food 列表顺序一致）
+};
+
+/**
+ * @brief 录像读取器
+ *
+ * 文件格式（小端，格子编号为 y × 宽度 + x）：
+ * - 头部 16 字节：魔数、版本、宽度、高度
+ * - 记录区，每条记录以 1 字节类型开头：
+ *   - 关键帧：帧号 8 字节、分数 4 字节、方向 1 字节、蛇长 4 字节、食物数 4 字节，
+ *     随后是蛇身格子（蛇头在前）与食物格子，各 4 字节
+ *   - 移动：新蛇头 4 字节（蛇尾让出一格）
+ *   - 增长：新蛇头 4 字节、被吃掉的食物下标 4 字节、分数变化 4 字节、
+ *     新生成的食物数 4 字节，随后是新食物格子
+ * - 索引：每个关键帧 16 字节（帧号、记录偏移），按帧号递增
+ * - 尾部 24 字节：总帧数、关键帧数、索引魔数、保留
+ *
+ * 移动和增长各推进一帧；关键帧要么重复上一帧的局面（周期性写入），
+ * 要么开始新的一帧（新开局或回退后）。
+ * 跳转时在映射内存上二分查找不晚于目标的关键帧，再逐帧前滚，
+ * 只会访问关键帧到目标之间的记录，不整体读入文件。
+ *
+ * 写入方未能正常关闭的文件没有索引和尾部，打开时顺序扫描一遍记录区，
+ * 在内存中重建索引，末尾写了一半的记录被忽略。
+ */
+class ReplayReader {
+public:
+    static constexpr quint32 kMagic = 0x524B4E53;       ///< "SNKR"
+    static constexpr quint32 kVersion = 1;              ///< 文件版本
+    static constexpr quint32 kIndexMagic = 0x494B4E53;  ///< "SNKI"
+    static constexpr int kHeaderSize = 16;              ///< 头部字节数
+    static constexpr int kIndexEntrySize = 16;          ///< 每条索引字节数
+    static constexpr int kTrailerSize = 24;             ///< 尾部字节数
+
+    /**
+     * @brief 记录类型
+     */
+    enum RecordType : quint8 {
+        RecordKeyframe = 1,     ///< 完整局面
+        RecordMove = 2,         ///< 普通移动
+        RecordGrow = 3          ///< 吃到食物
+    };
+
+    ReplayReader();
+    ~ReplayReader();
+
+    ReplayReader(const ReplayReader&) = delete;
+    ReplayReader& operator=(const ReplayReader&) = delete;
+
+    /**
+     * @brief 打开并映射录像文件，定位到第 0 帧
+     * @param path 文件路径
+     * @return true 打开成功且格式有效（缺少索引时重建，见 isRecovered()）
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief 关闭文件并解除映射
+     */
+    void close();
+
+    /**
+     * @brief 是否已打开
+     */
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief 跳转到指定帧
+     * @param frame 帧号，超出范围时截断到 [0, 总帧数)
+     * @return true 跳转成功
+     *
+     * 二分查找索引中不晚于目标的最后一个关键帧，再逐帧前滚，
+     * 开销与关键帧间隔成正比，与帧号无关。
+     */
+    bool seek(qint64 frame);
+
+    /**
+     * @brief 前进一帧
+     * @return true 成功，已到录像末尾或记录损坏时返回 false
+     */
+    bool step();
+
+    /**
+     * @brief 当前帧的局面
+     */
+    const ReplayFrame& current() const { return current_; }
+
+    /**
+     * @brief 获取录像的棋盘宽度
+     * @return 宽度（格数），未打开时为 0
+     */
+    int getBoardWidth() const { return boardWidth_; }
+
+    /**
+     * @brief 获取录像的棋盘高度
+     * @return 高度（格数），未打开时为 0
+     */
+    int getBoardHeight() const { return boardHeight_; }
+
+    /**
+     * @brief 总帧数
+     */
+    qint64 frameCount() const { return frameCount_; }
+
+    /**
+     * @brief 关键帧数
+     */
+    qint64 keyframeCount() const { return keyframeCount_; }
+
+    /**
+     * @brief 索引是否由扫描记录区重建（文件未正常关闭）
+     */
+    bool isRecovered() const { return !rebuiltIndex_.isEmpty(); }
+
+private:
+    /**
+     * @brief 读取当前位置的一条记录并应用到 current_
+     * @return true 成功
+     */
+    bool readRecord();
+
+    /**
+     * @brief 顺序扫描记录区重建关键帧索引
+     * @param size 文件大小
+     * @return true 至少找到一个关键帧
+     */
+    bool rebuildIndex(qint64 size);
+
+    /**
+     * @brief 读取 4 字节格子编号
+     * @param pos 输出坐标
+     * @return true 未越界且在棋盘内
+     */
+    bool readCell(QPoint* pos);
+
+    QFile file_;                ///< 录像文件
+    const uchar* data_;         ///< 映射后的文件起始地址
+    const uchar* index_;        ///< 索引起始地址（映射内存或 rebuiltIndex_）
+    QByteArray rebuiltIndex_;   ///< 重建的索引（文件自带索引时为空）
+    qint64 recordsEnd_;         ///< 记录区结束偏移
+    qint64 cursor_;             ///< 下一条记录的偏移
+    qint64 frameCount_;         ///< 总帧数
+    qint64 keyframeCount_;      ///< 关键帧数
+    int boardWidth_;            ///< 棋盘宽度
+    int boardHeight_;           ///< 棋盘高度
+    ReplayFrame current_;       ///< 当前帧
+};
+
+}  // namespace SnakeGame
+
+#endif  // REPLAYREADER_H
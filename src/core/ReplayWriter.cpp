@@ -0,0 +1,178 @@
+/**
+ * @file ReplayWriter.cpp
+ * @brief 录像写入实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ReplayWriter.h"
+#include "GameLogic.h"
+#include "ReplayReader.h"
+#include <QtEndian>
+
+namespace SnakeGame {
+
+ReplayWriter::ReplayWriter(int keyframeInterval)
+    : frames_(0)
+    , offset_(0)
+    , keyframeInterval_(qMax(keyframeInterval, 1))
+    , sinceKeyframe_(0)
+    , boardWidth_(0)
+    , boardHeight_(0)
+    , failed_(false)
+{
+}
+
+ReplayWriter::~ReplayWriter()
+{
+    close();
+}
+
+bool ReplayWriter::open(const QString& path, int width, int height)
+{
+    close();
+
+    if (width <= 0 || height <= 0 || qint64(width) * height > (qint64(1) << 32)) {
+        return false;
+    }
+
+    file_.setFileName(path);
+    if (!file_.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    index_.clear();
+    frames_ = 0;
+    offset_ = 0;
+    sinceKeyframe_ = 0;
+    boardWidth_ = width;
+    boardHeight_ = height;
+    failed_ = false;
+
+    uchar header[ReplayReader::kHeaderSize];
+    qToLittleEndian<quint32>(ReplayReader::kMagic, header);
+    qToLittleEndian<quint32>(ReplayReader::kVersion, header + 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(width), header + 8);
+    qToLittleEndian<quint32>(static_cast<quint32>(height), header + 12);
+    put(header, sizeof(header));
+    return !failed_;
+}
+
+bool ReplayWriter::close()
+{
+    if (!file_.isOpen()) {
+        return false;
+    }
+
+    // 索引按写入顺序即帧号递增，尾部记下总帧数和索引条数
+    for (const IndexEntry& entry : index_) {
+        uchar record[ReplayReader::kIndexEntrySize];
+        qToLittleEndian<quint64>(static_cast<quint64>(entry.frame), record);
+        qToLittleEndian<quint64>(static_cast<quint64>(entry.offset), record + 8);
+        put(record, sizeof(record));
+    }
+
+    uchar trailer[ReplayReader::kTrailerSize] = {};
+    qToLittleEndian<quint64>(static_cast<quint64>(frames_), trailer);
+    qToLittleEndian<quint64>(static_cast<quint64>(index_.size()), trailer + 8);
+    qToLittleEndian<quint32>(ReplayReader::kIndexMagic, trailer + 16);
+    put(trailer, sizeof(trailer));
+
+    file_.close();
+    const bool ok = !failed_ && !index_.empty();
+    index_.clear();
+    return ok;
+}
+
+void ReplayWriter::writeKeyframe(const GameLogic& game)
+{
+    if (!file_.isOpen() || failed_) {
+        return;
+    }
+    if (game.getBoardWidth() != boardWidth_ || game.getBoardHeight() != boardHeight_) {
+        // 棋盘尺寸与文件头不符时无法编码格子，停止录制
+        failed_ = true;
+        return;
+    }
+
+    appendKeyframe(game, frames_);
+    ++frames_;
+}
+
+void ReplayWriter::writeTick(const GameLogic& game, const RewindBuffer::Delta& delta)
+{
+    // 第一个关键帧之前的增量没有起点，丢弃
+    if (!file_.isOpen() || failed_ || index_.empty()) {
+        return;
+    }
+
+    if (!delta.grew) {
+        const uchar type = ReplayReader::RecordMove;
+        put(&type, 1);
+        putCell(delta.head);
+    } else {
+        const QVector<QPoint>& foods = game.getFoodPositions();
+        uchar record[13];
+        record[0] = ReplayReader::RecordGrow;
+        qToLittleEndian<quint32>(static_cast<quint32>(delta.head.y() * boardWidth_ + delta.head.x()),
+                                 record + 1);
+        qToLittleEndian<quint32>(static_cast<quint32>(delta.eatenIndex), record + 5);
+        qToLittleEndian<qint32>(delta.scoreDelta, record + 9);
+        put(record, sizeof(record));
+
+        // 新生成的食物位于列表末尾
+        uchar count[4];
+        qToLittleEndian<quint32>(static_cast<quint32>(delta.spawned), count);
+        put(count, sizeof(count));
+        for (int i = foods.size() - delta.spawned; i < foods.size(); ++i) {
+            putCell(foods[i]);
+        }
+    }
+    ++frames_;
+
+    if (++sinceKeyframe_ >= keyframeInterval_) {
+        appendKeyframe(game, frames_ - 1);
+    }
+}
+
+void ReplayWriter::appendKeyframe(const GameLogic& game, qint64 frame)
+{
+    const QVector<QPoint>& body = game.getSnakeBody();
+    const QVector<QPoint>& foods = game.getFoodPositions();
+
+    index_.push_back({frame, offset_});
+    sinceKeyframe_ = 0;
+
+    uchar record[22];
+    record[0] = ReplayReader::RecordKeyframe;
+    qToLittleEndian<quint64>(static_cast<quint64>(frame), record + 1);
+    qToLittleEndian<qint32>(game.getScore(), record + 9);
+    record[13] = static_cast<uchar>(game.getDirection());
+    qToLittleEndian<quint32>(static_cast<quint32>(body.size()), record + 14);
+    qToLittleEndian<quint32>(static_cast<quint32>(foods.size()), record + 18);
+    put(record, sizeof(record));
+
+    for (const QPoint& pos : body) {
+        putCell(pos);
+    }
+    for (const QPoint& pos : foods) {
+        putCell(pos);
+    }
+}
+
+void ReplayWriter::put(const uchar* data, qint64 size)
+{
+    if (file_.write(reinterpret_cast<const char*>(data), size) != size) {
+        failed_ = true;
+    }
+    offset_ += size;
+}
+
+void ReplayWriter::putCell(const QPoint& pos)
+{
+    uchar cell[4];
+    qToLittleEndian<quint32>(static_cast<quint32>(pos.y() * boardWidth_ + pos.x()), cell);
+    put(cell, sizeof(cell));
+}
+
+}  // namespace SnakeGame
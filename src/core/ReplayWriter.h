@@ -0,0 +1,118 @@
+/**
+ * @file ReplayWriter.h
+ * @brief 录像写入 - 逐帧记录增量并定期写入关键帧，关闭时追加索引
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef REPLAYWRITER_H
+#define REPLAYWRITER_H
+
+#include <QFile>
+#include <QPoint>
+#include <QString>
+#include <QtGlobal>
+#include <vector>
+
+#include "Constants.h"
+#include "RewindBuffer.h"
+
+namespace SnakeGame {
+
+class GameLogic;
+
+/**
+ * @brief 录像写入器
+ *
+ * 由 GameLogic::setRecorder() 挂接：开局和回退后写入关键帧，每帧写入一条增量
+ * （普通移动 5 字节），每隔 keyframeInterval 帧再补一个关键帧。
+ * close() 时在文件末尾追加关键帧索引，ReplayReader 据此二分跳转。
+ * 文件格式见 ReplayReader。
+ */
+class ReplayWriter {
+public:
+    /**
+     * @brief 构造函数
+     * @param keyframeInterval 周期性关键帧的间隔（帧），跳转时最多前滚这么多帧
+     */
+    explicit ReplayWriter(int keyframeInterval = Constants::kReplayKeyframeInterval);
+    ~ReplayWriter();
+
+    ReplayWriter(const ReplayWriter&) = delete;
+    ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+    /**
+     * @brief 创建录像文件并写入头部
+     * @param path 文件路径
+     * @param width 棋盘宽度
+     * @param height 棋盘高度
+     * @return true 创建成功
+     */
+    bool open(const QString& path, int width, int height);
+
+    /**
+     * @brief 追加索引与尾部并关闭文件
+     * @return true 全部写入成功（未打开时返回 false）
+     */
+    bool close();
+
+    /**
+     * @brief 是否已打开
+     */
+    bool isOpen() const { return file_.isOpen(); }
+
+    /**
+     * @brief 写入当前局面作为新的一帧（开局、回退后调用）
+     * @param game 游戏逻辑
+     */
+    void writeKeyframe(const GameLogic& game);
+
+    /**
+     * @brief 写入一帧增量，到达间隔时补写关键帧
+     * @param game 已应用本帧增量的游戏逻辑
+     * @param delta 本帧增量（与回退缓冲区相同）
+     */
+    void writeTick(const GameLogic& game, const RewindBuffer::Delta& delta);
+
+    /**
+     * @brief 已写入的帧数
+     */
+    qint64 frameCount() const { return frames_; }
+
+private:
+    /**
+     * @brief 写入关键帧记录并加入索引
+     * @param game 游戏逻辑
+     * @param frame 关键帧的帧号
+     */
+    void appendKeyframe(const GameLogic& game, qint64 frame);
+
+    /**
+     * @brief 写入原始字节，失败时记下错误
+     */
+    void put(const uchar* data, qint64 size);
+
+    /**
+     * @brief 写入格子编号
+     */
+    void putCell(const QPoint& pos);
+
+    struct IndexEntry {
+        qint64 frame;       ///< 关键帧帧号
+        qint64 offset;      ///< 记录偏移
+    };
+
+    QFile file_;                        ///< 录像文件
+    std::vector<IndexEntry> index_;     ///< 关键帧索引，close() 时写出
+    qint64 frames_;                     ///< 已写入的帧数
+    qint64 offset_;                     ///< 下一条记录的偏移
+    int keyframeInterval_;              ///< 周期性关键帧间隔
+    int sinceKeyframe_;                 ///< 距上一个关键帧的帧数
+    int boardWidth_;                    ///< 棋盘宽度
+    int boardHeight_;                   ///< 棋盘高度
+    bool failed_;                       ///< 是否出现写入错误
+};
+
+}  // namespace SnakeGame
+
+#endif  // REPLAYWRITER_H
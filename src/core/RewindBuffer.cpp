@@ -0,0 +1,56 @@
+/**
+ * @file RewindBuffer.cpp
+ * @brief 回退缓冲区实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "RewindBuffer.h"
+
+namespace SnakeGame {
+
+RewindBuffer::RewindBuffer(int capacity)
+    : next_(0)
+    , size_(0)
+{
+    setCapacity(capacity);
+}
+
+void RewindBuffer::setCapacity(int capacity)
+{
+    std::vector<Delta>(static_cast<size_t>(qMax(capacity, 0))).swap(ring_);
+    clear();
+}
+
+void RewindBuffer::clear()
+{
+    next_ = 0;
+    size_ = 0;
+}
+
+void RewindBuffer::push(const Delta& delta)
+{
+    if (ring_.empty()) {
+        return;
+    }
+
+    ring_[static_cast<size_t>(next_)] = delta;
+    next_ = (next_ + 1) % capacity();
+    if (size_ < capacity()) {
+        ++size_;
+    }
+}
+
+RewindBuffer::Delta RewindBuffer::pop()
+{
+    next_ = (next_ + capacity() - 1) % capacity();
+    --size_;
+    return ring_[static_cast<size_t>(next_)];
+}
+
+const RewindBuffer::Delta& RewindBuffer::back() const
+{
+    return ring_[static_cast<size_t>((next_ + capacity() - 1) % capacity())];
+}
+
+}  // namespace SnakeGame
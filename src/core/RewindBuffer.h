@@ -0,0 +1,101 @@
+/**
+ * @file RewindBuffer.h
+ * @brief 回退缓冲区 - 定长环形队列保存最近若干帧的增量
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef REWINDBUFFER_H
+#define REWINDBUFFER_H
+
+#include <QPoint>
+#include <QtGlobal>
+#include <vector>
+
+namespace SnakeGame {
+
+/**
+ * @brief 最近 N 帧的逐帧增量
+ *
+ * 每帧只记录一条固定大小的 Delta（新蛇头、离开的蛇尾、被吃掉的食物下标、
+ * 新生成的食物数、分数变化），内存为 O(N)，与蛇长无关。
+ * 环满后新的一帧覆盖最旧的一帧；容量在 setCapacity() 时一次分配，
+ * 之后 push()/pop() 不再分配内存。
+ */
+class RewindBuffer {
+public:
+    /**
+     * @brief 一帧的增量
+     */
+    struct Delta {
+        QPoint head;            ///< 本帧新增的蛇头（增长时也是被吃掉的食物）
+        QPoint tail;            ///< 离开的蛇尾（增长时蛇尾不动，无意义）
+        qint32 scoreDelta;      ///< 分数变化
+        qint32 eatenIndex;      ///< 被吃掉的食物下标（未吃到时为 -1）
+        qint32 spawned;         ///< 本帧新生成的食物数（位于食物列表末尾）
+        bool grew;              ///< 是否增长（吃到食物）
+    };
+
+    /**
+     * @brief 构造函数
+     * @param capacity 最多保存的帧数，0 表示不记录
+     */
+    explicit RewindBuffer(int capacity = 0);
+
+    /**
+     * @brief 设置容量并清空
+     * @param capacity 最多保存的帧数，0 表示不记录并释放内存
+     */
+    void setCapacity(int capacity);
+
+    /**
+     * @brief 清空已保存的帧（保留容量）
+     */
+    void clear();
+
+    /**
+     * @brief 记录一帧，环满时覆盖最旧的一帧
+     */
+    void push(const Delta& delta);
+
+    /**
+     * @brief 取出最新的一帧（须非空）
+     */
+    Delta pop();
+
+    /**
+     * @brief 最新的一帧（须非空）
+     */
+    const Delta& back() const;
+
+    /**
+     * @brief 最多保存的帧数
+     */
+    int capacity() const { return static_cast<int>(ring_.size()); }
+
+    /**
+     * @brief 当前可回退的帧数
+     */
+    int size() const { return size_; }
+
+    /**
+     * @brief 是否没有可回退的帧
+     */
+    bool isEmpty() const { return size_ == 0; }
+
+    /**
+     * @brief 环占用的字节数
+     */
+    qsizetype memoryBytes() const {
+        return static_cast<qsizetype>(ring_.capacity() * sizeof(Delta));
+    }
+
+private:
+    std::vector<Delta> ring_;   ///< 环形存储
+    int next_;                  ///< 下一次写入的位置
+    int size_;                  ///< 已保存的帧数
+};
+
+}  // namespace SnakeGame
+
+#endif  // REWINDBUFFER_H
@@ -0,0 +1,208 @@
+/**
+ * @file SimulationThread.cpp
+ * @brief 模拟线程实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "SimulationThread.h"
+#include <QMetaObject>
+#include <QMutexLocker>
+
+namespace SnakeGame {
+
+SimulationThread::SimulationThread(int boardWidth, int boardHeight, QObject* parent)
+    : QObject(parent)
+    , gameLogic_(new GameLogic(boardWidth, boardHeight))
+    , boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , drainScheduled_(false)
+    , outbox_(StateFrame(boardWidth * boardHeight))
+    , latestState_(static_cast<int>(GameState::Ready))
+    , publishPending_(false)
+{
+    connectOutbox();
+
+    // GameLogic 连同其定时器一起移入模拟线程，随线程结束销毁
+    gameLogic_->moveToThread(&thread_);
+    connect(&thread_, &QThread::finished, gameLogic_, &QObject::deleteLater);
+
+    thread_.setObjectName(QStringLiteral("SnakeSimulationThread"));
+    thread_.start();
+}
+
+SimulationThread::~SimulationThread()
+{
+    thread_.quit();
+    thread_.wait();
+}
+
+// ==================== 命令收件箱 ====================
+
+void SimulationThread::postDirection(Direction direction)
+{
+    post({CommandType::SetDirection, direction, 0});
+}
+
+void SimulationThread::postStart()
+{
+    post({CommandType::Start, Direction::Right, 0});
+}
+
+void SimulationThread::postPause()
+{
+    post({CommandType::Pause, Direction::Right, 0});
+}
+
+void SimulationThread::postResume()
+{
+    post({CommandType::Resume, Direction::Right, 0});
+}
+
+void SimulationThread::postReset()
+{
+    post({CommandType::Reset, Direction::Right, 0});
+}
+
+void SimulationThread::postRewind(int ticks)
+{
+    post({CommandType::Rewind, Direction::Right, ticks});
+}
+
+void SimulationThread::postRewindCapacity(int ticks)
+{
+    post({CommandType::SetRewindCapacity, Direction::Right, ticks});
+}
+
+void SimulationThread::postController(std::unique_ptr<Controller> controller)
+{
+    Controller* raw = controller.release();
+    QMetaObject::invokeMethod(gameLogic_, [this, raw]() {
+        gameLogic_->setController(std::unique_ptr<Controller>(raw));
+    }, Qt::QueuedConnection);
+}
+
+void SimulationThread::post(const Command& command)
+{
+    {
+        QMutexLocker locker(&inboxMutex_);
+        inbox_.append(command);
+        if (drainScheduled_) {
+            return;
+        }
+        drainScheduled_ = true;
+    }
+
+    // 以 gameLogic_ 为上下文，回调在模拟线程中执行
+    QMetaObject::invokeMethod(gameLogic_, [this]() { drainCommands(); }, Qt::QueuedConnection);
+}
+
+void SimulationThread::drainCommands()
+{
+    QVector<Command> commands;
+    {
+        QMutexLocker locker(&inboxMutex_);
+        commands.swap(inbox_);
+        drainScheduled_ = false;
+    }
+
+    for (const Command& command : commands) {
+        switch (command.type) {
+            case CommandType::SetDirection:
+                gameLogic_->setDirection(command.direction);
+                break;
+            case CommandType::Start:
+                gameLogic_->startGame();
+                break;
+            case CommandType::Pause:
+                gameLogic_->pauseGame();
+                break;
+            case CommandType::Resume:
+                gameLogic_->resumeGame();
+                break;
+            case CommandType::Reset:
+                gameLogic_->resetGame();
+                break;
+            case CommandType::Rewind:
+                gameLogic_->rewind(command.ticks);
+                break;
+            case CommandType::SetRewindCapacity:
+                gameLogic_->setRewindCapacity(command.ticks);
+                break;
+        }
+    }
+}
+
+// ==================== 状态发件箱 ====================
+
+bool SimulationThread::takeSnapshot(GameSnapshot* snapshot)
+{
+    // 先清除通知标志再取帧（均为 seq_cst）：模拟线程若看到标志仍未清除而不再通知，
+    // 它在此之前提交的帧一定能被下面取到
+    publishPending_.store(false);
+
+    const StateFrame* frame = outbox_.acquireLatest();
+    if (!frame) {
+        return false;
+    }
+    frame->copyTo(snapshot);
+    return true;
+}
+
+GameState SimulationThread::latestState() const
+{
+    return static_cast<GameState>(latestState_.load(std::memory_order_acquire));
+}
+
+quint64 SimulationThread::framesPublished() const
+{
+    return outbox_.published();
+}
+
+quint64 SimulationThread::framesCoalesced() const
+{
+    return outbox_.overwritten();
+}
+
+int SimulationThread::getBoardWidth() const
+{
+    return boardWidth_;
+}
+
+int SimulationThread::getBoardHeight() const
+{
+    return boardHeight_;
+}
+
+void SimulationThread::connectOutbox()
+{
+    // 直接连接：在模拟线程中执行。snakeMoved 是每帧最后一个信号，
+    // 分数和食物在它之前已经更新；状态变化（暂停/结束）单独发布
+    connect(gameLogic_, &GameLogic::snakeMoved, gameLogic_, [this]() {
+        publishFrame();
+    }, Qt::DirectConnection);
+
+    connect(gameLogic_, &GameLogic::gameStateChanged, gameLogic_, [this](GameState state) {
+        latestState_.store(static_cast<int>(state), std::memory_order_release);
+        publishFrame();
+    }, Qt::DirectConnection);
+}
+
+void SimulationThread::publishFrame()
+{
+    // 写入槽位总是可用，UI 未读的旧帧被覆盖，最后的状态（暂停/结束）不会丢失
+    StateFrame* frame = outbox_.writeSlot();
+    frame->setBody(gameLogic_->getSnakeBody());
+    frame->setFoods(gameLogic_->getFoodPositions());
+    frame->state = gameLogic_->getState();
+    frame->score = gameLogic_->getScore();
+    frame->rewinds = gameLogic_->getRewindCount();
+    outbox_.publish();
+
+    // UI 尚未读取上一帧时不再重复排队
+    if (!publishPending_.exchange(true)) {
+        emit snapshotPublished();
+    }
+}
+
+}  // namespace SnakeGame
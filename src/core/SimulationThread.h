@@ -0,0 +1,207 @@
+/**
+ * @file SimulationThread.h
+ * @brief 模拟线程 - 在独立线程中运行 GameLogic
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef SIMULATIONTHREAD_H
+#define SIMULATIONTHREAD_H
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QVector>
+#include <atomic>
+#include <memory>
+
+#include "GameLogic.h"
+#include "GameSnapshot.h"
+#include "TripleBuffer.h"
+#include "Controller.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 模拟线程 - 让 GameLogic 及其定时器脱离 GUI 线程运行
+ *
+ * - 命令收件箱：任意线程投递方向/开始/暂停等命令，
+ *   在模拟线程中按顺序批量执行
+ * - 状态发件箱：模拟线程每帧把完整状态写入无锁三缓冲（TripleBuffer），
+ *   并发出 snapshotPublished()；UI 只读取最新一帧，读取前不会重复通知。
+ *   UI 来不及读取时未读的旧帧被新帧覆盖，最后提交的状态总能被读到。
+ *   发布时只复制坐标到预分配的帧中，模拟线程不会被 UI 阻塞，也不分配内存
+ *
+ * 界面卡顿（调整窗口、模态对话框等）不再影响游戏节拍。
+ */
+class SimulationThread : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数 - 创建 GameLogic 并启动模拟线程
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param parent 父对象
+     */
+    explicit SimulationThread(int boardWidth = Constants::kDefaultBoardWidth,
+                              int boardHeight = Constants::kDefaultBoardHeight,
+                              QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数 - 停止模拟线程
+     */
+    ~SimulationThread() override;
+
+    // ==================== 命令收件箱（任意线程） ====================
+
+    /**
+     * @brief 投递方向命令
+     * @param direction 新方向
+     */
+    void postDirection(Direction direction);
+
+    /**
+     * @brief 投递开始游戏命令
+     */
+    void postStart();
+
+    /**
+     * @brief 投递暂停命令
+     */
+    void postPause();
+
+    /**
+     * @brief 投递恢复命令
+     */
+    void postResume();
+
+    /**
+     * @brief 投递重置命令
+     */
+    void postReset();
+
+    /**
+     * @brief 投递回退命令
+     * @param ticks 回退帧数
+     */
+    void postRewind(int ticks);
+
+    /**
+     * @brief 投递设置回退缓冲区容量的命令
+     * @param ticks 最多可回退的帧数
+     */
+    void postRewindCapacity(int ticks);
+
+    /**
+     * @brief 在模拟线程中设置自动驾驶控制器
+     * @param controller 控制器，传入空指针恢复玩家操作
+     */
+    void postController(std::unique_ptr<Controller> controller);
+
+    // ==================== 状态发件箱（任意线程） ====================
+
+    /**
+     * @brief 取出最新一帧，并允许下一次 snapshotPublished() 通知（仅限单一消费线程）
+     * @param snapshot 输出快照，复用其已有容量
+     * @return true 表示有新帧
+     */
+    bool takeSnapshot(GameSnapshot* snapshot);
+
+    /**
+     * @brief 获取最新发布的游戏状态
+     * @return 游戏状态
+     */
+    GameState latestState() const;
+
+    /**
+     * @brief 已发布的帧数
+     * @return 帧数
+     */
+    quint64 framesPublished() const;
+
+    /**
+     * @brief 未被读取就被更新的帧覆盖的帧数
+     * @return 帧数
+     */
+    quint64 framesCoalesced() const;
+
+    /**
+     * @brief 获取游戏区域宽度
+     * @return 宽度（格数）
+     */
+    int getBoardWidth() const;
+
+    /**
+     * @brief 获取游戏区域高度
+     * @return 高度（格数）
+     */
+    int getBoardHeight() const;
+
+signals:
+    /**
+     * @brief 有新快照可读时发出（来自模拟线程，未读取前不会重复发出）
+     */
+    void snapshotPublished();
+
+private:
+    /**
+     * @brief 命令类型
+     */
+    enum class CommandType {
+        SetDirection,
+        Start,
+        Pause,
+        Resume,
+        Reset,
+        Rewind,
+        SetRewindCapacity
+    };
+
+    /**
+     * @brief 收件箱中的一条命令
+     */
+    struct Command {
+        CommandType type;
+        Direction direction;
+        int ticks;              ///< 帧数（Rewind / SetRewindCapacity）
+    };
+
+    QThread thread_;                    ///< 模拟线程
+    GameLogic* gameLogic_;              ///< 游戏逻辑（运行在模拟线程中）
+    int boardWidth_;                    ///< 游戏区域宽度
+    int boardHeight_;                   ///< 游戏区域高度
+
+    QMutex inboxMutex_;                 ///< 保护收件箱
+    QVector<Command> inbox_;            ///< 待执行命令
+    bool drainScheduled_;               ///< 模拟线程中是否已排队处理收件箱
+
+    TripleBuffer<StateFrame> outbox_;   ///< 状态帧三缓冲（模拟线程写，UI 线程读）
+    std::atomic<int> latestState_;      ///< 最新游戏状态
+    std::atomic<bool> publishPending_;  ///< 是否有未读取的通知
+
+    /**
+     * @brief 投递命令
+     * @param command 命令
+     */
+    void post(const Command& command);
+
+    /**
+     * @brief 执行收件箱中的所有命令（模拟线程中执行）
+     */
+    void drainCommands();
+
+    /**
+     * @brief 连接 GameLogic 信号到发件箱
+     */
+    void connectOutbox();
+
+    /**
+     * @brief 将 GameLogic 当前状态写入状态帧环（模拟线程中执行）
+     */
+    void publishFrame();
+};
+
+}  // namespace SnakeGame
+
+#endif  // SIMULATIONTHREAD_H
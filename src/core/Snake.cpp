@@ -6,52 +6,127 @@
  */
 
 #include "Snake.h"
-#include <QDebug>
+#include "EventLog.h"
+#include <algorithm>
 
 namespace SnakeGame {
 
 Snake::Snake(const QPoint& startPos, int initialLength, Direction initialDirection)
-    : currentDirection_(initialDirection)
+    : expandedValid_(false)
+    , compact_(false)
+    , capacity_(0)
+    , currentDirection_(initialDirection)
 {
     reset(startPos, initialLength, initialDirection);
 }
 
 void Snake::move()
 {
-    if (body_.isEmpty()) {
-        qWarning() << "Snake::move() called on empty snake";
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::move() called on empty snake");
         return;
     }
 
     // 计算新蛇头位置
-    QPoint newHead = calculateNextHead();
+    move(calculateNextHead());
+}
 
-    // 在头部插入新位置
-    body_.prepend(newHead);
+void Snake::move(const QPoint& newHead)
+{
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::move() called on empty snake");
+        return;
+    }
 
-    // 移除尾部
-    body_.removeLast();
+    if (compact_) {
+        // 新蛇头即蛇头沿当前方向的相邻格，只需写入一个方向码
+        compactBody_.move(currentDirection_);
+        expandedValid_ = false;
+        return;
+    }
+
+    // 整体后移一节覆盖蛇尾，再写入新蛇头；长度不变，不会重新分配
+    QPoint* data = body_.data();
+    std::move_backward(data, data + body_.size() - 1, data + body_.size());
+    data[0] = newHead;
 }
 
 void Snake::grow()
 {
-    if (body_.isEmpty()) {
-        qWarning() << "Snake::grow() called on empty snake";
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::grow() called on empty snake");
         return;
     }
 
     // 计算新蛇头位置
-    QPoint newHead = calculateNextHead();
+    grow(calculateNextHead());
+}
 
-    // 在头部插入新位置，不移除尾部
-    body_.prepend(newHead);
+void Snake::grow(const QPoint& newHead)
+{
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::grow() called on empty snake");
+        return;
+    }
+
+    if (compact_) {
+        compactBody_.grow(currentDirection_);
+        expandedValid_ = false;
+        return;
+    }
+
+    // 在尾部补一节后整体后移，再写入新蛇头；容量已预留时不会重新分配
+    const QPoint tail = body_.last();
+    body_.append(tail);
+    QPoint* data = body_.data();
+    std::move_backward(data, data + body_.size() - 2, data + body_.size() - 1);
+    data[0] = newHead;
+}
+
+void Snake::undoMove(const QPoint& tail)
+{
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::undoMove() called on empty snake");
+        return;
+    }
+
+    if (compact_) {
+        compactBody_.popHead();
+        compactBody_.pushTail(tail);
+        expandedValid_ = false;
+        return;
+    }
+
+    // 整体前移一节覆盖蛇头，再把蛇尾写回末尾；长度不变
+    QPoint* data = body_.data();
+    std::move(data + 1, data + body_.size(), data);
+    data[body_.size() - 1] = tail;
+}
+
+void Snake::undoGrow()
+{
+    if (getLength() < 2) {
+        SNAKE_LOG_WARNING("Snake::undoGrow() called on a snake that cannot shrink");
+        return;
+    }
+
+    if (compact_) {
+        compactBody_.popHead();
+        expandedValid_ = false;
+        return;
+    }
+
+    QPoint* data = body_.data();
+    std::move(data + 1, data + body_.size(), data);
+    body_.removeLast();
 }
 
 bool Snake::setDirection(Direction newDirection)
 {
     // 防御性校验：禁止反向移动
     if (DirectionHelper::isOpposite(currentDirection_, newDirection)) {
-        qWarning() << "Attempted reverse direction, ignoring";
+        SNAKE_LOG_DEBUG("Attempted reverse direction %lld -> %lld, ignoring",
+                        static_cast<qint64>(currentDirection_), static_cast<qint64>(newDirection));
         return false;
     }
 
@@ -59,18 +134,39 @@ bool Snake::setDirection(Direction newDirection)
     return true;
 }
 
+void Snake::restoreDirection(Direction direction)
+{
+    currentDirection_ = direction;
+}
+
 QPoint Snake::getHead() const
 {
-    if (body_.isEmpty()) {
-        qWarning() << "Snake::getHead() called on empty snake";
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::getHead() called on empty snake");
+        return QPoint(-1, -1);
+    }
+    return compact_ ? compactBody_.head() : body_.first();
+}
+
+QPoint Snake::getTail() const
+{
+    if (getLength() == 0) {
+        SNAKE_LOG_WARNING("Snake::getTail() called on empty snake");
         return QPoint(-1, -1);
     }
-    return body_.first();
+    return compact_ ? compactBody_.tail() : body_.last();
 }
 
 const QVector<QPoint>& Snake::getBody() const
 {
-    return body_;
+    if (!compact_) {
+        return body_;
+    }
+    if (!expandedValid_) {
+        compactBody_.toVector(&expanded_);
+        expandedValid_ = true;
+    }
+    return expanded_;
 }
 
 Direction Snake::getDirection() const
@@ -80,13 +176,58 @@ Direction Snake::getDirection() const
 
 int Snake::getLength() const
 {
-    return body_.size();
+    return compact_ ? compactBody_.size() : body_.size();
+}
+
+void Snake::reserve(int capacity)
+{
+    capacity_ = capacity;
+    if (compact_) {
+        compactBody_.reserve(capacity);
+    } else {
+        body_.reserve(capacity);
+    }
+}
+
+void Snake::setCompact(bool compact)
+{
+    if (compact == compact_) {
+        return;
+    }
+
+    if (compact) {
+        compactBody_.reserve(capacity_);
+        compactBody_.reset(body_);
+        // 释放坐标列表的预留容量，紧凑存储的意义就在于不再占用它
+        QVector<QPoint>().swap(body_);
+    } else {
+        body_.reserve(capacity_);
+        compactBody_.toVector(&body_);
+        compactBody_.clear();
+        QVector<QPoint>().swap(expanded_);
+    }
+    expandedValid_ = false;
+    compact_ = compact;
+}
+
+qsizetype Snake::memoryBytes() const
+{
+    if (compact_) {
+        return compactBody_.memoryBytes();
+    }
+    return static_cast<qsizetype>(body_.capacity()) * static_cast<qsizetype>(sizeof(QPoint));
 }
 
 void Snake::reset(const QPoint& startPos, int initialLength, Direction initialDirection)
 {
-    body_.clear();
     currentDirection_ = initialDirection;
+    if (compact_) {
+        compactBody_.reset(startPos, initialLength, initialDirection);
+        expandedValid_ = false;
+        return;
+    }
+
+    body_.clear();
 
     // 根据初始方向生成蛇身
     // 蛇头在 startPos，身体向相反方向延伸
@@ -10,6 +10,7 @@
 
 #include <QVector>
 #include <QPoint>
+#include "CompactBody.h"
 #include "Direction.h"
 
 namespace SnakeGame {
@@ -21,6 +22,11 @@ namespace SnakeGame {
  * - 存储蛇身坐标
  * - 处理蛇的移动和生长
  * - 管理移动方向（含反向校验）
+ *
+ * 蛇身默认存为 QVector<QPoint>，移动时整体搬移一节（O(n)）。
+ * 开启紧凑存储后改用 CompactBody（每节 2 位），移动为 O(1)，
+ * getBody() 在需要时才展开为坐标列表；只读蛇头、蛇尾和长度的调用方不触发展开。
+ * 紧凑存储按方向码推算坐标，不支持越界回绕。
  */
 class Snake {
 public:
@@ -40,12 +46,35 @@ public:
      */
     void move();
 
+    /**
+     * @brief 移动蛇到指定的新蛇头（不增长）
+     * @param newHead 新蛇头坐标（如越界回绕后的坐标）
+     */
+    void move(const QPoint& newHead);
+
     /**
      * @brief 移动蛇并增长一节
      * 蛇头向当前方向移动一格，蛇尾保留
      */
     void grow();
 
+    /**
+     * @brief 移动蛇到指定的新蛇头并增长一节
+     * @param newHead 新蛇头坐标（如越界回绕后的坐标）
+     */
+    void grow(const QPoint& newHead);
+
+    /**
+     * @brief 撤销一次 move()：去掉蛇头，把离开的蛇尾接回
+     * @param tail 该次移动离开的蛇尾
+     */
+    void undoMove(const QPoint& tail);
+
+    /**
+     * @brief 撤销一次 grow()：去掉蛇头
+     */
+    void undoGrow();
+
     /**
      * @brief 设置移动方向
      * @param newDirection 新方向
@@ -53,15 +82,29 @@ public:
      */
     bool setDirection(Direction newDirection);
 
+    /**
+     * @brief 直接恢复移动方向（回退时使用，不做反向校验）
+     * @param direction 方向
+     */
+    void restoreDirection(Direction direction);
+
     /**
      * @brief 获取蛇头位置
      * @return 蛇头坐标
      */
     QPoint getHead() const;
 
+    /**
+     * @brief 获取蛇尾位置
+     * @return 蛇尾坐标
+     */
+    QPoint getTail() const;
+
     /**
      * @brief 获取蛇身坐标列表
-     * @return 蛇身坐标（body_[0] 为蛇头）
+     * @return 蛇身坐标（[0] 为蛇头）
+     *
+     * 紧凑存储下首次调用时展开（O(n)），蛇身变化前重复调用不再展开。
      */
     const QVector<QPoint>& getBody() const;
 
@@ -77,6 +120,31 @@ public:
      */
     int getLength() const;
 
+    /**
+     * @brief 预留蛇身容量
+     * @param capacity 最大节数（通常为棋盘格数）
+     *
+     * 预留后 move()/grow() 只在原缓冲区内搬移，不再分配内存。
+     * 若有接收方保存了 getBody() 的副本，下一次移动会因写时复制而重新分配。
+     */
+    void reserve(int capacity);
+
+    /**
+     * @brief 切换蛇身存储方式（保留当前蛇身）
+     * @param compact true 使用 CompactBody，false 使用 QVector<QPoint>
+     */
+    void setCompact(bool compact);
+
+    /**
+     * @brief 是否使用紧凑存储
+     */
+    bool isCompact() const { return compact_; }
+
+    /**
+     * @brief 蛇身存储占用的字节数（按已预留的容量计）
+     */
+    qsizetype memoryBytes() const;
+
     /**
      * @brief 重置蛇到初始状态
      * @param startPos 蛇头初始位置
@@ -88,7 +156,12 @@ public:
                Direction initialDirection = Direction::Right);
 
 private:
-    QVector<QPoint> body_;          ///< 蛇身坐标，body_[0] 为蛇头
+    QVector<QPoint> body_;          ///< 蛇身坐标，body_[0] 为蛇头（紧凑存储下不使用）
+    CompactBody compactBody_;       ///< 紧凑蛇身（紧凑存储下使用）
+    mutable QVector<QPoint> expanded_;  ///< 紧凑蛇身展开后的坐标（getBody() 缓存）
+    mutable bool expandedValid_;    ///< expanded_ 是否与紧凑蛇身一致
+    bool compact_;                  ///< 是否使用紧凑存储
+    int capacity_;                  ///< 已预留的最大节数
     Direction currentDirection_;    ///< 当前移动方向
 
     /**
@@ -0,0 +1,174 @@
+/**
+ * @file Trace.cpp
+ * @brief 时间线追踪实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "Trace.h"
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QFile>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief 一个完整片段（Chrome Trace 的 "X" 事件）
+ */
+struct TraceEvent {
+    const char* name;   ///< 片段名
+    qint64 begin;       ///< 开始时间（纳秒）
+    qint64 duration;    ///< 持续时间（纳秒）
+};
+
+/**
+ * @brief 单个线程的事件缓冲区，只由所属线程写入
+ */
+struct ThreadBuffer {
+    std::unique_ptr<TraceEvent[]> events;   ///< 定长事件数组
+    std::atomic<int> count{0};              ///< 已发布的事件数
+    std::atomic<quint64> dropped{0};        ///< 写满后丢弃的事件数
+    int tid = 0;                            ///< 导出时使用的线程编号
+};
+
+/**
+ * @brief 所有线程缓冲区的登记表（只在线程首次记录和导出时加锁）
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    QElapsedTimer clock;
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+// 缓冲区归登记表所有、进程结束前不释放，线程退出后事件仍可导出
+thread_local ThreadBuffer* localBuffer = nullptr;
+
+ThreadBuffer* threadBuffer()
+{
+    if (!localBuffer) {
+        Registry& reg = registry();
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events.reset(new TraceEvent[Trace::kEventsPerThread]);
+
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffer->tid = static_cast<int>(reg.buffers.size()) + 1;
+        localBuffer = buffer.get();
+        reg.buffers.push_back(std::move(buffer));
+    }
+    return localBuffer;
+}
+
+}  // namespace
+
+std::atomic<bool> Trace::enabled_{false};
+
+void Trace::start()
+{
+    Registry& reg = registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (const auto& buffer : reg.buffers) {
+            buffer->count.store(0, std::memory_order_relaxed);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+        reg.clock.start();
+    }
+    enabled_.store(true, std::memory_order_release);
+}
+
+void Trace::stop()
+{
+    enabled_.store(false, std::memory_order_release);
+}
+
+qint64 Trace::now()
+{
+    return registry().clock.nsecsElapsed();
+}
+
+void Trace::record(const char* name, qint64 begin, qint64 end)
+{
+    ThreadBuffer* buffer = threadBuffer();
+    const int count = buffer->count.load(std::memory_order_relaxed);
+    if (count >= kEventsPerThread) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->events[count] = {name, begin, end - begin};
+    // 先写事件再发布计数，导出线程按计数读取时看到的都是完整事件
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+quint64 Trace::droppedCount()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    quint64 dropped = 0;
+    for (const auto& buffer : reg.buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+bool Trace::writeJson(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    QByteArray out;
+    out.reserve(1 << 16);
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    bool ok = true;
+    char line[256];
+
+    for (const auto& buffer : reg.buffers) {
+        const int count = buffer->count.load(std::memory_order_acquire);
+        std::snprintf(line, sizeof(line),
+                      "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                      "\"args\":{\"name\":\"thread %d\"}}",
+                      first ? "" : ",\n", buffer->tid, buffer->tid);
+        out.append(line);
+        first = false;
+
+        for (int i = 0; i < count; ++i) {
+            const TraceEvent& event = buffer->events[i];
+            // 时间单位为微秒，保留纳秒精度
+            std::snprintf(line, sizeof(line),
+                          ",\n{\"name\":\"%s\",\"cat\":\"snake\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                          "\"ts\":%.3f,\"dur\":%.3f}",
+                          event.name, buffer->tid, event.begin / 1000.0, event.duration / 1000.0);
+            out.append(line);
+
+            if (out.size() >= (1 << 16)) {
+                ok = ok && file.write(out) == out.size();
+                out.clear();
+            }
+        }
+    }
+
+    out.append("\n]}\n");
+    ok = ok && file.write(out) == out.size();
+    file.close();
+    return ok;
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,109 @@
+/**
+ * @file Trace.h
+ * @brief 时间线追踪 - 作用域计时片段，导出为 Chrome Trace Event JSON
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+namespace SnakeGame {
+
+/**
+ * @brief 时间线追踪
+ *
+ * 默认关闭。start() 之后，每个线程第一次记录时分配一块定长事件缓冲区，
+ * 之后只由该线程写入、以原子计数发布，写入路径无锁、不分配内存；
+ * 缓冲区写满后新事件丢弃并计数。writeJson() 导出为 Chrome Trace Event JSON，
+ * 可直接在 chrome://tracing 或 Perfetto 中打开，线程仍在记录时也可以导出。
+ */
+class Trace {
+public:
+    static constexpr int kEventsPerThread = 1 << 18;   ///< 每个线程最多保存的事件数
+
+    /**
+     * @brief 是否正在追踪（关闭时每个片段只有这一次原子读取）
+     */
+    static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 开始追踪，时间从此刻算起
+     *
+     * 会清空之前的事件，须在其他线程开始记录之前调用（通常在程序启动时）。
+     */
+    static void start();
+
+    /**
+     * @brief 停止追踪（已记录的事件保留到下一次 start()）
+     */
+    static void stop();
+
+    /**
+     * @brief 导出为 Chrome Trace Event JSON
+     * @param path 文件路径
+     * @return true 写入成功
+     */
+    static bool writeJson(const QString& path);
+
+    /**
+     * @brief 自 start() 起经过的纳秒数
+     */
+    static qint64 now();
+
+    /**
+     * @brief 记录一个完整片段
+     * @param name 片段名（须为静态字符串，不含引号和反斜杠）
+     * @param begin 开始时间（now() 的返回值）
+     * @param end 结束时间
+     */
+    static void record(const char* name, qint64 begin, qint64 end);
+
+    /**
+     * @brief 因缓冲区写满而丢弃的事件数
+     */
+    static quint64 droppedCount();
+
+private:
+    static std::atomic<bool> enabled_;      ///< 是否正在追踪
+};
+
+/**
+ * @brief 作用域计时片段：构造时开始、析构时记录
+ *
+ * 追踪关闭时构造只读一次开关，析构只判断一次标记。
+ */
+class TraceSpan {
+public:
+    /**
+     * @brief 构造函数
+     * @param name 片段名（须为静态字符串）
+     */
+    explicit TraceSpan(const char* name)
+        : name_(name)
+        , begin_(Trace::isEnabled() ? Trace::now() : -1)
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if (begin_ >= 0) {
+            Trace::record(name_, begin_, Trace::now());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name_;      ///< 片段名
+    qint64 begin_;          ///< 开始时间，未追踪时为 -1
+};
+
+}  // namespace SnakeGame
+
+#endif  // TRACE_H
@@ -0,0 +1,103 @@
+/**
+ * @file TripleBuffer.h
+ * @brief 单生产者/单消费者无锁三缓冲（只保留最新值）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <QtGlobal>
+#include <atomic>
+
+namespace SnakeGame {
+
+/**
+ * @brief 单生产者/单消费者无锁三缓冲（只保留最新值）
+ *
+ * 三个槽位在构造时一次性分配：生产者独占一个写入，消费者独占一个读取，
+ * 第三个存放最近提交、尚未取走的值。提交和取走都只是与中间槽位交换下标，
+ * 生产者永远不会等待消费者，也不会丢弃新值：消费者来不及读取时，
+ * 未读的旧值被新值覆盖（计入 overwritten），最后一次提交的值总能被读到。
+ *
+ * @tparam T 槽位类型
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    /**
+     * @brief 构造函数
+     * @param init 槽位初始值（用于预分配固定容量）
+     */
+    explicit TripleBuffer(const T& init = T())
+        : slots_{init, init, init}
+        , back_(0)
+        , middle_(1)
+        , front_(2)
+        , published_(0)
+        , overwritten_(0)
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ==================== 生产者 ====================
+
+    /**
+     * @brief 获取生产者独占的槽位（始终可写）
+     */
+    T* writeSlot() { return &slots_[back_]; }
+
+    /**
+     * @brief 提交 writeSlot() 中写好的值，换回一个空闲槽位
+     */
+    void publish() {
+        // seq_cst：与消费者对通知标志的清除构成全序，见 SimulationThread::takeSnapshot()
+        const int previous = middle_.exchange(back_ | kFresh);
+        back_ = previous & kIndexMask;
+        published_.fetch_add(1, std::memory_order_relaxed);
+        if (previous & kFresh) {
+            overwritten_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // ==================== 消费者 ====================
+
+    /**
+     * @brief 取走最近提交的值
+     * @return 槽位指针，自上次取走后没有新值时返回 nullptr；
+     *         槽位在下一次 acquireLatest() 之前归消费者独占
+     */
+    const T* acquireLatest() {
+        if (!(middle_.load() & kFresh)) {
+            return nullptr;
+        }
+        front_ = middle_.exchange(front_) & kIndexMask;
+        return &slots_[front_];
+    }
+
+    // ==================== 统计 ====================
+
+    /** @brief 已提交的值的个数 */
+    quint64 published() const { return published_.load(std::memory_order_relaxed); }
+
+    /** @brief 未被读取就被更新的值覆盖的个数 */
+    quint64 overwritten() const { return overwritten_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int kIndexMask = 3;        ///< 中间槽位中的下标部分
+    static constexpr int kFresh = 4;            ///< 中间槽位中的值尚未被取走
+
+    T slots_[3];                                ///< 预分配槽位
+    int back_;                                  ///< 生产者独占的槽位
+    alignas(64) std::atomic<int> middle_;       ///< 最近提交的槽位（下标 | kFresh）
+    alignas(64) int front_;                     ///< 消费者独占的槽位
+    alignas(64) std::atomic<quint64> published_;    ///< 已提交计数
+    std::atomic<quint64> overwritten_;          ///< 覆盖计数
+};
+
+}  // namespace SnakeGame
+
+#endif  // TRIPLEBUFFER_H
@@ -7,8 +7,11 @@
 
 #include <QApplication>
 #include <QDebug>
+#include "Constants.h"
 #include "MainWindow.h"
 #include "RendererType.h"
+#include "ControllerFactory.h"
+#include "Trace.h"
 
 using namespace SnakeGame;
 
@@ -25,6 +28,12 @@ RendererType parseRendererType(const QStringList& args)
             if (value == "scene") {
                 qInfo() << "Using QGraphicsScene renderer";
                 return RendererType::Scene;
+            } else if (value == "threaded") {
+                qInfo() << "Using threaded QImage renderer";
+                return RendererType::Threaded;
+            } else if (value == "raster") {
+                qInfo() << "Using direct raster renderer";
+                return RendererType::Raster;
             } else if (value == "widget") {
                 qInfo() << "Using QPainter (Widget) renderer";
                 return RendererType::Widget;
@@ -37,6 +46,60 @@ RendererType parseRendererType(const QStringList& args)
     return RendererType::Widget;
 }
 
+/**
+ * @brief 解析命令行参数中的自动驾驶控制器
+ * @param args 命令行参数列表
+ * @param boardWidth 游戏区域宽度（格数）
+ * @param boardHeight 游戏区域高度（格数）
+ * @return 控制器，未指定时返回空指针（玩家操作）
+ */
+std::unique_ptr<Controller> parseController(const QStringList& args,
+                                            int boardWidth, int boardHeight)
+{
+    for (const QString& arg : args) {
+        if (arg.startsWith("--autopilot=")) {
+            QString value = arg.mid(12).toLower();
+            std::unique_ptr<Controller> controller =
+                ControllerFactory::create(value, boardWidth, boardHeight);
+            if (controller) {
+                qInfo() << "Using" << value << "autopilot";
+                return controller;
+            }
+            qWarning() << "Unknown autopilot:" << value << ", ignoring";
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 解析命令行参数中是否启用独立模拟线程
+ * @param args 命令行参数列表
+ * @return true 表示游戏逻辑运行在独立线程中
+ */
+bool parseThreadedSimulation(const QStringList& args)
+{
+    if (args.contains("--sim-thread")) {
+        qInfo() << "Running game logic on a dedicated simulation thread";
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 解析命令行参数中的时间线追踪输出文件
+ * @param args 命令行参数列表
+ * @return 输出文件路径，未指定时为空（不追踪）
+ */
+QString parseTracePath(const QStringList& args)
+{
+    for (const QString& arg : args) {
+        if (arg.startsWith("--trace=")) {
+            return arg.mid(8);
+        }
+    }
+    return QString();
+}
+
 /**
  * @brief 程序入口
  * @param argc 命令行参数数量
@@ -52,12 +115,30 @@ int main(int argc, char *argv[])
     QApplication::setApplicationVersion("1.0.0");
     QApplication::setOrganizationName("SnakeGame Team");
 
+    // 时间线追踪须在模拟线程和渲染线程启动前开启
+    const QString tracePath = parseTracePath(QCoreApplication::arguments());
+    if (!tracePath.isEmpty()) {
+        qInfo() << "Tracing to" << tracePath;
+        Trace::start();
+    }
+
     // 解析渲染器类型
     RendererType rendererType = parseRendererType(QCoreApplication::arguments());
 
     // 创建并显示主窗口
-    MainWindow mainWindow(rendererType);
+    MainWindow mainWindow(rendererType, parseThreadedSimulation(QCoreApplication::arguments()));
+    mainWindow.setController(parseController(QCoreApplication::arguments(),
+                                             Constants::kDefaultBoardWidth,
+                                             Constants::kDefaultBoardHeight));
     mainWindow.show();
 
-    return app.exec();
+    const int result = app.exec();
+
+    if (!tracePath.isEmpty()) {
+        Trace::stop();
+        if (!Trace::writeJson(tracePath)) {
+            qWarning() << "Cannot write trace file:" << tracePath;
+        }
+    }
+    return result;
 }
@@ -0,0 +1,182 @@
+/**
+ * @file RenderBench.cpp
+ * @brief 渲染器基准实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "RenderBench.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPoint>
+#include <QVector>
+#include <algorithm>
+#include <vector>
+#include "GameState.h"
+#include "GameWidget.h"
+#include "HamiltonCycle.h"
+#include "RasterGameView.h"
+#include "SceneGameView.h"
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#include <cstdio>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#endif
+
+namespace SnakeGame {
+
+namespace {
+
+/// 蛇头与食物之间最多相隔的步数
+constexpr int kFoodInterval = 32;
+
+/**
+ * @brief 把分配器缓存的空闲内存还给系统，让前后两次常驻内存之差更接近组件本身的占用
+ */
+void releaseFreedMemory()
+{
+#if defined(Q_OS_LINUX) && defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+/**
+ * @brief 用指定的渲染组件跑一组局面
+ *
+ * 蛇头沿回路前进、蛇身紧随其后，蛇长保持不变；蛇头到达食物时
+ * 食物移到前方的空闲格，与真实对局一样先通知食物再通知蛇身。
+ */
+template <typename View>
+RenderBenchResult runView(const RenderBenchCase& benchCase)
+{
+    RenderBenchResult result;
+
+    const auto cycle = HamiltonCycle::forBoard(benchCase.boardWidth, benchCase.boardHeight);
+    const int cells = cycle->size();
+    const int length = qBound(1, benchCase.snakeLength, cells - 1);
+    // 蛇头前方 cells - length 格都是空闲的，食物放在其中，约每 kFoodInterval 帧吃到一次
+    const int foodAhead = std::max(1, std::min(kFoodInterval, (cells - length) / 2));
+
+    int head = length - 1;
+    QVector<QPoint> body;
+    body.reserve(length + 1);
+    for (int i = 0; i < length; ++i) {
+        body.append(cycle->at(head - i));
+    }
+    int foodIndex = (head + foodAhead) % cells;
+    QVector<QPoint> foods{cycle->at(foodIndex)};
+
+    releaseFreedMemory();
+    const qint64 residentBefore = RenderBench::residentBytes();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    View view(benchCase.boardWidth, benchCase.boardHeight, benchCase.cellSize);
+    view.onGameStateChanged(GameState::Running);
+    view.onFoodsChanged(foods);
+    view.onSnakeMoved(body);
+    QImage image(view.size(), QImage::Format_ARGB32_Premultiplied);
+    QCoreApplication::processEvents();
+    view.render(&image);
+    result.setupMs = timer.nsecsElapsed() / 1e6;
+
+    std::vector<qint64> samples;
+    samples.reserve(benchCase.frames);
+    for (int frame = 0; frame < benchCase.frames; ++frame) {
+        head = (head + 1) % cells;
+        body.removeLast();
+        body.prepend(cycle->at(head));
+        const bool ate = head == foodIndex;
+        if (ate) {
+            foodIndex = (head + foodAhead) % cells;
+            foods[0] = cycle->at(foodIndex);
+        }
+
+        timer.restart();
+        if (ate) {
+            view.onFoodsChanged(foods);
+        }
+        view.onSnakeMoved(body);
+        QCoreApplication::processEvents();
+        view.render(&image);
+        samples.push_back(timer.nsecsElapsed());
+    }
+
+    const qint64 residentAfter = RenderBench::residentBytes();
+    if (residentBefore >= 0 && residentAfter >= 0) {
+        result.memoryBytes = residentAfter - residentBefore;
+    }
+
+    if (!samples.empty()) {
+        qint64 total = 0;
+        for (qint64 sample : samples) {
+            total += sample;
+        }
+        result.msPerFrame = total / 1e6 / samples.size();
+
+        const size_t p95 = std::min(samples.size() - 1, samples.size() * 95 / 100);
+        std::nth_element(samples.begin(), samples.begin() + p95, samples.end());
+        result.p95Ms = samples[p95] / 1e6;
+        result.maxMs = *std::max_element(samples.begin(), samples.end()) / 1e6;
+    }
+    return result;
+}
+
+}  // namespace
+
+bool RenderBench::isSupported(RendererType renderer)
+{
+    return renderer == RendererType::Widget ||
+           renderer == RendererType::Scene ||
+           renderer == RendererType::Raster;
+}
+
+QString RenderBench::rendererName(RendererType renderer)
+{
+    switch (renderer) {
+        case RendererType::Widget:   return "widget";
+        case RendererType::Scene:    return "scene";
+        case RendererType::Threaded: return "threaded";
+        case RendererType::Raster:   return "raster";
+    }
+    return "unknown";
+}
+
+RenderBenchResult RenderBench::run(RendererType renderer, const RenderBenchCase& benchCase)
+{
+    switch (renderer) {
+        case RendererType::Scene:
+            return runView<SceneGameView>(benchCase);
+        case RendererType::Raster:
+            return runView<RasterGameView>(benchCase);
+        case RendererType::Widget:
+        default:
+            return runView<GameWidget>(benchCase);
+    }
+}
+
+qint64 RenderBench::residentBytes()
+{
+#ifdef Q_OS_LINUX
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return -1;
+    }
+    long long pages = -1;
+    const int fields = std::fscanf(file, "%*u %lld", &pages);
+    std::fclose(file);
+    if (fields != 1 || pages < 0) {
+        return -1;
+    }
+    return static_cast<qint64>(pages) * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,80 @@
+/**
+ * @file RenderBench.h
+ * @brief 渲染器基准 - 离屏重绘脚本化局面，对比各前端的每帧耗时与内存
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef RENDERBENCH_H
+#define RENDERBENCH_H
+
+#include <QString>
+#include <QtGlobal>
+#include "RendererType.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 一组测试局面
+ */
+struct RenderBenchCase {
+    int boardWidth = 20;            ///< 棋盘宽度（宽高之积须为偶数）
+    int boardHeight = 15;           ///< 棋盘高度
+    int cellSize = 30;              ///< 单元格像素大小
+    int snakeLength = 3;            ///< 蛇长
+    int frames = 200;               ///< 计时的帧数
+};
+
+/**
+ * @brief 一个渲染器在一组局面上的结果
+ */
+struct RenderBenchResult {
+    double msPerFrame = 0.0;        ///< 平均每帧耗时（毫秒）
+    double p95Ms = 0.0;             ///< 每帧耗时的 95 分位（毫秒）
+    double maxMs = 0.0;             ///< 最慢一帧（毫秒）
+    double setupMs = 0.0;           ///< 创建组件并画出首帧的耗时（毫秒）
+    qint64 memoryBytes = -1;        ///< 组件存活期间常驻内存的增量，无法测量时为 -1
+};
+
+/**
+ * @brief 渲染器基准
+ *
+ * 蛇沿 HamiltonCycle 前进，每帧与真实对局一样先调用渲染器的
+ * onSnakeMoved()（吃到食物时先调用 onFoodsChanged()），处理挂起的事件，
+ * 再用 QWidget::render() 把整个组件强制重绘到预先分配的 QImage 中。
+ * 组件不显示，因此不经过窗口系统，适合 QT_QPA_PLATFORM=offscreen。
+ * 计时包含槽函数、事件处理和重绘，不包含生成局面。
+ *
+ * 内存为创建组件前后的进程常驻内存之差（仅 Linux），受分配器缓存影响，只作量级参考。
+ * ThreadedGameWidget 在工作线程异步出图，render() 只能测到贴图，不参与对比。
+ */
+class RenderBench {
+public:
+    /**
+     * @brief 是否支持该渲染器
+     */
+    static bool isSupported(RendererType renderer);
+
+    /**
+     * @brief 渲染器的命令行名称
+     */
+    static QString rendererName(RendererType renderer);
+
+    /**
+     * @brief 在一组局面上运行一个渲染器（须在 GUI 线程调用）
+     * @param renderer 渲染器类型（须受支持）
+     * @param benchCase 局面
+     * @return 结果
+     */
+    static RenderBenchResult run(RendererType renderer, const RenderBenchCase& benchCase);
+
+    /**
+     * @brief 当前进程的常驻内存
+     * @return 字节数，不支持的平台返回 -1
+     */
+    static qint64 residentBytes();
+};
+
+}  // namespace SnakeGame
+
+#endif  // RENDERBENCH_H
@@ -0,0 +1,187 @@
+/**
+ * @file main.cpp
+ * @brief 渲染器基准命令行程序入口（离屏运行，无需显示设备）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QSize>
+#include <QStringList>
+#include <QVector>
+#include <algorithm>
+#include <cstdio>
+#include "Constants.h"
+#include "HamiltonCycle.h"
+#include "RenderBench.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/// 自动选择单元格大小时，棋盘较长一边的最大像素数
+constexpr int kMaxBoardPixels = 1600;
+
+/**
+ * @brief 解析渲染器列表，如 "widget,scene"
+ * @return 渲染器列表，有无法识别或不支持的名称时返回空列表
+ */
+QVector<RendererType> parseRenderers(const QString& value)
+{
+    const RendererType all[] = {RendererType::Widget, RendererType::Scene,
+                                RendererType::Threaded, RendererType::Raster};
+    QVector<RendererType> renderers;
+    for (const QString& name : value.split(',', Qt::SkipEmptyParts)) {
+        bool found = false;
+        for (RendererType renderer : all) {
+            if (RenderBench::rendererName(renderer) == name.trimmed().toLower()) {
+                if (!RenderBench::isSupported(renderer)) {
+                    std::fprintf(stderr, "Renderer not supported by this benchmark: %s\n",
+                                 qPrintable(name));
+                    return {};
+                }
+                renderers.append(renderer);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::fprintf(stderr, "Unknown renderer: %s\n", qPrintable(name));
+            return {};
+        }
+    }
+    return renderers;
+}
+
+/**
+ * @brief 解析棋盘尺寸列表，如 "20x15,64x48"
+ * @return 尺寸列表，有无效项时返回空列表
+ */
+QVector<QSize> parseBoards(const QString& value)
+{
+    QVector<QSize> boards;
+    for (const QString& item : value.split(',', Qt::SkipEmptyParts)) {
+        const QStringList parts = item.trimmed().toLower().split('x');
+        const int width = parts.size() == 2 ? parts[0].toInt() : 0;
+        const int height = parts.size() == 2 ? parts[1].toInt() : 0;
+        if (!HamiltonCycle::isSupported(width, height)) {
+            std::fprintf(stderr, "Invalid board size (needs an even number of cells): %s\n",
+                         qPrintable(item));
+            return {};
+        }
+        boards.append(QSize(width, height));
+    }
+    return boards;
+}
+
+/**
+ * @brief 解析蛇长比例列表，如 "0.05,0.5"
+ * @return 比例列表，有无效项时返回空列表
+ */
+QVector<double> parseFractions(const QString& value)
+{
+    QVector<double> fractions;
+    for (const QString& item : value.split(',', Qt::SkipEmptyParts)) {
+        bool ok = false;
+        const double fraction = item.trimmed().toDouble(&ok);
+        if (!ok || fraction <= 0.0 || fraction >= 1.0) {
+            std::fprintf(stderr, "Invalid snake fraction: %s\n", qPrintable(item));
+            return {};
+        }
+        fractions.append(fraction);
+    }
+    return fractions;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @param argc 命令行参数数量
+ * @param argv 命令行参数
+ * @return 0 成功，1 参数错误
+ */
+int main(int argc, char *argv[])
+{
+    // 默认离屏运行；显式设置了 QT_QPA_PLATFORM 时尊重用户的选择
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+
+    QApplication::setApplicationName("SnakeRenderBench");
+    QApplication::setApplicationVersion("1.0.0");
+    QApplication::setOrganizationName("SnakeGame Team");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Offscreen repaint benchmark for the Snake renderers.\n"
+        "The threaded renderer paints asynchronously and is not measured.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    QCommandLineOption renderersOption("renderers",
+        "Comma-separated renderers to compare: widget, scene, raster.", "list",
+        "widget,scene,raster");
+    QCommandLineOption boardsOption("boards",
+        "Comma-separated board sizes in cells.", "list", "20x15,64x48,160x120");
+    QCommandLineOption snakeOption("snake",
+        "Comma-separated snake lengths as fractions of the board.", "list", "0.05,0.25,0.75");
+    QCommandLineOption framesOption("frames", "Frames to time per case.", "n", "200");
+    QCommandLineOption cellOption("cell",
+        "Cell size in pixels (0 picks one that keeps the board within 1600 px).", "px", "0");
+
+    parser.addOptions({renderersOption, boardsOption, snakeOption, framesOption, cellOption});
+    parser.process(app);
+
+    const QVector<RendererType> renderers = parseRenderers(parser.value(renderersOption));
+    const QVector<QSize> boards = parseBoards(parser.value(boardsOption));
+    const QVector<double> fractions = parseFractions(parser.value(snakeOption));
+    const int frames = parser.value(framesOption).toInt();
+    const int cell = parser.value(cellOption).toInt();
+    if (renderers.isEmpty() || boards.isEmpty() || fractions.isEmpty()) {
+        return 1;
+    }
+    if (frames <= 0 || cell < 0) {
+        std::fprintf(stderr, "Invalid frame count or cell size\n");
+        return 1;
+    }
+
+    std::printf("platform: %s\n", qPrintable(QApplication::platformName()));
+    std::printf("%-8s %-9s %4s %7s %10s %9s %9s %9s %10s\n",
+                "renderer", "board", "cell", "snake", "setup ms", "ms/frame", "p95 ms",
+                "max ms", "memory MB");
+
+    for (const QSize& board : boards) {
+        RenderBenchCase benchCase;
+        benchCase.boardWidth = board.width();
+        benchCase.boardHeight = board.height();
+        benchCase.cellSize = cell > 0
+            ? cell
+            : std::max(1, std::min(Constants::kCellSize,
+                                   kMaxBoardPixels / std::max(board.width(), board.height())));
+        benchCase.frames = frames;
+
+        const int cells = board.width() * board.height();
+        for (double fraction : fractions) {
+            benchCase.snakeLength = std::max(3, static_cast<int>(cells * fraction));
+
+            for (RendererType renderer : renderers) {
+                const RenderBenchResult result = RenderBench::run(renderer, benchCase);
+                const QString boardText = QString("%1x%2").arg(board.width()).arg(board.height());
+                std::printf("%-8s %-9s %4d %7d %10.2f %9.3f %9.3f %9.3f ",
+                            qPrintable(RenderBench::rendererName(renderer)),
+                            qPrintable(boardText), benchCase.cellSize, benchCase.snakeLength,
+                            result.setupMs, result.msPerFrame, result.p95Ms, result.maxMs);
+                if (result.memoryBytes >= 0) {
+                    std::printf("%10.1f\n", result.memoryBytes / (1024.0 * 1024.0));
+                } else {
+                    std::printf("%10s\n", "n/a");
+                }
+                std::fflush(stdout);
+            }
+        }
+    }
+    return 0;
+}
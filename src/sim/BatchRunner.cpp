@@ -0,0 +1,201 @@
+/**
+ * @file BatchRunner.cpp
+ * @brief 批量模拟器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "GameLogic.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace SnakeGame {
+
+namespace {
+
+/** @brief 每次从计数器领取的局数 */
+constexpr qint64 kGamesPerClaim = 16;
+
+/** @brief 本地输出缓冲达到该大小时写出 */
+constexpr int kFlushBytes = 64 * 1024;
+
+/**
+ * @brief 以刚播种的随机数开始新的一局
+ *
+ * startGame() 只在 Ready/GameOver 时重置，而达到步数上限的对局仍是 Running，
+ * 刚构造的对局则已用未播种的引擎放好了食物，因此总是先 resetGame()
+ * （随后 startGame() 看到 Ready 不会再次重置），保证每局只取决于本局种子。
+ */
+void startFreshGame(GameLogic& game)
+{
+    game.resetGame();
+    game.startGame();
+}
+
+}  // namespace
+
+// ==================== BatchRunner ====================
+
+BatchRunner::BatchRunner(const BatchConfig& config, ResultWriter* writer)
+    : config_(config)
+    , writer_(writer)
+    , nextGame_(0)
+    , finishedGames_(0)
+    , finishedTicks_(0)
+{
+    if (config_.maxTicks <= 0) {
+        const qint64 cells = static_cast<qint64>(config_.boardWidth) * config_.boardHeight;
+        config_.maxTicks = cells * cells;
+    }
+}
+
+quint64 BatchRunner::seedForGame(quint64 baseSeed, qint64 game)
+{
+    // splitmix64：相邻局序号得到互不相关的种子
+    quint64 z = baseSeed + static_cast<quint64>(game + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+BatchSummary BatchRunner::run()
+{
+    int threadCount = config_.threads;
+    if (threadCount <= 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if (writer_) {
+        writer_->writeHeader();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const int cells = config_.boardWidth * config_.boardHeight;
+    std::vector<StatsAccumulator> threadStats(threadCount, StatsAccumulator(cells));
+    std::vector<Heatmap> threadHeatmaps;
+    if (config_.heatmap) {
+        threadHeatmaps.assign(threadCount, Heatmap(config_.boardWidth, config_.boardHeight));
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&BatchRunner::runWorker, this, &threadStats[i],
+                             config_.heatmap ? &threadHeatmaps[i] : nullptr);
+    }
+
+    // 主线程只负责输出进度
+    if (config_.progressInterval > 0) {
+        auto nextReport = start + std::chrono::seconds(config_.progressInterval);
+        while (finishedGames_.load(std::memory_order_relaxed) < config_.games) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            const auto now = std::chrono::steady_clock::now();
+            if (now < nextReport) {
+                continue;
+            }
+            nextReport = now + std::chrono::seconds(config_.progressInterval);
+
+            const double seconds = std::chrono::duration<double>(now - start).count();
+            const qint64 games = finishedGames_.load(std::memory_order_relaxed);
+            const qint64 ticks = finishedTicks_.load(std::memory_order_relaxed);
+            std::fprintf(stderr, "[%.0fs] %lld/%lld games, %.0f games/s, %.0f ticks/s\n",
+                         seconds, static_cast<long long>(games),
+                         static_cast<long long>(config_.games),
+                         games / seconds, ticks / seconds);
+        }
+    }
+
+    // 各线程的累加器在 join 之后合并，全程无锁
+    BatchSummary total;
+    total.stats = StatsAccumulator(cells);
+    if (config_.heatmap) {
+        total.heatmap = Heatmap(config_.boardWidth, config_.boardHeight);
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        workers[i].join();
+        total.stats.merge(threadStats[i]);
+        if (config_.heatmap) {
+            total.heatmap.merge(threadHeatmaps[i]);
+        }
+    }
+
+    total.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return total;
+}
+
+void BatchRunner::runWorker(StatsAccumulator* stats, Heatmap* heatmap)
+{
+    // 食物和随机控制器共用同一个引擎，每局重新播种
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+
+    GameLogic game(config_.boardWidth, config_.boardHeight);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    game.setFoodCount(config_.foodCount);
+    game.setLevel(config_.level);
+    game.setDistanceFieldEnabled(config_.distanceField);
+    game.setCompactBodyEnabled(config_.compactBody);
+    game.setController(ControllerFactory::create(config_.controller, config_.boardWidth,
+                                                 config_.boardHeight, generator, config_.policy));
+    game.setObserver(heatmap);
+
+    QByteArray buffer;
+    buffer.reserve(kFlushBytes * 2);
+
+    for (;;) {
+        const qint64 first = nextGame_.fetch_add(kGamesPerClaim, std::memory_order_relaxed);
+        if (first >= config_.games) {
+            break;
+        }
+        const qint64 last = std::min(first + kGamesPerClaim, config_.games);
+
+        qint64 claimedTicks = 0;
+        for (qint64 index = first; index < last; ++index) {
+            GameResult result;
+            result.game = index;
+            result.seed = seedForGame(config_.seed, index);
+            engine.seed(result.seed);
+
+            startFreshGame(game);
+            while (game.getState() == GameState::Running && result.ticks < config_.maxTicks) {
+                game.step();
+                ++result.ticks;
+            }
+
+            result.score = game.getScore();
+            result.length = game.getSnakeLength();
+            result.reason = game.getGameOverReason();
+            result.timedOut = game.getState() == GameState::Running;
+
+            stats->add(result);
+            claimedTicks += result.ticks;
+
+            if (writer_) {
+                writer_->format(&buffer, result);
+                if (buffer.size() >= kFlushBytes) {
+                    writer_->write(&buffer);
+                }
+            }
+        }
+
+        finishedGames_.fetch_add(last - first, std::memory_order_relaxed);
+        finishedTicks_.fetch_add(claimedTicks, std::memory_order_relaxed);
+    }
+
+    if (writer_) {
+        writer_->write(&buffer);
+    }
+}
+
+}  // namespace SnakeGame
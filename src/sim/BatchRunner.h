@@ -0,0 +1,101 @@
+/**
+ * @file BatchRunner.h
+ * @brief 批量模拟器 - 多线程无节流运行大量对局
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <memory>
+
+#include "Constants.h"
+#include "Heatmap.h"
+#include "Level.h"
+#include "PolicyTable.h"
+#include "ResultWriter.h"
+#include "StatsAccumulator.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 批量模拟配置
+ */
+struct BatchConfig {
+    qint64 games = 1000;                                    ///< 总局数
+    int threads = 0;                                        ///< 工作线程数，0 表示使用全部核心
+    QString controller = "hamilton";                        ///< 控制器名称
+    int boardWidth = Constants::kDefaultBoardWidth;         ///< 游戏区域宽度
+    int boardHeight = Constants::kDefaultBoardHeight;       ///< 游戏区域高度
+    quint64 seed = 1;                                       ///< 基础随机种子
+    int foodCount = 1;                                      ///< 同时存在的食物数量
+    std::shared_ptr<const Level> level;                     ///< 关卡（可为空，所有线程共享同一映射）
+    bool distanceField = false;                             ///< 是否维护到食物的距离场（贪心控制器按实际步数选路）
+    bool compactBody = false;                               ///< 是否使用紧凑蛇身存储（每节 2 位，不支持回绕关卡）
+    qint64 maxTicks = 0;                                    ///< 每局步数上限，0 表示格数的平方
+    int progressInterval = 0;                               ///< 进度输出间隔（秒），0 表示不输出
+    bool heatmap = false;                                   ///< 是否统计格子热力图
+    std::shared_ptr<const PolicyTable> policy;              ///< 最优控制器的策略表（可为空，所有线程共享同一映射）
+};
+
+/**
+ * @brief 批量模拟汇总
+ */
+struct BatchSummary {
+    StatsAccumulator stats;             ///< 合并后的统计
+    Heatmap heatmap;                    ///< 合并后的热力图（未启用时为空）
+    double elapsedSeconds = 0.0;        ///< 墙钟耗时
+};
+
+/**
+ * @brief 批量模拟器
+ *
+ * 每个工作线程持有一个关闭定时器的 GameLogic，逐局调用 step() 直到结束。
+ * 局序号按小批从原子计数器领取；每局使用由基础种子和局序号派生的
+ * 独立种子，因此结果与线程数无关，可按局复现。
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief 构造函数
+     * @param config 模拟配置
+     * @param writer 逐局结果输出（可为空）
+     */
+    explicit BatchRunner(const BatchConfig& config, ResultWriter* writer = nullptr);
+
+    /**
+     * @brief 派生单局种子
+     * @param baseSeed 基础种子
+     * @param game 局序号
+     * @return 单局种子
+     */
+    static quint64 seedForGame(quint64 baseSeed, qint64 game);
+
+    /**
+     * @brief 运行全部对局（阻塞直到完成）
+     * @return 汇总结果
+     */
+    BatchSummary run();
+
+private:
+    BatchConfig config_;                    ///< 模拟配置
+    ResultWriter* writer_;                  ///< 逐局结果输出
+    std::atomic<qint64> nextGame_;          ///< 下一个待领取的局序号
+    std::atomic<qint64> finishedGames_;     ///< 已完成局数（进度输出用）
+    std::atomic<qint64> finishedTicks_;     ///< 已完成步数（进度输出用）
+
+    /**
+     * @brief 工作线程主循环
+     * @param stats 本线程独占的统计累加器
+     * @param heatmap 本线程独占的热力图（未启用时为空）
+     */
+    void runWorker(StatsAccumulator* stats, Heatmap* heatmap);
+};
+
+}  // namespace SnakeGame
+
+#endif  // BATCHRUNNER_H
@@ -0,0 +1,231 @@
+/**
+ * @file Heatmap.cpp
+ * @brief 格子热力图实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "Heatmap.h"
+#include <QByteArray>
+#include <QFile>
+#include <QtEndian>
+#include <algorithm>
+#include <cmath>
+
+namespace SnakeGame {
+
+namespace {
+
+/**
+ * @brief PNG 块使用的 CRC-32
+ */
+quint32 crc32(const uchar* data, int length, quint32 crc = 0xFFFFFFFFu)
+{
+    static const std::vector<quint32> table = [] {
+        std::vector<quint32> t(256);
+        for (quint32 n = 0; n < 256; ++n) {
+            quint32 c = n;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[n] = c;
+        }
+        return t;
+    }();
+
+    for (int i = 0; i < length; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+/**
+ * @brief 写出一个 PNG 块（长度、类型、数据、CRC）
+ */
+bool writeChunk(QFile& file, const char* type, const QByteArray& payload)
+{
+    uchar length[4];
+    qToBigEndian<quint32>(static_cast<quint32>(payload.size()), length);
+
+    quint32 crc = crc32(reinterpret_cast<const uchar*>(type), 4);
+    crc = crc32(reinterpret_cast<const uchar*>(payload.constData()), payload.size(), crc);
+    uchar checksum[4];
+    qToBigEndian<quint32>(crc ^ 0xFFFFFFFFu, checksum);
+
+    return file.write(reinterpret_cast<const char*>(length), 4) == 4 &&
+           file.write(type, 4) == 4 &&
+           file.write(payload) == payload.size() &&
+           file.write(reinterpret_cast<const char*>(checksum), 4) == 4;
+}
+
+/**
+ * @brief 将 [0, 1] 映射到黑-红-黄-白色带
+ */
+void heatColor(double t, uchar* rgb)
+{
+    const double r = std::clamp(t * 3.0, 0.0, 1.0);
+    const double g = std::clamp(t * 3.0 - 1.0, 0.0, 1.0);
+    const double b = std::clamp(t * 3.0 - 2.0, 0.0, 1.0);
+    rgb[0] = static_cast<uchar>(r * 255.0 + 0.5);
+    rgb[1] = static_cast<uchar>(g * 255.0 + 0.5);
+    rgb[2] = static_cast<uchar>(b * 255.0 + 0.5);
+}
+
+}  // namespace
+
+// ==================== Counters ====================
+
+Heatmap::Counters::Counters(int cells)
+    : blocks_((cells + 7) / 8, CacheLine{})
+{
+}
+
+// ==================== Heatmap ====================
+
+Heatmap::Heatmap(int boardWidth, int boardHeight)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , layers_{Counters(boardWidth * boardHeight),
+              Counters(boardWidth * boardHeight),
+              Counters(boardWidth * boardHeight)}
+{
+}
+
+void Heatmap::onHeadMoved(const QPoint& head)
+{
+    ++layers_[HeadVisits][head.y() * boardWidth_ + head.x()];
+}
+
+void Heatmap::onFoodSpawned(const QPoint& position)
+{
+    ++layers_[FoodSpawns][position.y() * boardWidth_ + position.x()];
+}
+
+void Heatmap::onGameOver(const QPoint& cell, GameOverReason reason)
+{
+    // 获胜不是死亡
+    if (reason != GameOverReason::BoardFilled && isInside(cell)) {
+        ++layers_[Deaths][cell.y() * boardWidth_ + cell.x()];
+    }
+}
+
+void Heatmap::merge(const Heatmap& other)
+{
+    if (other.boardWidth_ != boardWidth_ || other.boardHeight_ != boardHeight_) {
+        return;
+    }
+
+    const int cells = boardWidth_ * boardHeight_;
+    for (int layer = 0; layer < LayerCount; ++layer) {
+        quint64* into = layers_[layer].data();
+        const quint64* from = other.layers_[layer].data();
+        for (int i = 0; i < cells; ++i) {
+            into[i] += from[i];
+        }
+    }
+}
+
+bool Heatmap::saveBinary(const QString& path) const
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    uchar header[kHeaderSize];
+    qToLittleEndian<quint32>(kMagic, header);
+    qToLittleEndian<quint32>(kVersion, header + 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(boardWidth_), header + 8);
+    qToLittleEndian<quint32>(static_cast<quint32>(boardHeight_), header + 12);
+    qToLittleEndian<quint32>(static_cast<quint32>(LayerCount), header + 16);
+    if (file.write(reinterpret_cast<const char*>(header), sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+
+    const int cells = boardWidth_ * boardHeight_;
+    QByteArray row(cells * static_cast<int>(sizeof(quint64)), '\0');
+    for (int layer = 0; layer < LayerCount; ++layer) {
+        uchar* out = reinterpret_cast<uchar*>(row.data());
+        for (int i = 0; i < cells; ++i) {
+            qToLittleEndian<quint64>(layers_[layer][i], out + i * sizeof(quint64));
+        }
+        if (file.write(row) != row.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Heatmap::savePng(Layer layer, const QString& path, int cellPixels) const
+{
+    const int cells = boardWidth_ * boardHeight_;
+    if (cells == 0 || cellPixels <= 0) {
+        return false;
+    }
+
+    // 对数刻度：少数热点不会把其余格子压成全黑
+    quint64 peak = 0;
+    for (int i = 0; i < cells; ++i) {
+        peak = std::max(peak, layers_[layer][i]);
+    }
+    const double scale = peak > 0 ? 1.0 / std::log1p(static_cast<double>(peak)) : 0.0;
+
+    const int width = boardWidth_ * cellPixels;
+    const int height = boardHeight_ * cellPixels;
+    const int stride = 1 + width * 3;   // 每行前有一个过滤类型字节（0 = None）
+
+    QByteArray pixels(stride * height, '\0');
+    uchar* out = reinterpret_cast<uchar*>(pixels.data());
+    for (int y = 0; y < boardHeight_; ++y) {
+        uchar* line = out + y * cellPixels * stride;
+        for (int x = 0; x < boardWidth_; ++x) {
+            uchar rgb[3];
+            heatColor(std::log1p(static_cast<double>(at(layer, x, y))) * scale, rgb);
+            for (int p = 0; p < cellPixels; ++p) {
+                std::copy(rgb, rgb + 3, line + 1 + (x * cellPixels + p) * 3);
+            }
+        }
+        // 同一格子的其余像素行与第一行相同
+        for (int p = 1; p < cellPixels; ++p) {
+            std::copy(line, line + stride, line + p * stride);
+        }
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    static const char signature[] = "\x89PNG\r\n\x1a\n";
+    if (file.write(signature, 8) != 8) {
+        return false;
+    }
+
+    QByteArray ihdr(13, '\0');
+    uchar* h = reinterpret_cast<uchar*>(ihdr.data());
+    qToBigEndian<quint32>(static_cast<quint32>(width), h);
+    qToBigEndian<quint32>(static_cast<quint32>(height), h + 4);
+    h[8] = 8;   // 位深
+    h[9] = 2;   // 真彩色 RGB
+
+    // qCompress 输出 = 4 字节大端原始长度 + zlib 流，PNG 的 IDAT 正是 zlib 流
+    const QByteArray compressed = qCompress(pixels, 9);
+    const QByteArray idat = compressed.mid(4);
+
+    return writeChunk(file, "IHDR", ihdr) &&
+           writeChunk(file, "IDAT", idat) &&
+           writeChunk(file, "IEND", QByteArray());
+}
+
+const char* Heatmap::layerName(Layer layer)
+{
+    switch (layer) {
+        case HeadVisits: return "head";
+        case Deaths:     return "deaths";
+        case FoodSpawns: return "food";
+        case LayerCount: break;
+    }
+    return "unknown";
+}
+
+}  // namespace SnakeGame
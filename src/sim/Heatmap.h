@@ -0,0 +1,136 @@
+/**
+ * @file Heatmap.h
+ * @brief 格子热力图 - 统计蛇头经过、死亡和食物生成位置
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef HEATMAP_H
+#define HEATMAP_H
+
+#include <QString>
+#include <QtGlobal>
+#include <vector>
+
+#include "GameObserver.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 格子热力图
+ *
+ * 作为 GameObserver 挂到 GameLogic 上，每帧只做一次数组自增。
+ * 每个工作线程独占一份，各层计数数组按缓存行对齐分配，
+ * 线程之间不会伪共享；批次结束后在主线程 merge()。
+ *
+ * 二进制格式（小端序）：
+ *   头部 20 字节：magic "SNHM"、版本、宽、高、层数（均为 uint32）
+ *   之后按层依次存放 宽 × 高 个 uint64 计数（行优先）
+ */
+class Heatmap : public GameObserver {
+public:
+    /**
+     * @brief 统计层
+     */
+    enum Layer {
+        HeadVisits,     ///< 蛇头经过次数
+        Deaths,         ///< 死亡位置
+        FoodSpawns,     ///< 食物生成位置
+        LayerCount
+    };
+
+    static constexpr quint32 kMagic = 0x4D484E53;  ///< "SNHM"
+    static constexpr quint32 kVersion = 1;         ///< 文件版本
+    static constexpr int kHeaderSize = 20;         ///< 头部字节数
+
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度
+     * @param boardHeight 游戏区域高度
+     */
+    Heatmap(int boardWidth = 0, int boardHeight = 0);
+
+    void onHeadMoved(const QPoint& head) override;
+    void onFoodSpawned(const QPoint& position) override;
+    void onGameOver(const QPoint& cell, GameOverReason reason) override;
+
+    /**
+     * @brief 合并另一份热力图（尺寸必须相同）
+     * @param other 另一份热力图
+     */
+    void merge(const Heatmap& other);
+
+    /**
+     * @brief 读取计数
+     * @param layer 统计层
+     * @param x 列
+     * @param y 行
+     * @return 计数
+     */
+    quint64 at(Layer layer, int x, int y) const {
+        return layers_[layer][y * boardWidth_ + x];
+    }
+
+    /**
+     * @brief 保存为二进制网格
+     * @param path 文件路径
+     * @return true 表示成功
+     */
+    bool saveBinary(const QString& path) const;
+
+    /**
+     * @brief 将一层保存为 PNG（对数刻度的黑-红-黄-白色带）
+     * @param layer 统计层
+     * @param path 文件路径
+     * @param cellPixels 每个格子的像素边长
+     * @return true 表示成功
+     *
+     * 只依赖 QtCore：像素数据用 qCompress 得到的 zlib 流写入 IDAT。
+     */
+    bool savePng(Layer layer, const QString& path, int cellPixels = 8) const;
+
+    /**
+     * @brief 层名称（用于文件名）
+     * @param layer 统计层
+     * @return 名称
+     */
+    static const char* layerName(Layer layer);
+
+private:
+    /**
+     * @brief 一个缓存行大小的计数块，保证各层数组按缓存行对齐
+     */
+    struct alignas(64) CacheLine {
+        quint64 counts[8];
+    };
+
+    /**
+     * @brief 对齐的计数数组
+     */
+    class Counters {
+    public:
+        explicit Counters(int cells = 0);
+        quint64& operator[](int index) { return data()[index]; }
+        quint64 operator[](int index) const { return data()[index]; }
+        quint64* data() { return blocks_.empty() ? nullptr : blocks_.front().counts; }
+        const quint64* data() const { return blocks_.empty() ? nullptr : blocks_.front().counts; }
+
+    private:
+        std::vector<CacheLine> blocks_;     ///< C++17 对过对齐类型使用对齐分配
+    };
+
+    int boardWidth_;                    ///< 游戏区域宽度
+    int boardHeight_;                   ///< 游戏区域高度
+    Counters layers_[LayerCount];       ///< 各层计数
+
+    /**
+     * @brief 检查坐标是否在棋盘内
+     */
+    bool isInside(const QPoint& pos) const {
+        return pos.x() >= 0 && pos.x() < boardWidth_ && pos.y() >= 0 && pos.y() < boardHeight_;
+    }
+};
+
+}  // namespace SnakeGame
+
+#endif  // HEATMAP_H
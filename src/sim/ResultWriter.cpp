@@ -0,0 +1,94 @@
+/**
+ * @file ResultWriter.cpp
+ * @brief 批量模拟结果输出实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ResultWriter.h"
+#include <QMutexLocker>
+
+namespace SnakeGame {
+
+namespace {
+
+const char* outcomeName(const GameResult& result)
+{
+    if (result.timedOut) {
+        return "timeout";
+    }
+    switch (result.reason) {
+        case GameOverReason::WallCollision: return "wall";
+        case GameOverReason::SelfCollision: return "self";
+        case GameOverReason::BoardFilled:   return "won";
+        case GameOverReason::None:          break;
+    }
+    return "unknown";
+}
+
+}  // namespace
+
+ResultWriter::ResultWriter(FILE* out, Format format)
+    : out_(out)
+    , format_(format)
+{
+}
+
+void ResultWriter::writeHeader()
+{
+    if (format_ != Format::Csv) {
+        return;
+    }
+
+    QMutexLocker locker(&mutex_);
+    std::fputs("game,seed,score,length,ticks,outcome\n", out_);
+    std::fflush(out_);
+}
+
+void ResultWriter::format(QByteArray* buffer, const GameResult& result) const
+{
+    if (format_ == Format::Csv) {
+        buffer->append(QByteArray::number(result.game));
+        buffer->append(',');
+        buffer->append(QByteArray::number(result.seed));
+        buffer->append(',');
+        buffer->append(QByteArray::number(result.score));
+        buffer->append(',');
+        buffer->append(QByteArray::number(result.length));
+        buffer->append(',');
+        buffer->append(QByteArray::number(result.ticks));
+        buffer->append(',');
+        buffer->append(outcomeName(result));
+        buffer->append('\n');
+    } else {
+        buffer->append("{\"game\":");
+        buffer->append(QByteArray::number(result.game));
+        buffer->append(",\"seed\":");
+        buffer->append(QByteArray::number(result.seed));
+        buffer->append(",\"score\":");
+        buffer->append(QByteArray::number(result.score));
+        buffer->append(",\"length\":");
+        buffer->append(QByteArray::number(result.length));
+        buffer->append(",\"ticks\":");
+        buffer->append(QByteArray::number(result.ticks));
+        buffer->append(",\"outcome\":\"");
+        buffer->append(outcomeName(result));
+        buffer->append("\"}\n");
+    }
+}
+
+void ResultWriter::write(QByteArray* buffer)
+{
+    if (buffer->isEmpty()) {
+        return;
+    }
+
+    {
+        QMutexLocker locker(&mutex_);
+        std::fwrite(buffer->constData(), 1, static_cast<size_t>(buffer->size()), out_);
+        std::fflush(out_);
+    }
+    buffer->resize(0);
+}
+
+}  // namespace SnakeGame
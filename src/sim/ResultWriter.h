@@ -0,0 +1,81 @@
+/**
+ * @file ResultWriter.h
+ * @brief 批量模拟结果输出 - 流式 CSV / JSON Lines
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include <QByteArray>
+#include <QMutex>
+#include <QtGlobal>
+#include <cstdio>
+#include "GameOverReason.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 单局模拟结果
+ */
+struct GameResult {
+    qint64 game = 0;                        ///< 局序号
+    quint64 seed = 0;                       ///< 本局随机种子
+    int score = 0;                          ///< 最终分数
+    int length = 0;                         ///< 最终蛇长
+    qint64 ticks = 0;                       ///< 本局步数
+    GameOverReason reason = GameOverReason::None;   ///< 结束原因
+    bool timedOut = false;                  ///< 是否因超过步数上限而中止
+};
+
+/**
+ * @brief 批量模拟结果输出
+ *
+ * 每局结果一行，工作线程先格式化到本地缓冲区，
+ * 攒够一批再通过 write() 加锁写出，输出流上的锁争用与局数无关。
+ */
+class ResultWriter {
+public:
+    /**
+     * @brief 输出格式
+     */
+    enum class Format {
+        Csv,        ///< 逗号分隔，首行为表头
+        JsonLines   ///< 每行一个 JSON 对象
+    };
+
+    /**
+     * @brief 构造函数
+     * @param out 输出流
+     * @param format 输出格式
+     */
+    ResultWriter(FILE* out, Format format);
+
+    /**
+     * @brief 写出表头（仅 CSV）
+     */
+    void writeHeader();
+
+    /**
+     * @brief 将一局结果格式化后追加到缓冲区（线程安全，无锁）
+     * @param buffer 调用方的本地缓冲区
+     * @param result 单局结果
+     */
+    void format(QByteArray* buffer, const GameResult& result) const;
+
+    /**
+     * @brief 写出一批已格式化的结果并清空缓冲区（线程安全）
+     * @param buffer 调用方的本地缓冲区
+     */
+    void write(QByteArray* buffer);
+
+private:
+    FILE* out_;             ///< 输出流
+    Format format_;         ///< 输出格式
+    QMutex mutex_;          ///< 保护输出流
+};
+
+}  // namespace SnakeGame
+
+#endif  // RESULTWRITER_H
@@ -0,0 +1,116 @@
+/**
+ * @file StatsAccumulator.cpp
+ * @brief 批量模拟统计累加器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "StatsAccumulator.h"
+#include "Constants.h"
+#include <algorithm>
+
+namespace SnakeGame {
+
+StatsAccumulator::StatsAccumulator(int cellCount)
+    : games_(0)
+    , ticks_(0)
+    , timeouts_(0)
+    , reasonCounts_{}
+    , foodHistogram_(cellCount + 1, 0)
+    , lengthHistogram_(cellCount + 1, 0)
+{
+}
+
+void StatsAccumulator::add(const GameResult& result)
+{
+    ++games_;
+    ticks_ += result.ticks;
+    if (result.timedOut) {
+        ++timeouts_;
+    } else {
+        ++reasonCounts_[static_cast<int>(result.reason)];
+    }
+
+    // 超出直方图范围的值计入最后一格
+    const int top = foodHistogram_.size() - 1;
+    ++foodHistogram_[std::min(top, result.score / Constants::kScorePerFood)];
+    ++lengthHistogram_[std::min(top, result.length)];
+
+    ticksDigest_.add(static_cast<double>(result.ticks));
+}
+
+void StatsAccumulator::merge(const StatsAccumulator& other)
+{
+    games_ += other.games_;
+    ticks_ += other.ticks_;
+    timeouts_ += other.timeouts_;
+    for (size_t i = 0; i < reasonCounts_.size(); ++i) {
+        reasonCounts_[i] += other.reasonCounts_[i];
+    }
+
+    mergeHistogram(&foodHistogram_, other.foodHistogram_);
+    mergeHistogram(&lengthHistogram_, other.lengthHistogram_);
+    ticksDigest_.merge(other.ticksDigest_);
+}
+
+qint64 StatsAccumulator::reasonCount(GameOverReason reason) const
+{
+    return reasonCounts_[static_cast<int>(reason)];
+}
+
+double StatsAccumulator::meanScore() const
+{
+    if (games_ == 0) {
+        return 0.0;
+    }
+
+    double total = 0.0;
+    for (int food = 0; food < foodHistogram_.size(); ++food) {
+        total += static_cast<double>(foodHistogram_[food]) * food * Constants::kScorePerFood;
+    }
+    return total / games_;
+}
+
+int StatsAccumulator::scorePercentile(double fraction) const
+{
+    return histogramPercentile(foodHistogram_, fraction) * Constants::kScorePerFood;
+}
+
+int StatsAccumulator::lengthPercentile(double fraction) const
+{
+    return histogramPercentile(lengthHistogram_, fraction);
+}
+
+double StatsAccumulator::ticksQuantile(double fraction) const
+{
+    return ticksDigest_.quantile(fraction);
+}
+
+int StatsAccumulator::histogramPercentile(const QVector<qint64>& histogram, double fraction) const
+{
+    if (games_ == 0) {
+        return 0;
+    }
+
+    const qint64 rank = std::min<qint64>(games_ - 1, static_cast<qint64>(fraction * games_));
+    qint64 seen = 0;
+    for (int i = 0; i < histogram.size(); ++i) {
+        seen += histogram[i];
+        if (seen > rank) {
+            return i;
+        }
+    }
+    return histogram.size() - 1;
+}
+
+void StatsAccumulator::mergeHistogram(QVector<qint64>* into, const QVector<qint64>& from)
+{
+    if (into->size() < from.size()) {
+        into->resize(from.size());
+    }
+    for (int i = 0; i < from.size(); ++i) {
+        (*into)[i] += from[i];
+    }
+}
+
+}  // namespace SnakeGame
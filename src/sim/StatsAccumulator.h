@@ -0,0 +1,123 @@
+/**
+ * @file StatsAccumulator.h
+ * @brief 批量模拟统计累加器 - 每线程一份，结束时合并
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef STATSACCUMULATOR_H
+#define STATSACCUMULATOR_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <array>
+
+#include "GameOverReason.h"
+#include "ResultWriter.h"
+#include "TDigest.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 批量模拟统计累加器
+ *
+ * 不保存逐局记录：分数和蛇长用按格数封顶的直方图，
+ * 对局步数用 t-digest 估计分位数，结束原因只计数。
+ * 内存占用只与棋盘格数有关，与局数无关。
+ *
+ * 每个工作线程独占一份，批次结束后在主线程依次 merge()，无需加锁。
+ */
+class StatsAccumulator {
+public:
+    /**
+     * @brief 构造函数
+     * @param cellCount 棋盘格数（直方图上限）
+     */
+    explicit StatsAccumulator(int cellCount = 0);
+
+    /**
+     * @brief 记录一局结果
+     * @param result 单局结果
+     */
+    void add(const GameResult& result);
+
+    /**
+     * @brief 合并另一份累加器
+     * @param other 另一份累加器
+     */
+    void merge(const StatsAccumulator& other);
+
+    /**
+     * @brief 完成局数
+     */
+    qint64 games() const { return games_; }
+
+    /**
+     * @brief 总步数
+     */
+    qint64 ticks() const { return ticks_; }
+
+    /**
+     * @brief 超过步数上限的局数
+     */
+    qint64 timeouts() const { return timeouts_; }
+
+    /**
+     * @brief 按结束原因统计的局数
+     * @param reason 结束原因（BoardFilled 即获胜局数）
+     * @return 局数
+     */
+    qint64 reasonCount(GameOverReason reason) const;
+
+    /**
+     * @brief 平均分数
+     */
+    double meanScore() const;
+
+    /**
+     * @brief 分数分位数
+     * @param fraction 分位 [0, 1]
+     * @return 分数
+     */
+    int scorePercentile(double fraction) const;
+
+    /**
+     * @brief 蛇长分位数
+     * @param fraction 分位 [0, 1]
+     * @return 蛇长
+     */
+    int lengthPercentile(double fraction) const;
+
+    /**
+     * @brief 对局步数分位数（t-digest 估计）
+     * @param fraction 分位 [0, 1]
+     * @return 步数
+     */
+    double ticksQuantile(double fraction) const;
+
+private:
+    qint64 games_;                              ///< 完成局数
+    qint64 ticks_;                              ///< 总步数
+    qint64 timeouts_;                           ///< 超时局数
+    std::array<qint64, 4> reasonCounts_;        ///< 按 GameOverReason 计数
+    QVector<qint64> foodHistogram_;             ///< 按吃到的食物数统计的局数
+    QVector<qint64> lengthHistogram_;           ///< 按最终蛇长统计的局数
+    TDigest ticksDigest_;                       ///< 对局步数草图
+
+    /**
+     * @brief 直方图分位数
+     * @param histogram 直方图
+     * @param fraction 分位 [0, 1]
+     * @return 下标
+     */
+    int histogramPercentile(const QVector<qint64>& histogram, double fraction) const;
+
+    /**
+     * @brief 合并直方图（长度不同时补齐）
+     */
+    static void mergeHistogram(QVector<qint64>* into, const QVector<qint64>& from);
+};
+
+}  // namespace SnakeGame
+
+#endif  // STATSACCUMULATOR_H
@@ -0,0 +1,138 @@
+/**
+ * @file TDigest.cpp
+ * @brief t-digest 分位数草图实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "TDigest.h"
+#include <algorithm>
+#include <limits>
+
+namespace SnakeGame {
+
+namespace {
+
+/** @brief 缓冲区容量相对压缩参数的倍数 */
+constexpr int kBufferFactor = 5;
+
+}  // namespace
+
+TDigest::TDigest(double compression)
+    : compression_(compression)
+    , bufferLimit_(static_cast<size_t>(compression) * kBufferFactor)
+    , totalWeight_(0.0)
+    , min_(std::numeric_limits<double>::max())
+    , max_(std::numeric_limits<double>::lowest())
+{
+    // 压缩时质心会临时并入缓冲区，一次预留到位
+    const size_t maxCentroids = static_cast<size_t>(compression_) * 2;
+    buffer_.reserve(bufferLimit_ + maxCentroids);
+    centroids_.reserve(maxCentroids);
+}
+
+void TDigest::add(double value, double weight)
+{
+    if (buffer_.size() >= bufferLimit_) {
+        compress();
+    }
+
+    buffer_.push_back(Centroid{value, weight});
+    totalWeight_ += weight;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+}
+
+void TDigest::merge(const TDigest& other)
+{
+    other.compress();
+    for (const Centroid& centroid : other.centroids_) {
+        if (buffer_.size() >= bufferLimit_) {
+            compress();
+        }
+        buffer_.push_back(centroid);
+    }
+
+    totalWeight_ += other.totalWeight_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+double TDigest::quantile(double fraction) const
+{
+    compress();
+    if (centroids_.empty()) {
+        return 0.0;
+    }
+    if (fraction <= 0.0) {
+        return min_;
+    }
+    if (fraction >= 1.0) {
+        return max_;
+    }
+
+    // 每个质心的权重集中在其中点，相邻中点之间线性插值
+    const double target = fraction * totalWeight_;
+    double cumulative = 0.0;
+    double previousMid = 0.0;
+    double previousMean = min_;
+
+    for (const Centroid& centroid : centroids_) {
+        const double mid = cumulative + centroid.weight / 2.0;
+        if (target < mid) {
+            const double span = mid - previousMid;
+            const double t = span > 0.0 ? (target - previousMid) / span : 0.0;
+            return previousMean + t * (centroid.mean - previousMean);
+        }
+        cumulative += centroid.weight;
+        previousMid = mid;
+        previousMean = centroid.mean;
+    }
+
+    const double span = totalWeight_ - previousMid;
+    const double t = span > 0.0 ? (target - previousMid) / span : 0.0;
+    return previousMean + t * (max_ - previousMean);
+}
+
+void TDigest::compress() const
+{
+    if (buffer_.empty()) {
+        return;
+    }
+
+    // 质心和缓冲区合在 buffer_ 中排序，再写回 centroids_，不额外分配
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    std::sort(buffer_.begin(), buffer_.end(),
+              [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+    centroids_.clear();
+
+    double total = 0.0;
+    for (const Centroid& centroid : buffer_) {
+        total += centroid.weight;
+    }
+
+    Centroid current = buffer_.front();
+    double before = 0.0;
+    for (size_t i = 1; i < buffer_.size(); ++i) {
+        const Centroid& next = buffer_[i];
+        const double merged = current.weight + next.weight;
+
+        // 质心权重上限 4·N·q·(1-q)/δ：两端质心小，中间质心大
+        const double q = (before + merged / 2.0) / total;
+        const double limit = 4.0 * total * q * (1.0 - q) / compression_;
+
+        if (merged <= limit) {
+            current.mean += (next.mean - current.mean) * next.weight / merged;
+            current.weight = merged;
+        } else {
+            before += current.weight;
+            centroids_.push_back(current);
+            current = next;
+        }
+    }
+    centroids_.push_back(current);
+
+    buffer_.clear();
+}
+
+}  // namespace SnakeGame
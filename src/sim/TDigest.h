@@ -0,0 +1,92 @@
+/**
+ * @file TDigest.h
+ * @brief t-digest 分位数草图 - 固定内存、可合并
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#include <cstddef>
+#include <vector>
+
+namespace SnakeGame {
+
+/**
+ * @brief t-digest 分位数草图（合并式实现）
+ *
+ * 数据点先写入固定容量的缓冲区，满后与已有质心一起排序压缩。
+ * 质心容量受压缩参数限制，内存占用与样本数无关；
+ * 两端分位的精度高于中间分位，适合统计对局步数的长尾。
+ */
+class TDigest {
+public:
+    /**
+     * @brief 构造函数
+     * @param compression 压缩参数，越大越精确（质心数约为其 2 倍）
+     */
+    explicit TDigest(double compression = 100.0);
+
+    /**
+     * @brief 加入一个样本
+     * @param value 样本值
+     * @param weight 样本权重
+     */
+    void add(double value, double weight = 1.0);
+
+    /**
+     * @brief 合并另一个草图
+     * @param other 另一个草图
+     */
+    void merge(const TDigest& other);
+
+    /**
+     * @brief 估计分位数
+     * @param fraction 分位 [0, 1]
+     * @return 估计值，没有样本时返回 0
+     */
+    double quantile(double fraction) const;
+
+    /**
+     * @brief 样本总权重
+     * @return 总权重
+     */
+    double count() const { return totalWeight_; }
+
+    /**
+     * @brief 样本最小值
+     */
+    double min() const { return min_; }
+
+    /**
+     * @brief 样本最大值
+     */
+    double max() const { return max_; }
+
+private:
+    /**
+     * @brief 质心
+     */
+    struct Centroid {
+        double mean;        ///< 均值
+        double weight;      ///< 权重
+    };
+
+    double compression_;                        ///< 压缩参数
+    size_t bufferLimit_;                        ///< 缓冲区样本数上限
+    mutable std::vector<Centroid> centroids_;   ///< 已压缩的质心（按均值排序）
+    mutable std::vector<Centroid> buffer_;      ///< 尚未压缩的样本
+    double totalWeight_;                        ///< 总权重
+    double min_;                                ///< 最小值
+    double max_;                                ///< 最大值
+
+    /**
+     * @brief 将缓冲区并入质心
+     */
+    void compress() const;
+};
+
+}  // namespace SnakeGame
+
+#endif  // TDIGEST_H
@@ -0,0 +1,292 @@
+/**
+ * @file main.cpp
+ * @brief 批量模拟命令行程序入口（仅依赖 SnakeCore）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <cstdio>
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "EventLog.h"
+#include "GameLogic.h"
+#include "PerfectSolver.h"
+#include "PolicyTable.h"
+#include "ResultWriter.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/**
+ * @brief 输出汇总
+ * @param config 模拟配置
+ * @param summary 汇总结果
+ */
+void printSummary(const BatchConfig& config, const BatchSummary& summary)
+{
+    const double seconds = summary.elapsedSeconds > 0.0 ? summary.elapsedSeconds : 1e-9;
+
+    const StatsAccumulator& stats = summary.stats;
+
+    std::fprintf(stderr,
+                 "controller=%s board=%dx%d games=%lld ticks=%lld elapsed=%.3fs\n"
+                 "throughput: %.1f games/s, %.0f ticks/s\n"
+                 "outcomes: won=%lld wall=%lld self=%lld timeout=%lld\n"
+                 "score: mean=%.1f p10=%d p50=%d p90=%d p99=%d max=%d\n"
+                 "length: p10=%d p50=%d p90=%d p99=%d max=%d\n"
+                 "ticks/game: p10=%.0f p50=%.0f p90=%.0f p99=%.0f max=%.0f\n",
+                 qPrintable(config.controller), config.boardWidth, config.boardHeight,
+                 static_cast<long long>(stats.games()), static_cast<long long>(stats.ticks()),
+                 summary.elapsedSeconds,
+                 stats.games() / seconds, stats.ticks() / seconds,
+                 static_cast<long long>(stats.reasonCount(GameOverReason::BoardFilled)),
+                 static_cast<long long>(stats.reasonCount(GameOverReason::WallCollision)),
+                 static_cast<long long>(stats.reasonCount(GameOverReason::SelfCollision)),
+                 static_cast<long long>(stats.timeouts()),
+                 stats.meanScore(),
+                 stats.scorePercentile(0.10), stats.scorePercentile(0.50),
+                 stats.scorePercentile(0.90), stats.scorePercentile(0.99),
+                 stats.scorePercentile(1.0),
+                 stats.lengthPercentile(0.10), stats.lengthPercentile(0.50),
+                 stats.lengthPercentile(0.90), stats.lengthPercentile(0.99),
+                 stats.lengthPercentile(1.0),
+                 stats.ticksQuantile(0.10), stats.ticksQuantile(0.50),
+                 stats.ticksQuantile(0.90), stats.ticksQuantile(0.99),
+                 stats.ticksQuantile(1.0));
+}
+
+/**
+ * @brief 从开局求解最优策略并写入策略文件
+ * @param config 模拟配置（使用其中的棋盘尺寸）
+ * @param path 策略文件路径
+ * @return 0 成功，1 棋盘不支持或超出局面数上限，2 无法写入文件
+ */
+int writePolicy(const BatchConfig& config, const QString& path)
+{
+    PerfectSolver solver(config.boardWidth, config.boardHeight);
+    if (!solver.isSupported()) {
+        std::fprintf(stderr, "The perfect solver supports at most %d cells\n",
+                     PerfectSolver::kMaxCells);
+        return 1;
+    }
+
+    GameLogic probe(config.boardWidth, config.boardHeight);
+    probe.resetGame();
+
+    PerfectSolver::Result opening;
+    if (!solver.solveOpening(probe.getSnakeBody(), &opening)) {
+        std::fprintf(stderr, "Solver exceeded its state limit on a %dx%d board\n",
+                     config.boardWidth, config.boardHeight);
+        return 1;
+    }
+    if (!solver.savePolicy(path)) {
+        std::fprintf(stderr, "Cannot write policy file: %s\n", qPrintable(path));
+        return 2;
+    }
+
+    std::fprintf(stderr, "policy: board=%dx%d states=%d win=%.4f expected moves=%.1f -> %s\n",
+                 config.boardWidth, config.boardHeight, solver.stateCount(),
+                 opening.winProbability, opening.expectedMoves, qPrintable(path));
+    return 0;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @param argc 命令行参数数量
+ * @param argv 命令行参数
+ * @return 0 成功，1 参数错误，2 无法打开输出文件
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCoreApplication::setApplicationName("SnakeSim");
+    QCoreApplication::setApplicationVersion("1.0.0");
+    QCoreApplication::setOrganizationName("SnakeGame Team");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless batch simulation of Snake games.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    QCommandLineOption gamesOption("games", "Number of games to play.", "n", "1000");
+    QCommandLineOption controllerOption("controller",
+        "Controller: random, greedy, hamilton or perfect.", "name", "hamilton");
+    QCommandLineOption threadsOption("threads", "Worker threads (0 = all cores).", "n", "0");
+    QCommandLineOption widthOption("width", "Board width in cells.", "cells",
+        QString::number(Constants::kDefaultBoardWidth));
+    QCommandLineOption heightOption("height", "Board height in cells.", "cells",
+        QString::number(Constants::kDefaultBoardHeight));
+    QCommandLineOption seedOption("seed", "Base random seed.", "seed", "1");
+    QCommandLineOption levelOption("level",
+        "Level file with obstacles and edge wrapping; sets the board size.", "path", "");
+    QCommandLineOption foodsOption("foods", "Number of food items on the board at once.", "k", "1");
+    QCommandLineOption distanceOption("distance-field",
+        "Maintain an incremental distance-to-food field; greedy then steers by real path length.");
+    QCommandLineOption compactOption("compact-body",
+        "Store the snake as 2-bit directions (O(1) moves, 1/32 of the memory); no wrapping levels.");
+    QCommandLineOption maxTicksOption("max-ticks",
+        "Per-game tick limit (0 = cells squared).", "n", "0");
+    QCommandLineOption formatOption("format", "Per-game output format: csv or json.", "format", "csv");
+    QCommandLineOption outputOption("output",
+        "Per-game output file ('-' = stdout, empty = none).", "path", "");
+    QCommandLineOption progressOption("progress", "Progress report interval in seconds.", "s", "0");
+    QCommandLineOption heatmapOption("heatmap",
+        "Collect cell heatmaps; writes <prefix>.bin and <prefix>-<layer>.png.", "prefix", "");
+    QCommandLineOption policyOption("policy",
+        "Policy file for the perfect controller (written by --write-policy).", "path", "");
+    QCommandLineOption writePolicyOption("write-policy",
+        "Solve the board from the opening, write the perfect policy to <path> and exit.", "path");
+    QCommandLineOption verboseOption("verbose", "Keep debug, info and warning events from the core (default: errors only).");
+
+    parser.addOptions({gamesOption, controllerOption, threadsOption, widthOption, heightOption,
+                       seedOption, foodsOption, levelOption, distanceOption, compactOption,
+                       maxTicksOption, formatOption, outputOption, progressOption,
+                       heatmapOption, policyOption, writePolicyOption, verboseOption});
+    parser.process(app);
+
+    BatchConfig config;
+    config.games = parser.value(gamesOption).toLongLong();
+    config.controller = parser.value(controllerOption).toLower();
+    config.threads = parser.value(threadsOption).toInt();
+    config.boardWidth = parser.value(widthOption).toInt();
+    config.boardHeight = parser.value(heightOption).toInt();
+    config.seed = parser.value(seedOption).toULongLong();
+    config.foodCount = parser.value(foodsOption).toInt();
+    config.distanceField = parser.isSet(distanceOption);
+    config.compactBody = parser.isSet(compactOption);
+    config.maxTicks = parser.value(maxTicksOption).toLongLong();
+    config.progressInterval = parser.value(progressOption).toInt();
+
+    const QString heatmapPrefix = parser.value(heatmapOption);
+    config.heatmap = !heatmapPrefix.isEmpty();
+
+    if (!ControllerFactory::isKnown(config.controller)) {
+        std::fprintf(stderr, "Unknown controller: %s\n", qPrintable(config.controller));
+        return 1;
+    }
+    if (config.games <= 0 || config.boardWidth < 2 || config.boardHeight < 2) {
+        std::fprintf(stderr, "Invalid games or board size\n");
+        return 1;
+    }
+    if (config.foodCount < 1) {
+        std::fprintf(stderr, "Invalid food count\n");
+        return 1;
+    }
+
+    const QString levelPath = parser.value(levelOption);
+    if (!levelPath.isEmpty()) {
+        // 只映射一次，所有工作线程共享同一份只读位图
+        auto level = std::make_shared<Level>();
+        if (!level->open(levelPath)) {
+            std::fprintf(stderr, "Cannot open level: %s\n", qPrintable(levelPath));
+            return 1;
+        }
+        config.boardWidth = level->getWidth();
+        config.boardHeight = level->getHeight();
+
+        GameLogic probe(config.boardWidth, config.boardHeight);
+        if (!probe.setLevel(level)) {
+            std::fprintf(stderr, "Level start position is blocked: %s\n", qPrintable(levelPath));
+            return 1;
+        }
+        if (config.compactBody && level->wraps()) {
+            std::fprintf(stderr, "--compact-body does not support wrapping levels\n");
+            return 1;
+        }
+        if (config.controller == "perfect" && level->getObstacleCount() > 0) {
+            std::fprintf(stderr, "The perfect controller does not support obstacles\n");
+            return 1;
+        }
+        config.level = std::move(level);
+    }
+
+    if (config.controller == "perfect" &&
+        !PerfectSolver(config.boardWidth, config.boardHeight).isSupported()) {
+        std::fprintf(stderr, "The perfect controller supports at most %d cells, the board has %d\n",
+                     PerfectSolver::kMaxCells, config.boardWidth * config.boardHeight);
+        return 1;
+    }
+
+    if (parser.isSet(writePolicyOption)) {
+        if (config.level) {
+            std::fprintf(stderr, "--write-policy does not support levels\n");
+            return 1;
+        }
+        return writePolicy(config, parser.value(writePolicyOption));
+    }
+
+    const QString policyPath = parser.value(policyOption);
+    if (!policyPath.isEmpty()) {
+        // 只映射一次，所有工作线程共享同一份只读策略表
+        auto policy = std::make_shared<PolicyTable>();
+        if (!policy->open(policyPath)) {
+            std::fprintf(stderr, "Cannot open policy: %s\n", qPrintable(policyPath));
+            return 1;
+        }
+        if (policy->getBoardWidth() != config.boardWidth ||
+            policy->getBoardHeight() != config.boardHeight) {
+            std::fprintf(stderr, "Policy is for a %dx%d board, not %dx%d\n",
+                         policy->getBoardWidth(), policy->getBoardHeight(),
+                         config.boardWidth, config.boardHeight);
+            return 1;
+        }
+        config.policy = std::move(policy);
+    }
+
+    const QString formatName = parser.value(formatOption).toLower();
+    if (formatName != "csv" && formatName != "json") {
+        std::fprintf(stderr, "Unknown format: %s\n", qPrintable(formatName));
+        return 1;
+    }
+    const ResultWriter::Format format = formatName == "json" ? ResultWriter::Format::JsonLines
+                                                             : ResultWriter::Format::Csv;
+
+    // 核心库每局结束都可能记录事件（获胜、无处放置食物），批量运行时默认只保留错误
+    EventLog::setLevel(parser.isSet(verboseOption) ? LogLevel::Debug : LogLevel::Error);
+
+    // 逐局结果流式写出，长时间运行中途中断也不会丢失已完成的局
+    FILE* out = nullptr;
+    const QString outputPath = parser.value(outputOption);
+    if (outputPath == "-") {
+        out = stdout;
+    } else if (!outputPath.isEmpty()) {
+        out = std::fopen(QFile::encodeName(outputPath).constData(), "wb");
+        if (!out) {
+            std::fprintf(stderr, "Cannot open output file: %s\n", qPrintable(outputPath));
+            return 2;
+        }
+    }
+
+    std::unique_ptr<ResultWriter> writer;
+    if (out) {
+        writer = std::make_unique<ResultWriter>(out, format);
+    }
+
+    BatchRunner runner(config, writer.get());
+    const BatchSummary summary = runner.run();
+    printSummary(config, summary);
+
+    if (config.heatmap) {
+        bool saved = summary.heatmap.saveBinary(heatmapPrefix + ".bin");
+        for (int layer = 0; layer < Heatmap::LayerCount; ++layer) {
+            const Heatmap::Layer which = static_cast<Heatmap::Layer>(layer);
+            saved = summary.heatmap.savePng(
+                which, heatmapPrefix + "-" + Heatmap::layerName(which) + ".png") && saved;
+        }
+        if (!saved) {
+            std::fprintf(stderr, "Failed to write heatmap files: %s\n", qPrintable(heatmapPrefix));
+        }
+    }
+
+    if (out && out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
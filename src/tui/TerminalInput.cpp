@@ -0,0 +1,179 @@
+/**
+ * @file TerminalInput.cpp
+ * @brief 终端键盘输入实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "TerminalInput.h"
+#include <QSocketNotifier>
+
+#ifdef Q_OS_UNIX
+#include <csignal>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace SnakeGame {
+
+#ifdef Q_OS_UNIX
+namespace {
+
+struct termios savedTermios;    ///< 切换前的终端设置
+bool termiosSaved = false;
+int signalPipe[2] = {-1, -1};   ///< 信号处理函数 → 事件循环的自管道
+volatile sig_atomic_t terminationPending = 0;
+
+/**
+ * @brief 恢复终端设置（只调用异步信号安全函数）
+ */
+void restoreTerminal()
+{
+    if (termiosSaved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+        const char showCursor[] = "\x1b[0m\x1b[?25h\n";
+        ssize_t ignored = write(STDOUT_FILENO, showCursor, sizeof(showCursor) - 1);
+        Q_UNUSED(ignored);
+    }
+}
+
+/**
+ * @brief Ctrl+C / kill 时通过自管道通知事件循环正常退出；
+ *        事件循环没有响应、再次收到信号时恢复终端并按默认方式退出
+ */
+void handleTerminationSignal(int signal)
+{
+    if (terminationPending) {
+        restoreTerminal();
+        std::signal(signal, SIG_DFL);
+        std::raise(signal);
+        return;
+    }
+    terminationPending = 1;
+    const char byte = static_cast<char>(signal);
+    ssize_t ignored = write(signalPipe[1], &byte, 1);
+    Q_UNUSED(ignored);
+}
+
+}  // namespace
+#endif
+
+TerminalInput::TerminalInput(QObject* parent)
+    : QObject(parent)
+    , notifier_(nullptr)
+    , signalNotifier_(nullptr)
+    , escapeState_(0)
+{
+#ifdef Q_OS_UNIX
+    // 信号处理函数只写自管道，退出在事件循环中完成，
+    // 录像索引和时间线等 aboutToQuit/析构时的收尾工作因此得以执行
+    if (signalPipe[0] < 0 && pipe(signalPipe) == 0) {
+        terminationPending = 0;
+        signalNotifier_ = new QSocketNotifier(signalPipe[0], QSocketNotifier::Read, this);
+        connect(signalNotifier_,
+                QOverload<QSocketDescriptor, QSocketNotifier::Type>::of(&QSocketNotifier::activated),
+                this, &TerminalInput::onSignal);
+        std::signal(SIGINT, handleTerminationSignal);
+        std::signal(SIGTERM, handleTerminationSignal);
+    }
+
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &savedTermios) != 0) {
+        return;
+    }
+    termiosSaved = true;
+
+    struct termios raw = savedTermios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+    notifier_ = new QSocketNotifier(STDIN_FILENO, QSocketNotifier::Read, this);
+    connect(notifier_, QOverload<QSocketDescriptor, QSocketNotifier::Type>::of(&QSocketNotifier::activated),
+            this, &TerminalInput::onReadyRead);
+#endif
+}
+
+TerminalInput::~TerminalInput()
+{
+#ifdef Q_OS_UNIX
+    if (termiosSaved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+        termiosSaved = false;
+    }
+    if (signalNotifier_) {
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+        delete signalNotifier_;
+        close(signalPipe[0]);
+        close(signalPipe[1]);
+        signalPipe[0] = signalPipe[1] = -1;
+    }
+#endif
+}
+
+void TerminalInput::onSignal()
+{
+#ifdef Q_OS_UNIX
+    char byte;
+    ssize_t ignored = read(signalPipe[0], &byte, 1);
+    Q_UNUSED(ignored);
+    emit terminationRequested();
+#endif
+}
+
+void TerminalInput::onReadyRead()
+{
+#ifdef Q_OS_UNIX
+    char keys[64];
+    const ssize_t count = read(STDIN_FILENO, keys, sizeof(keys));
+    if (count <= 0) {
+        // 标准输入已关闭，停止监听
+        notifier_->setEnabled(false);
+        return;
+    }
+
+    for (ssize_t i = 0; i < count; ++i) {
+        const char key = keys[i];
+
+        // 方向键：ESC [ A/B/C/D
+        if (escapeState_ == 1) {
+            escapeState_ = key == '[' ? 2 : 0;
+            if (escapeState_ == 2) {
+                continue;
+            }
+            emit pausePressed();  // 单独的 Esc
+        } else if (escapeState_ == 2) {
+            escapeState_ = 0;
+            switch (key) {
+                case 'A': emit directionPressed(Direction::Up);    break;
+                case 'B': emit directionPressed(Direction::Down);  break;
+                case 'C': emit directionPressed(Direction::Right); break;
+                case 'D': emit directionPressed(Direction::Left);  break;
+                default: break;
+            }
+            continue;
+        }
+
+        switch (key) {
+            case '\x1b': escapeState_ = 1; break;
+            case 'w': case 'W': emit directionPressed(Direction::Up);    break;
+            case 's': case 'S': emit directionPressed(Direction::Down);  break;
+            case 'a': case 'A': emit directionPressed(Direction::Left);  break;
+            case 'd': case 'D': emit directionPressed(Direction::Right); break;
+            case ' ': case '\n': case '\r': emit startPressed(); break;
+            case 'p': case 'P': emit pausePressed(); break;
+            case 'q': case 'Q': emit quitPressed(); break;
+            default: break;
+        }
+    }
+
+    // 读到末尾仍是单独的 Esc，按暂停处理
+    if (escapeState_ == 1) {
+        escapeState_ = 0;
+        emit pausePressed();
+    }
+#endif
+}
+
+}  // namespace SnakeGame
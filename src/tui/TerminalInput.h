@@ -0,0 +1,96 @@
+/**
+ * @file TerminalInput.h
+ * @brief 终端键盘输入 - 非规范模式读取标准输入
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef TERMINALINPUT_H
+#define TERMINALINPUT_H
+
+#include <QObject>
+#include "Direction.h"
+
+class QSocketNotifier;
+
+namespace SnakeGame {
+
+/**
+ * @brief 终端键盘输入
+ *
+ * 将标准输入切换为非规范、无回显模式，通过 QSocketNotifier
+ * 在事件循环中读取按键（WASD / 方向键 / 空格 / P / Q）。
+ * 仅在 Unix 终端上可用；标准输入不是终端时 isActive() 返回 false。
+ *
+ * 同时接管 SIGINT/SIGTERM：信号处理函数经自管道通知事件循环，
+ * 发出 terminationRequested()，由调用方正常退出事件循环；
+ * 第二次收到信号时恢复终端并立即退出。同一时刻只应有一个实例。
+ */
+class TerminalInput : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数 - 切换终端模式
+     * @param parent 父对象
+     */
+    explicit TerminalInput(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数 - 恢复终端模式
+     */
+    ~TerminalInput() override;
+
+    /**
+     * @brief 是否正在读取键盘输入
+     * @return true 表示可用
+     */
+    bool isActive() const { return notifier_ != nullptr; }
+
+signals:
+    /**
+     * @brief 方向键按下
+     * @param direction 方向
+     */
+    void directionPressed(Direction direction);
+
+    /**
+     * @brief 空格/回车按下（开始或重新开始）
+     */
+    void startPressed();
+
+    /**
+     * @brief P/Esc 按下（暂停或继续）
+     */
+    void pausePressed();
+
+    /**
+     * @brief Q 按下（退出）
+     */
+    void quitPressed();
+
+    /**
+     * @brief 收到 SIGINT/SIGTERM，应退出事件循环
+     */
+    void terminationRequested();
+
+private slots:
+    /**
+     * @brief 标准输入可读时解析按键
+     */
+    void onReadyRead();
+
+    /**
+     * @brief 自管道可读时转发终止信号
+     */
+    void onSignal();
+
+private:
+    QSocketNotifier* notifier_;         ///< 标准输入通知器（不可用时为空）
+    QSocketNotifier* signalNotifier_;   ///< 信号自管道通知器（不可用时为空）
+    int escapeState_;                   ///< 方向键转义序列解析状态
+};
+
+}  // namespace SnakeGame
+
+#endif  // TERMINALINPUT_H
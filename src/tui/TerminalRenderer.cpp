@@ -0,0 +1,177 @@
+/**
+ * @file TerminalRenderer.cpp
+ * @brief 终端渲染器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "TerminalRenderer.h"
+#include "Trace.h"
+
+namespace SnakeGame {
+
+namespace {
+
+// 每个格子占两列，使格子在终端中接近正方形
+const char kEmptyCell[] = "  ";
+const char kHeadCell[] = "\x1b[1;32m@@\x1b[0m";
+const char kBodyCell[] = "\x1b[32moo\x1b[0m";
+const char kFoodCell[] = "\x1b[1;31m**\x1b[0m";
+
+/** @brief 状态行所在终端行 */
+constexpr int kStatusRow = 1;
+
+/** @brief 棋盘上边框所在终端行 */
+constexpr int kBoardTopRow = 2;
+
+}  // namespace
+
+TerminalRenderer::TerminalRenderer(int boardWidth, int boardHeight, FILE* out, QObject* parent)
+    : QObject(parent)
+    , boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , out_(out)
+    , diff_(boardWidth, boardHeight)
+    , bytesWritten_(0)
+    , gameState_(GameState::Ready)
+    , score_(0)
+{
+    buffer_.reserve(4096);
+}
+
+TerminalRenderer::~TerminalRenderer()
+{
+    // 光标移到棋盘下方并恢复显示，避免破坏用户的终端
+    moveTo(kBoardTopRow + boardHeight_ + 2, 1);
+    buffer_.append("\x1b[0m\x1b[?25h");
+    flush();
+}
+
+void TerminalRenderer::onSnakeMoved(const QVector<QPoint>& body)
+{
+    const TraceSpan span("TerminalRenderer::onSnakeMoved");
+
+    if (diff_.setSnake(body)) {
+        redrawAll();
+    } else {
+        drawChanges();
+    }
+    flush();
+}
+
+void TerminalRenderer::onFoodsChanged(const QVector<QPoint>& positions)
+{
+    const TraceSpan span("TerminalRenderer::onFoodsChanged");
+
+    diff_.setFoods(positions);
+    drawChanges();
+    flush();
+}
+
+void TerminalRenderer::onGameStateChanged(GameState state)
+{
+    gameState_ = state;
+    diff_.invalidate();  // 回退或重开后的蛇身可能与上一帧无关，下一帧整屏重绘
+    drawStatus();
+    flush();
+}
+
+void TerminalRenderer::onRewound()
+{
+    diff_.invalidate();
+}
+
+void TerminalRenderer::onScoreChanged(int score)
+{
+    score_ = score;
+    drawStatus();
+    flush();
+}
+
+void TerminalRenderer::redrawAll()
+{
+    // 清屏并隐藏光标
+    buffer_.append("\x1b[0m\x1b[2J\x1b[?25l");
+
+    // 边框
+    const QByteArray horizontal = "+" + QByteArray(boardWidth_ * 2, '-') + "+";
+    moveTo(kBoardTopRow, 1);
+    buffer_.append(horizontal);
+    for (int y = 0; y < boardHeight_; ++y) {
+        moveTo(kBoardTopRow + 1 + y, 1);
+        buffer_.append('|');
+        moveTo(kBoardTopRow + 1 + y, boardWidth_ * 2 + 2);
+        buffer_.append('|');
+    }
+    moveTo(kBoardTopRow + boardHeight_ + 1, 1);
+    buffer_.append(horizontal);
+
+    // 清屏后只需画出非空格子
+    for (int y = 0; y < boardHeight_; ++y) {
+        for (int x = 0; x < boardWidth_; ++x) {
+            const BoardDiff::Cell cell = diff_.cellAt(x, y);
+            if (cell != BoardDiff::Cell::Empty) {
+                drawCell(QPoint(x, y), cell);
+            }
+        }
+    }
+
+    drawStatus();
+}
+
+void TerminalRenderer::drawChanges()
+{
+    for (const BoardDiff::Change& change : diff_.changes()) {
+        drawCell(change.pos, change.cell);
+    }
+}
+
+void TerminalRenderer::drawCell(const QPoint& pos, BoardDiff::Cell cell)
+{
+    moveTo(kBoardTopRow + 1 + pos.y(), pos.x() * 2 + 2);
+    switch (cell) {
+        case BoardDiff::Cell::Empty: buffer_.append(kEmptyCell); break;
+        case BoardDiff::Cell::Head:  buffer_.append(kHeadCell);  break;
+        case BoardDiff::Cell::Body:  buffer_.append(kBodyCell);  break;
+        case BoardDiff::Cell::Food:  buffer_.append(kFoodCell);  break;
+    }
+}
+
+void TerminalRenderer::drawStatus()
+{
+    const char* status = "";
+    switch (gameState_) {
+        case GameState::Ready:    status = "Press SPACE to start"; break;
+        case GameState::Running:  status = "Running"; break;
+        case GameState::Paused:   status = "Paused - press P to resume"; break;
+        case GameState::GameOver: status = "Game over - press SPACE to restart"; break;
+    }
+
+    moveTo(kStatusRow, 1);
+    buffer_.append("\x1b[2KScore: ");
+    buffer_.append(QByteArray::number(score_));
+    buffer_.append("  ");
+    buffer_.append(status);
+}
+
+void TerminalRenderer::moveTo(int row, int column)
+{
+    buffer_.append("\x1b[");
+    buffer_.append(QByteArray::number(row));
+    buffer_.append(';');
+    buffer_.append(QByteArray::number(column));
+    buffer_.append('H');
+}
+
+void TerminalRenderer::flush()
+{
+    if (buffer_.isEmpty()) {
+        return;
+    }
+    std::fwrite(buffer_.constData(), 1, static_cast<size_t>(buffer_.size()), out_);
+    std::fflush(out_);
+    bytesWritten_ += buffer_.size();
+    buffer_.resize(0);  // 保留已预留的容量
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,138 @@
+/**
+ * @file TerminalRenderer.h
+ * @brief 终端渲染器 - 使用 ANSI 转义序列增量绘制棋盘
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef TERMINALRENDERER_H
+#define TERMINALRENDERER_H
+
+#include <QByteArray>
+#include <QObject>
+#include <QPoint>
+#include <QVector>
+#include <cstdio>
+#include "BoardDiff.h"
+#include "Constants.h"
+#include "GameState.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 终端渲染器
+ *
+ * 与图形渲染组件实现相同的槽函数接口，只依赖 QtCore，
+ * 可在没有显示设备的服务器上运行。
+ *
+ * 首帧清屏并绘制边框，之后每帧只输出 BoardDiff 给出的变化格子的
+ * 光标移动和字符，因此每帧输出字节数与棋盘大小和蛇长无关；
+ * 游戏状态变化后整屏重绘一次。
+ */
+class TerminalRenderer : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param out 输出流（默认标准输出）
+     * @param parent 父对象
+     */
+    explicit TerminalRenderer(int boardWidth = Constants::kDefaultBoardWidth,
+                              int boardHeight = Constants::kDefaultBoardHeight,
+                              FILE* out = stdout,
+                              QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数 - 恢复光标并移到棋盘下方
+     */
+    ~TerminalRenderer() override;
+
+    /**
+     * @brief 获取累计输出字节数
+     * @return 字节数
+     */
+    qint64 bytesWritten() const { return bytesWritten_; }
+
+public slots:
+    /**
+     * @brief 更新蛇身数据
+     * @param body 蛇身坐标列表
+     */
+    void onSnakeMoved(const QVector<QPoint>& body);
+
+    /**
+     * @brief 更新食物位置
+     * @param positions 全部食物坐标
+     */
+    void onFoodsChanged(const QVector<QPoint>& positions);
+
+    /**
+     * @brief 更新游戏状态
+     * @param state 游戏状态
+     */
+    void onGameStateChanged(GameState state);
+
+    /**
+     * @brief 蛇身发生跳转（回退、录像跳转）后调用，下一帧整帧重绘
+     */
+    void onRewound();
+
+    /**
+     * @brief 更新分数
+     * @param score 当前分数
+     */
+    void onScoreChanged(int score);
+
+private:
+    int boardWidth_;            ///< 游戏区域宽度（格数）
+    int boardHeight_;           ///< 游戏区域高度（格数）
+    FILE* out_;                 ///< 输出流
+
+    QByteArray buffer_;         ///< 本帧待输出内容
+    BoardDiff diff_;            ///< 屏幕上每个格子当前的内容与本次变化
+    qint64 bytesWritten_;       ///< 累计输出字节数
+
+    GameState gameState_;       ///< 当前游戏状态
+    int score_;                 ///< 当前分数
+
+    /**
+     * @brief 整帧重绘：清屏、边框、diff_ 中的蛇和食物以及状态行
+     */
+    void redrawAll();
+
+    /**
+     * @brief 重绘 diff_ 给出的变化格子
+     */
+    void drawChanges();
+
+    /**
+     * @brief 重绘单个格子
+     * @param pos 格子坐标
+     * @param cell 格子内容
+     */
+    void drawCell(const QPoint& pos, BoardDiff::Cell cell);
+
+    /**
+     * @brief 重绘状态行
+     */
+    void drawStatus();
+
+    /**
+     * @brief 追加光标移动序列
+     * @param row 终端行（从 1 开始）
+     * @param column 终端列（从 1 开始）
+     */
+    void moveTo(int row, int column);
+
+    /**
+     * @brief 将本帧内容写入输出流
+     */
+    void flush();
+};
+
+}  // namespace SnakeGame
+
+#endif  // TERMINALRENDERER_H
@@ -0,0 +1,241 @@
+/**
+ * @file main.cpp
+ * @brief 终端版贪吃蛇程序入口（仅依赖 QtCore）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QStringList>
+#include <QTimer>
+#include "ControllerFactory.h"
+#include "GameLogic.h"
+#include "HamiltonController.h"
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+#include "Trace.h"
+#include "TerminalInput.h"
+#include "TerminalRenderer.h"
+
+using namespace SnakeGame;
+
+/**
+ * @brief 取形如 --name=value 的参数值
+ * @param args 命令行参数列表
+ * @param prefix 参数前缀（含等号）
+ * @return 参数值，未指定时为空
+ */
+QString optionValue(const QStringList& args, const QString& prefix)
+{
+    for (const QString& arg : args) {
+        if (arg.startsWith(prefix)) {
+            return arg.mid(prefix.size());
+        }
+    }
+    return QString();
+}
+
+/**
+ * @brief 播放录像
+ * @param app 应用对象
+ * @param path 录像文件路径
+ * @param startFrame 起始帧
+ * @return 应用程序退出码，无法打开录像时为 1
+ *
+ * 空格/P 暂停或继续，←/→ 跳转 kRewindSeconds 秒，↑/↓ 跳转录像总长的 1/10。
+ */
+int playReplay(QCoreApplication& app, const QString& path, qint64 startFrame)
+{
+    ReplayReader reader;
+    if (!reader.open(path) || !reader.seek(startFrame)) {
+        qWarning() << "Cannot open replay:" << path;
+        return 1;
+    }
+    if (reader.isRecovered()) {
+        qWarning() << "Replay was not closed cleanly, index rebuilt:" << path;
+    }
+
+    TerminalRenderer renderer(reader.getBoardWidth(), reader.getBoardHeight());
+    TerminalInput input;
+    QTimer timer;
+    timer.setTimerType(Qt::PreciseTimer);
+    timer.setInterval(Constants::kGameTickInterval);
+
+    auto show = [&reader, &renderer](bool jumped) {
+        const ReplayFrame& frame = reader.current();
+        if (jumped) {
+            // 跳转后蛇身与上一帧无关，让渲染器整体重绘
+            renderer.onRewound();
+        }
+        renderer.onFoodsChanged(frame.foods);
+        renderer.onSnakeMoved(frame.body);
+        renderer.onScoreChanged(frame.score);
+    };
+    auto setPlaying = [&timer, &renderer](bool playing) {
+        if (playing) {
+            timer.start();
+        } else {
+            timer.stop();
+        }
+        renderer.onGameStateChanged(playing ? GameState::Running : GameState::Paused);
+    };
+
+    QObject::connect(&timer, &QTimer::timeout, &app, [&]() {
+        if (reader.step()) {
+            show(false);
+        } else {
+            timer.stop();
+            renderer.onGameStateChanged(GameState::GameOver);
+            if (!input.isActive()) {
+                // 没有终端输入时无法操作，播完即退出
+                app.quit();
+            }
+        }
+    });
+    QObject::connect(&input, &TerminalInput::pausePressed, &app, [&]() {
+        setPlaying(!timer.isActive());
+    });
+    QObject::connect(&input, &TerminalInput::startPressed, &app, [&]() {
+        setPlaying(!timer.isActive());
+    });
+    QObject::connect(&input, &TerminalInput::directionPressed, &app, [&](Direction direction) {
+        const qint64 seconds = Constants::kRewindSeconds * 1000 / Constants::kGameTickInterval;
+        const qint64 tenth = qMax<qint64>(reader.frameCount() / 10, 1);
+        qint64 target = reader.current().frame;
+        switch (direction) {
+            case Direction::Left:  target -= seconds; break;
+            case Direction::Right: target += seconds; break;
+            case Direction::Down:  target -= tenth; break;
+            case Direction::Up:    target += tenth; break;
+        }
+        if (reader.seek(target)) {
+            show(true);
+        }
+    });
+    QObject::connect(&input, &TerminalInput::quitPressed, &app, &QCoreApplication::quit);
+    QObject::connect(&input, &TerminalInput::terminationRequested,
+                     &app, &QCoreApplication::quit);
+
+    show(true);
+    setPlaying(true);
+    return app.exec();
+}
+
+/**
+ * @brief 程序入口
+ * @param argc 命令行参数数量
+ * @param argv 命令行参数
+ * @return 应用程序退出码
+ *
+ * 参数：
+ *   --autopilot=<name>            自动驾驶：random/greedy/hamilton/perfect（无终端输入时默认 hamilton）
+ *   --loop                        游戏结束后自动重新开始（用于长时间运行）
+ *   --record=<file>               把对局录制到文件
+ *   --replay=<file>               播放录像（不进行游戏）
+ *   --seek=<frame>                播放录像时的起始帧
+ *   --trace=<file>                退出时导出 Chrome Trace 时间线
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCoreApplication::setApplicationName("Snake Game (Terminal)");
+    QCoreApplication::setApplicationVersion("1.0.0");
+    QCoreApplication::setOrganizationName("SnakeGame Team");
+
+    const QStringList args = QCoreApplication::arguments();
+
+    const QString tracePath = optionValue(args, "--trace=");
+    if (!tracePath.isEmpty()) {
+        // 录像播放与游戏两条路径都在退出事件循环时导出
+        Trace::start();
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [tracePath]() {
+            Trace::stop();
+            if (!Trace::writeJson(tracePath)) {
+                qWarning() << "Cannot write trace file:" << tracePath;
+            }
+        });
+    }
+
+    const QString replayPath = optionValue(args, "--replay=");
+    if (!replayPath.isEmpty()) {
+        return playReplay(app, replayPath, optionValue(args, "--seek=").toLongLong());
+    }
+
+    // 先于 GameLogic 构造，保证析构时最后关闭并写出索引
+    ReplayWriter recorder;
+    GameLogic gameLogic;
+    TerminalInput input;
+
+    const QString autopilotName = optionValue(args, "--autopilot=").toLower();
+    std::unique_ptr<Controller> controller = ControllerFactory::create(
+        autopilotName, gameLogic.getBoardWidth(), gameLogic.getBoardHeight());
+    if (!controller && !autopilotName.isEmpty()) {
+        qWarning() << "Unknown autopilot:" << autopilotName << ", ignoring";
+    }
+    if (!controller && !input.isActive()) {
+        // 没有键盘可用时无法手动操作，改用自动驾驶
+        controller = std::make_unique<HamiltonController>();
+    }
+    const bool autopilot = controller != nullptr;
+    gameLogic.setController(std::move(controller));
+
+    const QString recordPath = optionValue(args, "--record=");
+    if (!recordPath.isEmpty()) {
+        if (recorder.open(recordPath, gameLogic.getBoardWidth(), gameLogic.getBoardHeight())) {
+            gameLogic.setRecorder(&recorder);
+        } else {
+            qWarning() << "Cannot create replay file:" << recordPath;
+        }
+    }
+
+    TerminalRenderer renderer(gameLogic.getBoardWidth(), gameLogic.getBoardHeight());
+
+    // 后端 → 终端渲染
+    QObject::connect(&gameLogic, &GameLogic::snakeMoved,
+                     &renderer, &TerminalRenderer::onSnakeMoved);
+    QObject::connect(&gameLogic, &GameLogic::foodsChanged,
+                     &renderer, &TerminalRenderer::onFoodsChanged);
+    QObject::connect(&gameLogic, &GameLogic::gameStateChanged,
+                     &renderer, &TerminalRenderer::onGameStateChanged);
+    QObject::connect(&gameLogic, &GameLogic::rewound,
+                     &renderer, &TerminalRenderer::onRewound);
+    QObject::connect(&gameLogic, &GameLogic::scoreChanged,
+                     &renderer, &TerminalRenderer::onScoreChanged);
+
+    // 键盘 → 后端
+    QObject::connect(&input, &TerminalInput::directionPressed,
+                     &gameLogic, &GameLogic::setDirection);
+    QObject::connect(&input, &TerminalInput::startPressed, &gameLogic, [&gameLogic]() {
+        if (gameLogic.getState() == GameState::Ready ||
+            gameLogic.getState() == GameState::GameOver) {
+            gameLogic.startGame();
+        }
+    });
+    QObject::connect(&input, &TerminalInput::pausePressed, &gameLogic, [&gameLogic]() {
+        if (gameLogic.getState() == GameState::Running) {
+            gameLogic.pauseGame();
+        } else if (gameLogic.getState() == GameState::Paused) {
+            gameLogic.resumeGame();
+        }
+    });
+    QObject::connect(&input, &TerminalInput::quitPressed, &app, &QCoreApplication::quit);
+    QObject::connect(&input, &TerminalInput::terminationRequested,
+                     &app, &QCoreApplication::quit);
+
+    if (args.contains("--loop")) {
+        QObject::connect(&gameLogic, &GameLogic::gameOver, &gameLogic, [&gameLogic](int) {
+            QTimer::singleShot(Constants::kGameTickInterval * 5, &gameLogic, &GameLogic::startGame);
+        });
+    }
+
+    if (autopilot) {
+        gameLogic.startGame();
+    } else {
+        // 先画出初始棋盘，等待空格开始
+        gameLogic.resetGame();
+    }
+
+    return app.exec();
+}
@@ -0,0 +1,191 @@
+/**
+ * @file BoardPainter.cpp
+ * @brief 棋盘绘制器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "BoardPainter.h"
+#include <QPainter>
+#include <QBrush>
+#include <QPen>
+#include <QFont>
+
+namespace SnakeGame {
+
+BoardPainter::BoardPainter(int boardWidth, int boardHeight, int cellSize)
+    : boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , cellSize_(cellSize)
+{
+}
+
+QColor BoardPainter::backgroundColor()
+{
+    return QColor(30, 30, 40);
+}
+
+QRect BoardPainter::boardRect() const
+{
+    return QRect(0, 0, boardWidth_ * cellSize_, boardHeight_ * cellSize_);
+}
+
+void BoardPainter::paint(QPainter& painter, const GameSnapshot& snapshot) const
+{
+    // 绘制层次：背景 → 食物 → 蛇 → 覆盖层
+    drawBackground(painter);
+    drawFoods(painter, snapshot.foods);
+    drawSnake(painter, snapshot.body);
+    drawOverlay(painter, snapshot.state);
+}
+
+void BoardPainter::paintOverlay(QPainter& painter, GameState gameState) const
+{
+    drawOverlay(painter, gameState);
+}
+
+void BoardPainter::drawBackground(QPainter& painter) const
+{
+    // 绘制网格线
+    painter.setPen(QPen(QColor(50, 50, 60), 1));
+
+    // 垂直线
+    for (int x = 0; x <= boardWidth_; ++x) {
+        painter.drawLine(x * cellSize_, 0, x * cellSize_, boardHeight_ * cellSize_);
+    }
+
+    // 水平线
+    for (int y = 0; y <= boardHeight_; ++y) {
+        painter.drawLine(0, y * cellSize_, boardWidth_ * cellSize_, y * cellSize_);
+    }
+}
+
+void BoardPainter::drawSnake(QPainter& painter, const QVector<QPoint>& snakeBody) const
+{
+    if (snakeBody.isEmpty()) {
+        return;
+    }
+
+    // 蛇身颜色渐变
+    QColor headColor(76, 175, 80);      // 鲜艳绿色 - 蛇头
+    QColor bodyColor(56, 142, 60);      // 深绿色 - 蛇身
+    QColor tailColor(46, 125, 50);      // 更深绿色 - 蛇尾
+
+    for (int i = 0; i < snakeBody.size(); ++i) {
+        QRect rect = gridToPixel(snakeBody[i]);
+        
+        // 缩小一点，留出间隙
+        rect.adjust(2, 2, -2, -2);
+
+        QColor color;
+        if (i == 0) {
+            // 蛇头
+            color = headColor;
+        } else if (i == snakeBody.size() - 1) {
+            // 蛇尾
+            color = tailColor;
+        } else {
+            // 蛇身 - 渐变
+            double ratio = static_cast<double>(i) / snakeBody.size();
+            color = QColor(
+                bodyColor.red() + static_cast<int>((tailColor.red() - bodyColor.red()) * ratio),
+                bodyColor.green() + static_cast<int>((tailColor.green() - bodyColor.green()) * ratio),
+                bodyColor.blue() + static_cast<int>((tailColor.blue() - bodyColor.blue()) * ratio)
+            );
+        }
+
+        painter.setBrush(QBrush(color));
+        painter.setPen(Qt::NoPen);
+
+        if (i == 0) {
+            // 蛇头绘制为圆角矩形
+            painter.drawRoundedRect(rect, 8, 8);
+
+            // 绘制眼睛
+            painter.setBrush(QBrush(Qt::white));
+            int eyeSize = cellSize_ / 6;
+            int eyeOffset = cellSize_ / 4;
+            painter.drawEllipse(rect.center() + QPoint(-eyeOffset/2, -eyeOffset/2), eyeSize, eyeSize);
+            painter.drawEllipse(rect.center() + QPoint(eyeOffset/2, -eyeOffset/2), eyeSize, eyeSize);
+
+            // 瞳孔
+            painter.setBrush(QBrush(Qt::black));
+            int pupilSize = eyeSize / 2;
+            painter.drawEllipse(rect.center() + QPoint(-eyeOffset/2, -eyeOffset/2), pupilSize, pupilSize);
+            painter.drawEllipse(rect.center() + QPoint(eyeOffset/2, -eyeOffset/2), pupilSize, pupilSize);
+        } else {
+            // 蛇身绘制为圆角矩形
+            painter.drawRoundedRect(rect, 6, 6);
+        }
+    }
+}
+
+void BoardPainter::drawFoods(QPainter& painter, const QVector<QPoint>& foods) const
+{
+    if (foods.isEmpty()) {
+        return;
+    }
+
+    // 食物绘制为红色圆形，同一层的画刷画笔只切换一次
+    painter.setBrush(QBrush(QColor(244, 67, 54)));  // 红色
+    painter.setPen(QPen(QColor(211, 47, 47), 2));   // 深红边框
+    for (const QPoint& food : foods) {
+        painter.drawEllipse(gridToPixel(food).adjusted(4, 4, -4, -4));
+    }
+
+    // 添加高光效果
+    painter.setBrush(QBrush(QColor(255, 255, 255, 100)));
+    painter.setPen(Qt::NoPen);
+    for (const QPoint& food : foods) {
+        QRect rect = gridToPixel(food).adjusted(4, 4, -4, -4);
+        QRect highlight(rect.left() + rect.width() / 4, 
+                        rect.top() + rect.height() / 4,
+                        rect.width() / 3, 
+                        rect.height() / 3);
+        painter.drawEllipse(highlight);
+    }
+}
+
+void BoardPainter::drawOverlay(QPainter& painter, GameState gameState) const
+{
+    QString text;
+    QColor overlayColor(0, 0, 0, 150);
+
+    switch (gameState) {
+        case GameState::Ready:
+            text = tr("按 空格键 开始游戏");
+            break;
+        case GameState::Paused:
+            text = tr("游戏暂停\n按 P 继续");
+            overlayColor = QColor(0, 0, 0, 180);
+            break;
+        case GameState::GameOver:
+            text = tr("游戏结束\n按 空格键 重新开始");
+            overlayColor = QColor(0, 0, 0, 200);
+            break;
+        case GameState::Running:
+            return;  // 运行中不显示覆盖层
+    }
+
+    // 半透明覆盖层
+    painter.fillRect(boardRect(), overlayColor);
+
+    // 文字
+    painter.setPen(Qt::white);
+    QFont font = painter.font();
+    font.setPointSize(16);
+    font.setBold(true);
+    painter.setFont(font);
+
+    painter.drawText(boardRect(), Qt::AlignCenter, text);
+}
+
+QRect BoardPainter::gridToPixel(const QPoint& gridPos) const
+{
+    return QRect(gridPos.x() * cellSize_,
+                 gridPos.y() * cellSize_,
+                 cellSize_,
+                 cellSize_);
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,108 @@
+/**
+ * @file BoardPainter.h
+ * @brief 棋盘绘制器 - GameWidget 与线程渲染器共用的绘制代码
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef BOARDPAINTER_H
+#define BOARDPAINTER_H
+
+#include <QColor>
+#include <QCoreApplication>
+#include <QPoint>
+#include <QRect>
+#include <QVector>
+#include "GameSnapshot.h"
+
+class QPainter;
+
+namespace SnakeGame {
+
+/**
+ * @brief 棋盘绘制器 - 将一份游戏快照绘制到任意 QPainter 目标
+ *
+ * 不持有任何游戏状态，也不依赖 QWidget，
+ * 因此既可在 paintEvent 中使用，也可在工作线程中绘制到 QImage。
+ */
+class BoardPainter {
+    Q_DECLARE_TR_FUNCTIONS(SnakeGame::BoardPainter)
+
+public:
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param cellSize 单元格像素大小
+     */
+    BoardPainter(int boardWidth, int boardHeight, int cellSize);
+
+    /**
+     * @brief 背景色（绘制目标需预先填充）
+     * @return 背景颜色
+     */
+    static QColor backgroundColor();
+
+    /**
+     * @brief 绘制一帧
+     * @param painter 画笔
+     * @param snapshot 游戏快照
+     */
+    void paint(QPainter& painter, const GameSnapshot& snapshot) const;
+
+    /**
+     * @brief 只绘制游戏状态覆盖层（供自行绘制棋盘的渲染器使用）
+     * @param painter 画笔
+     * @param gameState 游戏状态
+     */
+    void paintOverlay(QPainter& painter, GameState gameState) const;
+
+    /**
+     * @brief 整个棋盘的像素矩形
+     * @return 像素矩形
+     */
+    QRect boardRect() const;
+
+private:
+    int boardWidth_;            ///< 游戏区域宽度（格数）
+    int boardHeight_;           ///< 游戏区域高度（格数）
+    int cellSize_;              ///< 单元格像素大小
+
+    /**
+     * @brief 绘制网格背景
+     * @param painter 画笔
+     */
+    void drawBackground(QPainter& painter) const;
+
+    /**
+     * @brief 绘制蛇
+     * @param painter 画笔
+     * @param snakeBody 蛇身坐标
+     */
+    void drawSnake(QPainter& painter, const QVector<QPoint>& snakeBody) const;
+
+    /**
+     * @brief 绘制食物层（画刷只设置一次，逐个绘制全部食物）
+     * @param painter 画笔
+     * @param foods 食物坐标
+     */
+    void drawFoods(QPainter& painter, const QVector<QPoint>& foods) const;
+
+    /**
+     * @brief 绘制游戏状态覆盖层
+     * @param painter 画笔
+     * @param gameState 游戏状态
+     */
+    void drawOverlay(QPainter& painter, GameState gameState) const;
+
+    /**
+     * @brief 将网格坐标转换为像素坐标
+     * @param gridPos 网格坐标
+     * @return 像素坐标矩形
+     */
+    QRect gridToPixel(const QPoint& gridPos) const;
+};
+
+}  // namespace SnakeGame
+
+#endif  // BOARDPAINTER_H
@@ -0,0 +1,93 @@
+/**
+ * @file FrameRenderer.cpp
+ * @brief 帧渲染器实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "FrameRenderer.h"
+#include "Trace.h"
+#include <QMetaObject>
+#include <QMutexLocker>
+#include <QPainter>
+#include <utility>
+
+namespace SnakeGame {
+
+FrameRenderer::FrameRenderer(int boardWidth, int boardHeight, int cellSize)
+    : boardPainter_(boardWidth, boardHeight, cellSize)
+    , hasPending_(false)
+    , renderScheduled_(false)
+    , readyIsNew_(false)
+    , frontIndex_(0)
+    , readyIndex_(1)
+    , backIndex_(2)
+{
+    const QRect rect = boardPainter_.boardRect();
+    for (QImage& buffer : buffers_) {
+        buffer = QImage(rect.size(), QImage::Format_ARGB32_Premultiplied);
+        buffer.fill(BoardPainter::backgroundColor());
+    }
+}
+
+void FrameRenderer::submit(const GameSnapshot& snapshot)
+{
+    QMutexLocker locker(&mutex_);
+    pending_ = snapshot;
+    hasPending_ = true;
+
+    if (renderScheduled_) {
+        // 工作线程尚未处理上一份，直接合并
+        return;
+    }
+    renderScheduled_ = true;
+    locker.unlock();
+
+    QMetaObject::invokeMethod(this, [this]() { renderPending(); }, Qt::QueuedConnection);
+}
+
+const QImage& FrameRenderer::acquireFrame()
+{
+    QMutexLocker locker(&mutex_);
+    if (readyIsNew_) {
+        std::swap(frontIndex_, readyIndex_);
+        readyIsNew_ = false;
+    }
+    return buffers_[frontIndex_];
+}
+
+void FrameRenderer::renderPending()
+{
+    const TraceSpan span("FrameRenderer::renderPending");
+
+    for (;;) {
+        GameSnapshot snapshot;
+        {
+            QMutexLocker locker(&mutex_);
+            if (!hasPending_) {
+                renderScheduled_ = false;
+                return;
+            }
+            snapshot = std::move(pending_);
+            hasPending_ = false;
+        }
+
+        // back 缓冲只属于工作线程，绘制期间无需持锁
+        QImage& target = buffers_[backIndex_];
+        target.fill(BoardPainter::backgroundColor());
+        {
+            QPainter painter(&target);
+            painter.setRenderHint(QPainter::Antialiasing);
+            boardPainter_.paint(painter, snapshot);
+        }
+
+        {
+            QMutexLocker locker(&mutex_);
+            std::swap(backIndex_, readyIndex_);
+            readyIsNew_ = true;
+        }
+        emit frameReady();
+    }
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,80 @@
+/**
+ * @file FrameRenderer.h
+ * @brief 帧渲染器 - 在工作线程中将游戏快照绘制到 QImage
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef FRAMERENDERER_H
+#define FRAMERENDERER_H
+
+#include <QObject>
+#include <QImage>
+#include <QMutex>
+#include "GameSnapshot.h"
+#include "BoardPainter.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 帧渲染器 - 运行在独立线程中的三缓冲绘制器
+ *
+ * 三块缓冲分别由 GUI 线程显示（front）、等待显示（ready）和
+ * 工作线程绘制（back）。交换只在互斥锁内修改下标，绘制和显示
+ * 都不持锁，因此慢帧不会阻塞 GUI 线程。
+ *
+ * 工作线程忙碌时提交的快照会被合并，只绘制最新的一份。
+ */
+class FrameRenderer : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param cellSize 单元格像素大小
+     */
+    FrameRenderer(int boardWidth, int boardHeight, int cellSize);
+
+    /**
+     * @brief 提交一份待绘制的快照（任意线程调用）
+     * @param snapshot 游戏快照
+     */
+    void submit(const GameSnapshot& snapshot);
+
+    /**
+     * @brief 获取最新完成的帧（GUI 线程调用）
+     * @return 帧图像，在下一次调用前保持有效
+     */
+    const QImage& acquireFrame();
+
+signals:
+    /**
+     * @brief 新的一帧绘制完成后发出（来自工作线程）
+     */
+    void frameReady();
+
+private:
+    BoardPainter boardPainter_;     ///< 绘制器
+
+    QMutex mutex_;                  ///< 保护以下共享状态
+    GameSnapshot pending_;          ///< 尚未绘制的最新快照
+    bool hasPending_;               ///< 是否有待绘制快照
+    bool renderScheduled_;          ///< 工作线程中是否已排队绘制
+    bool readyIsNew_;               ///< ready 缓冲是否为尚未显示的新帧
+
+    QImage buffers_[3];             ///< 三缓冲
+    int frontIndex_;                ///< GUI 线程正在显示的缓冲
+    int readyIndex_;                ///< 最近完成的缓冲
+    int backIndex_;                 ///< 工作线程正在绘制的缓冲（仅工作线程修改）
+
+    /**
+     * @brief 绘制所有待处理快照（工作线程中执行）
+     */
+    void renderPending();
+};
+
+}  // namespace SnakeGame
+
+#endif  // FRAMERENDERER_H
@@ -13,6 +13,8 @@
 #include <QPoint>
 #include "Constants.h"
 #include "GameState.h"
+#include "GameSnapshot.h"
+#include "BoardPainter.h"
 
 namespace SnakeGame {
 
@@ -49,9 +51,9 @@ public slots:
 
     /**
      * @brief 更新食物位置
-     * @param position 食物坐标
+     * @param positions 全部食物坐标
      */
-    void onFoodSpawned(const QPoint& position);
+    void onFoodsChanged(const QVector<QPoint>& positions);
 
     /**
      * @brief 更新游戏状态
@@ -71,40 +73,8 @@ private:
     int boardHeight_;           ///< 游戏区域高度（格数）
     int cellSize_;              ///< 单元格像素大小
 
-    QVector<QPoint> snakeBody_; ///< 蛇身坐标
-    QPoint foodPosition_;       ///< 食物坐标
-    GameState gameState_;       ///< 当前游戏状态
-
-    /**
-     * @brief 绘制网格背景
-     * @param painter 画笔
-     */
-    void drawBackground(QPainter& painter);
-
-    /**
-     * @brief 绘制蛇
-     * @param painter 画笔
-     */
-    void drawSnake(QPainter& painter);
-
-    /**
-     * @brief 绘制食物
-     * @param painter 画笔
-     */
-    void drawFood(QPainter& painter);
-
-    /**
-     * @brief 绘制游戏状态覆盖层
-     * @param painter 画笔
-     */
-    void drawOverlay(QPainter& painter);
-
-    /**
-     * @brief 将网格坐标转换为像素坐标
-     * @param gridPos 网格坐标
-     * @return 像素坐标矩形
-     */
-    QRect gridToPixel(const QPoint& gridPos) const;
+    GameSnapshot snapshot_;         ///< 当前渲染数据
+    BoardPainter boardPainter_;     ///< 绘制器
 };
 
 }  // namespace SnakeGame
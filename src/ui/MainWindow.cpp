@@ -6,6 +6,7 @@
  */
 
 #include "MainWindow.h"
+#include "Trace.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QKeyEvent>
@@ -14,28 +15,71 @@
 
 namespace SnakeGame {
 
-MainWindow::MainWindow(RendererType rendererType, QWidget* parent)
+namespace {
+
+/**
+ * @brief 将快照中变化的部分分发给渲染组件
+ */
+template <typename View>
+void applySnapshot(View* view, const GameSnapshot& snapshot, const GameSnapshot& previous)
+{
+    if (snapshot.state != previous.state) {
+        view->onGameStateChanged(snapshot.state);
+    }
+    if (snapshot.foods != previous.foods) {
+        view->onFoodsChanged(snapshot.foods);
+    }
+    view->onSnakeMoved(snapshot.body);
+}
+
+}  // namespace
+
+MainWindow::MainWindow(RendererType rendererType, bool threadedSimulation, QWidget* parent)
     : QMainWindow(parent)
-    , gameLogic_(std::make_unique<GameLogic>())
+    , gameLogic_(threadedSimulation ? nullptr : std::make_unique<GameLogic>())
+    , simulation_(threadedSimulation ? new SimulationThread(Constants::kDefaultBoardWidth,
+                                                            Constants::kDefaultBoardHeight,
+                                                            this)
+                                     : nullptr)
     , rendererType_(rendererType)
     , gameWidget_(nullptr)
     , sceneView_(nullptr)
+    , threadedWidget_(nullptr)
+    , rasterView_(nullptr)
     , scoreLabel_(nullptr)
     , statusLabel_(nullptr)
 {
     setupUI();
     connectSignals();
 
+    // 保留最近一段时间的逐帧增量，供回退键使用
+    const int rewindTicks = Constants::kRewindSeconds * 1000 / Constants::kGameTickInterval;
+
     // 初始化显示
-    gameLogic_->resetGame();
+    if (simulation_) {
+        simulation_->postRewindCapacity(rewindTicks);
+        simulation_->postReset();
+    } else {
+        gameLogic_->setRewindCapacity(rewindTicks);
+        gameLogic_->resetGame();
+    }
 }
 
 MainWindow::~MainWindow()
 {
-    // gameLogic_ 通过 unique_ptr 自动销毁
+    // gameLogic_ 通过 unique_ptr 自动销毁，simulation_ 通过父子对象机制停止线程
     // gameWidget_, scoreLabel_, statusLabel_ 通过 Qt 父子对象机制销毁
 }
 
+void MainWindow::setController(std::unique_ptr<Controller> controller)
+{
+    if (simulation_) {
+        simulation_->postController(std::move(controller));
+    } else {
+        gameLogic_->setController(std::move(controller));
+    }
+}
+
 void MainWindow::setupUI()
 {
     // 设置窗口标题和属性
@@ -89,21 +133,41 @@ void MainWindow::setupUI()
     // ==================== 游戏区域 ====================
     // 根据渲染器类型创建不同的前端组件
     QWidget* gameComponent = nullptr;
+    const int boardWidth = simulation_ ? simulation_->getBoardWidth() : gameLogic_->getBoardWidth();
+    const int boardHeight = simulation_ ? simulation_->getBoardHeight() : gameLogic_->getBoardHeight();
     
     if (rendererType_ == RendererType::Scene) {
         // 使用 QGraphicsScene 渲染器
         sceneView_ = new SceneGameView(
-            gameLogic_->getBoardWidth(),
-            gameLogic_->getBoardHeight(),
+            boardWidth,
+            boardHeight,
             Constants::kCellSize,
             this
         );
         gameComponent = sceneView_;
+    } else if (rendererType_ == RendererType::Threaded) {
+        // 使用工作线程渲染器
+        threadedWidget_ = new ThreadedGameWidget(
+            boardWidth,
+            boardHeight,
+            Constants::kCellSize,
+            this
+        );
+        gameComponent = threadedWidget_;
+    } else if (rendererType_ == RendererType::Raster) {
+        // 使用直接光栅渲染器
+        rasterView_ = new RasterGameView(
+            boardWidth,
+            boardHeight,
+            Constants::kCellSize,
+            this
+        );
+        gameComponent = rasterView_;
     } else {
         // 使用 QPainter 渲染器（默认）
         gameWidget_ = new GameWidget(
-            gameLogic_->getBoardWidth(),
-            gameLogic_->getBoardHeight(),
+            boardWidth,
+            boardHeight,
             Constants::kCellSize,
             this
         );
@@ -120,7 +184,7 @@ void MainWindow::setupUI()
 
     // ==================== 底部操作提示 ====================
     QLabel* helpLabel = new QLabel(
-        tr("操作说明: ↑↓←→ 或 WASD 控制方向 | 空格 开始/重新开始 | P 暂停"),
+        tr("操作说明: ↑↓←→ 或 WASD 控制方向 | 空格 开始/重新开始 | P 暂停 | Backspace 回退"),
         this
     );
     helpLabel->setStyleSheet(
@@ -141,22 +205,50 @@ void MainWindow::setupUI()
 
 void MainWindow::connectSignals()
 {
+    if (simulation_) {
+        // 独立线程模式：通过发件箱读取快照后统一分发
+        connect(simulation_, &SimulationThread::snapshotPublished,
+                this, &MainWindow::onSnapshotPublished);
+        return;
+    }
+
     // 后端 → 前端渲染
     if (rendererType_ == RendererType::Scene && sceneView_) {
         connect(gameLogic_.get(), &GameLogic::snakeMoved,
                 sceneView_, &SceneGameView::onSnakeMoved);
 
-        connect(gameLogic_.get(), &GameLogic::foodSpawned,
-                sceneView_, &SceneGameView::onFoodSpawned);
+        connect(gameLogic_.get(), &GameLogic::foodsChanged,
+                sceneView_, &SceneGameView::onFoodsChanged);
 
         connect(gameLogic_.get(), &GameLogic::gameStateChanged,
                 sceneView_, &SceneGameView::onGameStateChanged);
+    } else if (rendererType_ == RendererType::Threaded && threadedWidget_) {
+        connect(gameLogic_.get(), &GameLogic::snakeMoved,
+                threadedWidget_, &ThreadedGameWidget::onSnakeMoved);
+
+        connect(gameLogic_.get(), &GameLogic::foodsChanged,
+                threadedWidget_, &ThreadedGameWidget::onFoodsChanged);
+
+        connect(gameLogic_.get(), &GameLogic::gameStateChanged,
+                threadedWidget_, &ThreadedGameWidget::onGameStateChanged);
+    } else if (rendererType_ == RendererType::Raster && rasterView_) {
+        connect(gameLogic_.get(), &GameLogic::snakeMoved,
+                rasterView_, &RasterGameView::onSnakeMoved);
+
+        connect(gameLogic_.get(), &GameLogic::foodsChanged,
+                rasterView_, &RasterGameView::onFoodsChanged);
+
+        connect(gameLogic_.get(), &GameLogic::gameStateChanged,
+                rasterView_, &RasterGameView::onGameStateChanged);
+
+        connect(gameLogic_.get(), &GameLogic::rewound,
+                rasterView_, &RasterGameView::onRewound);
     } else if (gameWidget_) {
         connect(gameLogic_.get(), &GameLogic::snakeMoved,
                 gameWidget_, &GameWidget::onSnakeMoved);
 
-        connect(gameLogic_.get(), &GameLogic::foodSpawned,
-                gameWidget_, &GameWidget::onFoodSpawned);
+        connect(gameLogic_.get(), &GameLogic::foodsChanged,
+                gameWidget_, &GameWidget::onFoodsChanged);
 
         connect(gameLogic_.get(), &GameLogic::gameStateChanged,
                 gameWidget_, &GameWidget::onGameStateChanged);
@@ -179,40 +271,64 @@ void MainWindow::keyPressEvent(QKeyEvent* event)
         // 方向键
         case Qt::Key_Up:
         case Qt::Key_W:
-            gameLogic_->setDirection(Direction::Up);
+            sendDirection(Direction::Up);
             break;
 
         case Qt::Key_Down:
         case Qt::Key_S:
-            gameLogic_->setDirection(Direction::Down);
+            sendDirection(Direction::Down);
             break;
 
         case Qt::Key_Left:
         case Qt::Key_A:
-            gameLogic_->setDirection(Direction::Left);
+            sendDirection(Direction::Left);
             break;
 
         case Qt::Key_Right:
         case Qt::Key_D:
-            gameLogic_->setDirection(Direction::Right);
+            sendDirection(Direction::Right);
             break;
 
         // 开始/重新开始
         case Qt::Key_Space:
         case Qt::Key_Return:
-            if (gameLogic_->getState() == GameState::Ready ||
-                gameLogic_->getState() == GameState::GameOver) {
-                gameLogic_->startGame();
+            if (currentState() == GameState::Ready ||
+                currentState() == GameState::GameOver) {
+                if (simulation_) {
+                    simulation_->postStart();
+                } else {
+                    gameLogic_->startGame();
+                }
             }
             break;
 
         // 暂停/继续
         case Qt::Key_P:
         case Qt::Key_Escape:
-            if (gameLogic_->getState() == GameState::Running) {
-                gameLogic_->pauseGame();
-            } else if (gameLogic_->getState() == GameState::Paused) {
-                gameLogic_->resumeGame();
+            if (currentState() == GameState::Running) {
+                if (simulation_) {
+                    simulation_->postPause();
+                } else {
+                    gameLogic_->pauseGame();
+                }
+            } else if (currentState() == GameState::Paused) {
+                if (simulation_) {
+                    simulation_->postResume();
+                } else {
+                    gameLogic_->resumeGame();
+                }
+            }
+            break;
+
+        // 回退：撤销最近的若干帧后暂停，可在游戏结束后使用
+        case Qt::Key_Backspace:
+            if (currentState() != GameState::Ready) {
+                const int ticks = Constants::kRewindStepSeconds * 1000 / Constants::kGameTickInterval;
+                if (simulation_) {
+                    simulation_->postRewind(ticks);
+                } else {
+                    gameLogic_->rewind(ticks);
+                }
             }
             break;
 
@@ -221,6 +337,20 @@ void MainWindow::keyPressEvent(QKeyEvent* event)
     }
 }
 
+GameState MainWindow::currentState() const
+{
+    return simulation_ ? simulation_->latestState() : gameLogic_->getState();
+}
+
+void MainWindow::sendDirection(Direction direction)
+{
+    if (simulation_) {
+        simulation_->postDirection(direction);
+    } else {
+        gameLogic_->setDirection(direction);
+    }
+}
+
 void MainWindow::onScoreChanged(int score)
 {
     scoreLabel_->setText(tr("分数: %1").arg(score));
@@ -273,4 +403,39 @@ void MainWindow::onGameOver(int finalScore)
     // 可以在这里添加游戏结束的额外处理，如显示对话框
 }
 
+void MainWindow::onSnapshotPublished()
+{
+    const TraceSpan span("MainWindow::onSnapshotPublished");
+
+    GameSnapshot snapshot;
+    if (!simulation_->takeSnapshot(&snapshot)) {
+        return;
+    }
+
+    if (sceneView_) {
+        applySnapshot(sceneView_, snapshot, lastSnapshot_);
+    } else if (threadedWidget_) {
+        applySnapshot(threadedWidget_, snapshot, lastSnapshot_);
+    } else if (rasterView_) {
+        if (snapshot.rewinds != lastSnapshot_.rewinds) {
+            rasterView_->onRewound();
+        }
+        applySnapshot(rasterView_, snapshot, lastSnapshot_);
+    } else if (gameWidget_) {
+        applySnapshot(gameWidget_, snapshot, lastSnapshot_);
+    }
+
+    if (snapshot.score != lastSnapshot_.score) {
+        onScoreChanged(snapshot.score);
+    }
+    if (snapshot.state != lastSnapshot_.state) {
+        onGameStateChanged(snapshot.state);
+        if (snapshot.state == GameState::GameOver) {
+            onGameOver(snapshot.score);
+        }
+    }
+
+    lastSnapshot_ = snapshot;
+}
+
 }  // namespace SnakeGame
@@ -13,8 +13,12 @@
 #include <memory>
 
 #include "GameLogic.h"
+#include "GameSnapshot.h"
+#include "SimulationThread.h"
 #include "GameWidget.h"
 #include "SceneGameView.h"
+#include "ThreadedGameWidget.h"
+#include "RasterGameView.h"
 #include "RendererType.h"
 
 namespace SnakeGame {
@@ -26,6 +30,9 @@ namespace SnakeGame {
  * - 组合游戏渲染组件和分数显示
  * - 处理键盘输入并转发给后端
  * - 连接前后端信号槽
+ *
+ * 后端可以运行在 GUI 线程（默认），也可以运行在独立的模拟线程中；
+ * 后者通过命令收件箱发送输入，通过状态发件箱读取快照。
  */
 class MainWindow : public QMainWindow {
     Q_OBJECT
@@ -34,9 +41,11 @@ public:
     /**
      * @brief 构造函数
      * @param rendererType 渲染器类型
+     * @param threadedSimulation 是否在独立线程中运行游戏逻辑
      * @param parent 父组件
      */
     explicit MainWindow(RendererType rendererType = RendererType::Widget,
+                        bool threadedSimulation = false,
                         QWidget* parent = nullptr);
 
     /**
@@ -44,6 +53,12 @@ public:
      */
     ~MainWindow() override;
 
+    /**
+     * @brief 设置自动驾驶控制器
+     * @param controller 控制器，传入空指针恢复玩家操作
+     */
+    void setController(std::unique_ptr<Controller> controller);
+
 protected:
     /**
      * @brief 键盘按下事件
@@ -70,11 +85,20 @@ private slots:
      */
     void onGameOver(int finalScore);
 
+    /**
+     * @brief 模拟线程发布新快照后读取并分发
+     */
+    void onSnapshotPublished();
+
 private:
-    std::unique_ptr<GameLogic> gameLogic_;  ///< 游戏逻辑（后端）
+    std::unique_ptr<GameLogic> gameLogic_;  ///< 游戏逻辑（后端，GUI 线程模式）
+    SimulationThread* simulation_;           ///< 模拟线程（独立线程模式）
+    GameSnapshot lastSnapshot_;              ///< 上一次分发的快照（独立线程模式）
     RendererType rendererType_;              ///< 渲染器类型
     GameWidget* gameWidget_;                 ///< QPainter 渲染组件
     SceneGameView* sceneView_;               ///< QGraphicsScene 渲染组件
+    ThreadedGameWidget* threadedWidget_;     ///< 线程渲染组件
+    RasterGameView* rasterView_;             ///< 直接光栅渲染组件
     QLabel* scoreLabel_;                     ///< 分数显示
     QLabel* statusLabel_;                    ///< 状态显示
 
@@ -87,6 +111,18 @@ private:
      * @brief 连接前后端信号槽
      */
     void connectSignals();
+
+    /**
+     * @brief 获取当前游戏状态
+     * @return 游戏状态
+     */
+    GameState currentState() const;
+
+    /**
+     * @brief 发送方向输入
+     * @param direction 新方向
+     */
+    void sendDirection(Direction direction);
 };
 
 }  // namespace SnakeGame
@@ -0,0 +1,184 @@
+/**
+ * @file RasterGameView.cpp
+ * @brief 直接光栅渲染组件实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "RasterGameView.h"
+#include "BoardPainter.h"
+#include "Trace.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <algorithm>
+
+namespace SnakeGame {
+
+namespace {
+
+// 与 GameWidget 保持一致的配色
+constexpr quint32 kBackgroundColor = 0xFF1E1E28;
+constexpr quint32 kGridColor = 0xFF32323C;
+constexpr quint32 kHeadColor = 0xFF4CAF50;
+constexpr quint32 kBodyColor = 0xFF388E3C;
+constexpr quint32 kFoodColor = 0xFFF44336;
+
+/** @brief 蛇身与格子边缘的间距（像素） */
+constexpr int kSnakeInset = 2;
+
+/** @brief 食物与格子边缘的间距（像素） */
+constexpr int kFoodInset = 5;
+
+}  // namespace
+
+RasterGameView::RasterGameView(int boardWidth, int boardHeight, int cellSize, QWidget* parent)
+    : QWidget(parent)
+    , boardWidth_(boardWidth)
+    , boardHeight_(boardHeight)
+    , cellSize_(cellSize)
+    , framebuffer_(boardWidth * cellSize, boardHeight * cellSize, QImage::Format_RGB32)
+    , diff_(boardWidth, boardHeight)
+    , gameState_(GameState::Ready)
+{
+    setFixedSize(boardWidth_ * cellSize_, boardHeight_ * cellSize_);
+
+    // 帧缓冲覆盖整个组件，无需系统擦除背景
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    redrawAll();
+}
+
+void RasterGameView::onSnakeMoved(const QVector<QPoint>& body)
+{
+    const TraceSpan span("RasterGameView::onSnakeMoved");
+
+    if (diff_.setSnake(body)) {
+        redrawAll();
+    } else {
+        paintChanges();
+    }
+    flushDirty();
+}
+
+void RasterGameView::onFoodsChanged(const QVector<QPoint>& positions)
+{
+    const TraceSpan span("RasterGameView::onFoodsChanged");
+
+    diff_.setFoods(positions);
+    paintChanges();
+    flushDirty();
+}
+
+void RasterGameView::onGameStateChanged(GameState state)
+{
+    gameState_ = state;
+    diff_.invalidate();  // 回退或重开后的蛇身可能与上一帧无关，下一帧整帧重绘
+    update();  // 覆盖层变化需要整帧重绘
+}
+
+void RasterGameView::onRewound()
+{
+    diff_.invalidate();
+}
+
+void RasterGameView::paintEvent(QPaintEvent* event)
+{
+    const TraceSpan span("RasterGameView::paintEvent");
+
+    QPainter painter(this);
+
+    const QRect area = event->rect();
+    painter.drawImage(area, framebuffer_, area);
+
+    if (gameState_ != GameState::Running) {
+        // 覆盖层沿用 QPainter 绘制，只在非运行状态出现
+        BoardPainter overlay(boardWidth_, boardHeight_, cellSize_);
+        painter.setRenderHint(QPainter::Antialiasing);
+        overlay.paintOverlay(painter, gameState_);
+    }
+}
+
+void RasterGameView::redrawAll()
+{
+    // 背景与网格线：每个格子左上边为网格线，其余为背景
+    for (int y = 0; y < framebuffer_.height(); ++y) {
+        quint32* line = reinterpret_cast<quint32*>(framebuffer_.scanLine(y));
+        if (y % cellSize_ == 0) {
+            std::fill_n(line, framebuffer_.width(), kGridColor);
+            continue;
+        }
+        std::fill_n(line, framebuffer_.width(), kBackgroundColor);
+        for (int x = 0; x < framebuffer_.width(); x += cellSize_) {
+            line[x] = kGridColor;
+        }
+    }
+
+    for (int y = 0; y < boardHeight_; ++y) {
+        for (int x = 0; x < boardWidth_; ++x) {
+            const BoardDiff::Cell cell = diff_.cellAt(x, y);
+            if (cell != BoardDiff::Cell::Empty) {
+                paintCell(QPoint(x, y), cell);
+            }
+        }
+    }
+
+    dirty_ = framebuffer_.rect();
+}
+
+void RasterGameView::paintChanges()
+{
+    for (const BoardDiff::Change& change : diff_.changes()) {
+        paintCell(change.pos, change.cell);
+    }
+}
+
+void RasterGameView::paintCell(const QPoint& pos, BoardDiff::Cell cell)
+{
+    const int x0 = pos.x() * cellSize_;
+    const int y0 = pos.y() * cellSize_;
+
+    // 先清空格子内部（保留左上网格线），再按内容填充内缩方块
+    fillSpan(x0 + 1, y0 + 1, cellSize_ - 1, cellSize_ - 1, kBackgroundColor);
+
+    switch (cell) {
+        case BoardDiff::Cell::Head:
+            fillSpan(x0 + kSnakeInset, y0 + kSnakeInset,
+                     cellSize_ - 2 * kSnakeInset, cellSize_ - 2 * kSnakeInset, kHeadColor);
+            break;
+        case BoardDiff::Cell::Body:
+            fillSpan(x0 + kSnakeInset, y0 + kSnakeInset,
+                     cellSize_ - 2 * kSnakeInset, cellSize_ - 2 * kSnakeInset, kBodyColor);
+            break;
+        case BoardDiff::Cell::Food:
+            fillSpan(x0 + kFoodInset, y0 + kFoodInset,
+                     cellSize_ - 2 * kFoodInset, cellSize_ - 2 * kFoodInset, kFoodColor);
+            break;
+        case BoardDiff::Cell::Empty:
+            break;
+    }
+
+    dirty_ |= QRect(x0, y0, cellSize_, cellSize_);
+}
+
+void RasterGameView::fillSpan(int x, int y, int width, int height, quint32 color)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    const int stride = framebuffer_.bytesPerLine() / static_cast<int>(sizeof(quint32));
+    quint32* row = reinterpret_cast<quint32*>(framebuffer_.bits()) + y * stride + x;
+    for (int i = 0; i < height; ++i, row += stride) {
+        std::fill_n(row, width, color);
+    }
+}
+
+void RasterGameView::flushDirty()
+{
+    if (!dirty_.isEmpty()) {
+        update(dirty_);
+        dirty_ = QRect();
+    }
+}
+
+}  // namespace SnakeGame
@@ -0,0 +1,124 @@
+/**
+ * @file RasterGameView.h
+ * @brief 直接光栅渲染组件 - 直接写入 QImage 帧缓冲
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef RASTERGAMEVIEW_H
+#define RASTERGAMEVIEW_H
+
+#include <QWidget>
+#include <QImage>
+#include <QRect>
+#include <QVector>
+#include <QPoint>
+#include "BoardDiff.h"
+#include "Constants.h"
+#include "GameState.h"
+
+namespace SnakeGame {
+
+/**
+ * @brief 直接光栅渲染组件
+ *
+ * 与 GameWidget 实现相同的槽函数接口，可互换使用。
+ *
+ * 画面保存在 Format_RGB32 帧缓冲中，格子颜色按行整段填充
+ * （连续 32 位写入，编译器可自动向量化），不经过 QPainter 路径。
+ * 每帧只重绘 BoardDiff 给出的变化格子，并只提交这些格子的脏矩形，
+ * 因此每帧开销与蛇长和棋盘大小无关；游戏状态变化后整帧重绘一次。
+ */
+class RasterGameView : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param cellSize 单元格像素大小
+     * @param parent 父组件
+     */
+    explicit RasterGameView(int boardWidth = Constants::kDefaultBoardWidth,
+                            int boardHeight = Constants::kDefaultBoardHeight,
+                            int cellSize = Constants::kCellSize,
+                            QWidget* parent = nullptr);
+
+public slots:
+    /**
+     * @brief 更新蛇身数据
+     * @param body 蛇身坐标列表
+     */
+    void onSnakeMoved(const QVector<QPoint>& body);
+
+    /**
+     * @brief 更新食物位置
+     * @param positions 全部食物坐标
+     */
+    void onFoodsChanged(const QVector<QPoint>& positions);
+
+    /**
+     * @brief 更新游戏状态
+     * @param state 游戏状态
+     */
+    void onGameStateChanged(GameState state);
+
+    /**
+     * @brief 蛇身发生跳转（回退、录像跳转）后调用，下一帧整帧重绘
+     */
+    void onRewound();
+
+protected:
+    /**
+     * @brief 绘制事件 - 只贴出脏区域
+     * @param event 绘制事件
+     */
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    int boardWidth_;            ///< 游戏区域宽度（格数）
+    int boardHeight_;           ///< 游戏区域高度（格数）
+    int cellSize_;              ///< 单元格像素大小
+
+    QImage framebuffer_;        ///< RGB32 帧缓冲
+    BoardDiff diff_;            ///< 每个格子当前绘制的内容与本次变化
+    QRect dirty_;               ///< 尚未提交的脏区域
+    GameState gameState_;       ///< 当前游戏状态
+
+    /**
+     * @brief 整帧重绘：网格以及 diff_ 中的蛇和食物
+     */
+    void redrawAll();
+
+    /**
+     * @brief 重绘 diff_ 给出的变化格子
+     */
+    void paintChanges();
+
+    /**
+     * @brief 重绘单个格子并记录脏区域
+     * @param pos 格子坐标
+     * @param cell 格子内容
+     */
+    void paintCell(const QPoint& pos, BoardDiff::Cell cell);
+
+    /**
+     * @brief 填充帧缓冲中的矩形区域（逐行整段写入）
+     * @param x 左上角像素 x
+     * @param y 左上角像素 y
+     * @param width 宽度（像素）
+     * @param height 高度（像素）
+     * @param color RGB32 颜色
+     */
+    void fillSpan(int x, int y, int width, int height, quint32 color);
+
+    /**
+     * @brief 提交脏区域重绘
+     */
+    void flushDirty();
+};
+
+}  // namespace SnakeGame
+
+#endif  // RASTERGAMEVIEW_H
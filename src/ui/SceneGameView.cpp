@@ -6,6 +6,7 @@
  */
 
 #include "SceneGameView.h"
+#include "Trace.h"
 #include <QBrush>
 #include <QPen>
 #include <QFont>
@@ -19,7 +20,6 @@ SceneGameView::SceneGameView(int boardWidth, int boardHeight, int cellSize, QWid
     , cellSize_(cellSize)
     , scene_(nullptr)
     , gameState_(GameState::Ready)
-    , foodItem_(nullptr)
     , overlayItem_(nullptr)
     , overlayText_(nullptr)
 {
@@ -48,13 +48,6 @@ void SceneGameView::setupScene()
     // 绘制背景
     drawBackground();
 
-    // 创建食物项（初始隐藏）
-    foodItem_ = new QGraphicsEllipseItem();
-    foodItem_->setBrush(QBrush(QColor("#FF5722")));
-    foodItem_->setPen(Qt::NoPen);
-    foodItem_->setVisible(false);
-    scene_->addItem(foodItem_);
-
     // 创建覆盖层
     overlayItem_ = new QGraphicsRectItem(0, 0, boardWidth_ * cellSize_, boardHeight_ * cellSize_);
     overlayItem_->setBrush(QBrush(QColor(0, 0, 0, 180)));
@@ -97,20 +90,35 @@ void SceneGameView::drawBackground()
 
 void SceneGameView::onSnakeMoved(const QVector<QPoint>& body)
 {
+    const TraceSpan span("SceneGameView::onSnakeMoved");
+
     updateSnakeItems(body);
 }
 
-void SceneGameView::onFoodSpawned(const QPoint& position)
+void SceneGameView::onFoodsChanged(const QVector<QPoint>& positions)
 {
-    if (!foodItem_) {
-        return;
+    const TraceSpan span("SceneGameView::onFoodsChanged");
+
+    // 食物项只增不删，数量减少时隐藏多余项，避免反复创建图形项
+    while (foodItems_.size() < positions.size()) {
+        QGraphicsEllipseItem* item = new QGraphicsEllipseItem();
+        item->setBrush(QBrush(QColor("#FF5722")));
+        item->setPen(Qt::NoPen);
+        scene_->addItem(item);
+        foodItems_.append(item);
     }
 
-    QRectF rect = gridToScene(position);
     // 食物使用圆形，稍微缩小以区分
     qreal margin = cellSize_ * 0.15;
-    foodItem_->setRect(rect.adjusted(margin, margin, -margin, -margin));
-    foodItem_->setVisible(true);
+    for (int i = 0; i < foodItems_.size(); ++i) {
+        if (i < positions.size()) {
+            QRectF rect = gridToScene(positions[i]);
+            foodItems_[i]->setRect(rect.adjusted(margin, margin, -margin, -margin));
+            foodItems_[i]->setVisible(true);
+        } else {
+            foodItems_[i]->setVisible(false);
+        }
+    }
 }
 
 void SceneGameView::onGameStateChanged(GameState state)
@@ -119,6 +127,13 @@ void SceneGameView::onGameStateChanged(GameState state)
     updateOverlay();
 }
 
+void SceneGameView::paintEvent(QPaintEvent* event)
+{
+    const TraceSpan span("SceneGameView::paintEvent");
+
+    QGraphicsView::paintEvent(event);
+}
+
 void SceneGameView::updateSnakeItems(const QVector<QPoint>& body)
 {
     // 移除多余的蛇身项
@@ -61,9 +61,9 @@ public slots:
 
     /**
      * @brief 更新食物位置
-     * @param position 食物坐标
+     * @param positions 全部食物坐标
      */
-    void onFoodSpawned(const QPoint& position);
+    void onFoodsChanged(const QVector<QPoint>& positions);
 
     /**
      * @brief 更新游戏状态
@@ -71,6 +71,13 @@ public slots:
      */
     void onGameStateChanged(GameState state);
 
+protected:
+    /**
+     * @brief 视口绘制事件 - 交给 QGraphicsView 绘制场景，只加上追踪区间
+     * @param event 绘制事件
+     */
+    void paintEvent(QPaintEvent* event) override;
+
 private:
     int boardWidth_;              ///< 游戏区域宽度（格数）
     int boardHeight_;             ///< 游戏区域高度（格数）
@@ -81,7 +88,7 @@ private:
 
     // 图形项
     QVector<QGraphicsRectItem*> snakeItems_;  ///< 蛇身矩形项
-    QGraphicsEllipseItem* foodItem_;          ///< 食物椭圆项
+    QVector<QGraphicsEllipseItem*> foodItems_;    ///< 食物椭圆项池（多余的隐藏复用）
     QGraphicsRectItem* overlayItem_;          ///< 状态覆盖层背景
     QGraphicsTextItem* overlayText_;          ///< 状态覆盖层文字
 
@@ -0,0 +1,75 @@
+/**
+ * @file ThreadedGameWidget.cpp
+ * @brief 线程渲染组件实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "ThreadedGameWidget.h"
+#include "FrameRenderer.h"
+#include "Trace.h"
+#include <QPainter>
+
+namespace SnakeGame {
+
+ThreadedGameWidget::ThreadedGameWidget(int boardWidth, int boardHeight, int cellSize, QWidget* parent)
+    : QWidget(parent)
+    , renderThread_(new QThread(this))
+    , renderer_(new FrameRenderer(boardWidth, boardHeight, cellSize))
+{
+    setFixedSize(boardWidth * cellSize, boardHeight * cellSize);
+
+    // 整帧贴图会覆盖全部区域，无需系统预先擦除背景
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    // 渲染器没有父对象，随线程结束销毁
+    renderer_->moveToThread(renderThread_);
+    connect(renderThread_, &QThread::finished, renderer_, &QObject::deleteLater);
+
+    // 跨线程连接，自动以队列方式回到 GUI 线程
+    connect(renderer_, &FrameRenderer::frameReady, this, [this]() { update(); });
+
+    renderThread_->setObjectName(QStringLiteral("SnakeRenderThread"));
+    renderThread_->start();
+
+    renderer_->submit(snapshot_);
+}
+
+ThreadedGameWidget::~ThreadedGameWidget()
+{
+    renderThread_->quit();
+    renderThread_->wait();
+}
+
+void ThreadedGameWidget::onSnakeMoved(const QVector<QPoint>& body)
+{
+    const TraceSpan span("ThreadedGameWidget::onSnakeMoved");
+
+    snapshot_.body = body;
+    renderer_->submit(snapshot_);
+}
+
+void ThreadedGameWidget::onFoodsChanged(const QVector<QPoint>& positions)
+{
+    const TraceSpan span("ThreadedGameWidget::onFoodsChanged");
+
+    snapshot_.foods = positions;
+    renderer_->submit(snapshot_);
+}
+
+void ThreadedGameWidget::onGameStateChanged(GameState state)
+{
+    snapshot_.state = state;
+    renderer_->submit(snapshot_);
+}
+
+void ThreadedGameWidget::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event);
+    const TraceSpan span("ThreadedGameWidget::paintEvent");
+
+    QPainter painter(this);
+    painter.drawImage(0, 0, renderer_->acquireFrame());
+}
+
+}  // namespace SnakeGame
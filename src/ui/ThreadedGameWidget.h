@@ -0,0 +1,85 @@
+/**
+ * @file ThreadedGameWidget.h
+ * @brief 线程渲染组件 - 画面在工作线程中绘制，GUI 线程只负责贴图
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef THREADEDGAMEWIDGET_H
+#define THREADEDGAMEWIDGET_H
+
+#include <QWidget>
+#include <QThread>
+#include <QVector>
+#include <QPoint>
+#include "Constants.h"
+#include "GameState.h"
+#include "GameSnapshot.h"
+
+namespace SnakeGame {
+
+class FrameRenderer;
+
+/**
+ * @brief 线程渲染组件
+ *
+ * 与 GameWidget 实现相同的槽函数接口，可互换使用。
+ * 每次状态变化时把不可变快照交给 FrameRenderer，
+ * paintEvent 中只把最新完成的帧贴到窗口上。
+ */
+class ThreadedGameWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     * @param boardWidth 游戏区域宽度（格数）
+     * @param boardHeight 游戏区域高度（格数）
+     * @param cellSize 单元格像素大小
+     * @param parent 父组件
+     */
+    explicit ThreadedGameWidget(int boardWidth = Constants::kDefaultBoardWidth,
+                                int boardHeight = Constants::kDefaultBoardHeight,
+                                int cellSize = Constants::kCellSize,
+                                QWidget* parent = nullptr);
+
+    /**
+     * @brief 析构函数 - 停止渲染线程
+     */
+    ~ThreadedGameWidget() override;
+
+public slots:
+    /**
+     * @brief 更新蛇身数据
+     * @param body 蛇身坐标列表
+     */
+    void onSnakeMoved(const QVector<QPoint>& body);
+
+    /**
+     * @brief 更新食物位置
+     * @param positions 全部食物坐标
+     */
+    void onFoodsChanged(const QVector<QPoint>& positions);
+
+    /**
+     * @brief 更新游戏状态
+     * @param state 游戏状态
+     */
+    void onGameStateChanged(GameState state);
+
+protected:
+    /**
+     * @brief 绘制事件 - 贴上最新完成的帧
+     * @param event 绘制事件
+     */
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    QThread* renderThread_;         ///< 渲染线程
+    FrameRenderer* renderer_;       ///< 帧渲染器（运行在渲染线程中）
+    GameSnapshot snapshot_;         ///< 最新游戏快照
+};
+
+}  // namespace SnakeGame
+
+#endif  // THREADEDGAMEWIDGET_H
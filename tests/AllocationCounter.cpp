@@ -0,0 +1,150 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief 堆分配计数钩子实现
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+#if defined(__GLIBC__)
+// glibc 导出的原始分配函数，接管 malloc 后由它们完成实际分配
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+extern "C" void __libc_free(void* ptr);
+#endif
+
+namespace {
+
+/** @brief 当前线程的分配次数（平凡类型，无需动态初始化，可在分配函数内安全访问） */
+thread_local quint64 tAllocations = 0;
+
+void* rawMalloc(size_t size)
+{
+#if defined(__GLIBC__)
+    return __libc_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+}
+
+void rawFree(void* ptr)
+{
+#if defined(__GLIBC__)
+    __libc_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+namespace SnakeGame {
+
+quint64 AllocationCounter::count()
+{
+    return tAllocations;
+}
+
+bool AllocationCounter::coversMalloc()
+{
+#if defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace SnakeGame
+
+// ==================== operator new/delete ====================
+// 数组与 nothrow 版本的默认实现都会转调下面这几个函数
+
+void* operator new(std::size_t size)
+{
+    ++tAllocations;
+    void* ptr = rawMalloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    rawFree(ptr);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++tAllocations;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+    void* ptr = _aligned_malloc(size ? size : 1, align);
+#else
+    // aligned_alloc 要求大小是对齐值的整数倍
+    void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(ptr, alignment);
+}
+
+// ==================== malloc 系列（仅 glibc） ====================
+// 可执行文件中定义的同名符号优先于 libc，Qt 库内部的分配也会经过这里
+
+#if defined(__GLIBC__)
+extern "C" {
+
+void* malloc(size_t size) noexcept
+{
+    ++tAllocations;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept
+{
+    ++tAllocations;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept
+{
+    ++tAllocations;
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) noexcept
+{
+    __libc_free(ptr);
+}
+
+}  // extern "C"
+#endif
@@ -0,0 +1,39 @@
+/**
+ * @file AllocationCounter.h
+ * @brief 堆分配计数钩子（AllocationTest 使用）
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+namespace SnakeGame {
+
+/**
+ * @brief 堆分配计数器
+ *
+ * AllocationCounter.cpp 替换了全局 operator new/delete；在 glibc 上还接管了
+ * malloc/calloc/realloc/free，因为 Qt 容器通过 malloc 而不是 operator new 分配。
+ * 计数按线程保存，工作线程之间互不干扰，每次分配只多一次线程局部自增。
+ */
+class AllocationCounter {
+public:
+    /**
+     * @brief 当前线程累计的分配次数
+     * @return 分配次数（只增不减，取两次之差即为区间内的分配次数）
+     */
+    static quint64 count();
+
+    /**
+     * @brief 是否同时统计 malloc 系列函数
+     * @return false 时只统计 operator new，Qt 容器的分配不会被计入
+     */
+    static bool coversMalloc();
+};
+
+}  // namespace SnakeGame
+
+#endif  // ALLOCATIONCOUNTER_H
@@ -0,0 +1,119 @@
+/**
+ * @file AllocationTest.cpp
+ * @brief 零分配回归测试：稳定运行时 GameLogic::step() 不做堆分配
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <cstdio>
+#include <random>
+#include "AllocationCounter.h"
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "GameLogic.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 每种配置计入检查的帧数 */
+constexpr qint64 kTicks = 1000000;
+
+/**
+ * @brief 一种被检查的对局配置
+ */
+struct AllocationCase {
+    const char* controller;     ///< 控制器名称
+    int foodCount;              ///< 同时存在的食物数量
+    bool distanceField;         ///< 是否维护距离场
+};
+
+/**
+ * @brief 统计稳定运行期间 step() 内的堆分配次数（单线程）
+ *
+ * 第一局完整运行作为预热（控制器缓存等一次性分配），
+ * 之后按局序号依次开局，只统计 step() 内的分配，重开本身不计入。
+ */
+quint64 countSteadyStateAllocations(const BatchConfig& config, qint64 ticks)
+{
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+
+    GameLogic game(config.boardWidth, config.boardHeight);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    game.setFoodCount(config.foodCount);
+    game.setDistanceFieldEnabled(config.distanceField);
+    game.setController(ControllerFactory::create(config.controller, config.boardWidth,
+                                                 config.boardHeight, generator));
+
+    const qint64 cells = static_cast<qint64>(config.boardWidth) * config.boardHeight;
+    const qint64 maxTicks = cells * cells;
+
+    // 预热局：不计数
+    engine.seed(BatchRunner::seedForGame(config.seed, 0));
+    game.resetGame();
+    game.startGame();
+    for (qint64 tick = 0; game.getState() == GameState::Running && tick < maxTicks; ++tick) {
+        game.step();
+    }
+
+    quint64 allocations = 0;
+    qint64 counted = 0;
+    for (qint64 index = 1; counted < ticks; ++index) {
+        engine.seed(BatchRunner::seedForGame(config.seed, index));
+        game.resetGame();
+        game.startGame();
+
+        for (qint64 tick = 0; game.getState() == GameState::Running &&
+                              tick < maxTicks && counted < ticks; ++tick, ++counted) {
+            const quint64 before = AllocationCounter::count();
+            game.step();
+            allocations += AllocationCounter::count() - before;
+        }
+    }
+    return allocations;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const AllocationCase cases[] = {
+        {"random", 1, false},
+        {"greedy", 1, false},
+        {"hamilton", 1, false},
+        {"greedy", 4, true},
+    };
+
+    int failures = 0;
+    for (const AllocationCase& item : cases) {
+        BatchConfig config;
+        config.controller = item.controller;
+        config.foodCount = item.foodCount;
+        config.distanceField = item.distanceField;
+
+        const quint64 allocations = countSteadyStateAllocations(config, kTicks);
+        std::printf("controller=%s foods=%d distance-field=%d board=%dx%d ticks=%lld "
+                    "allocations=%llu\n",
+                    item.controller, item.foodCount, item.distanceField ? 1 : 0,
+                    config.boardWidth, config.boardHeight, static_cast<long long>(kTicks),
+                    static_cast<unsigned long long>(allocations));
+        if (allocations != 0) {
+            ++failures;
+        }
+    }
+
+    std::printf("AllocationTest: %s (%s)\n", failures == 0 ? "passed" : "FAILED",
+                AllocationCounter::coversMalloc() ? "operator new + malloc" : "operator new only");
+    return failures == 0 ? 0 : 1;
+}
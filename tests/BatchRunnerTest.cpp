@@ -0,0 +1,144 @@
+/**
+ * @file BatchRunnerTest.cpp
+ * @brief 批量模拟回归测试：每局从初始状态开始，结果与线程数和蛇身存储方式无关
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QList>
+#include <QMap>
+#include <cstdio>
+#include "BatchRunner.h"
+#include "Constants.h"
+#include "ResultWriter.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/**
+ * @brief 运行一批对局，返回按局序号排列的 CSV 行（不含表头）
+ */
+QMap<qint64, QByteArray> runBatch(const BatchConfig& config)
+{
+    QMap<qint64, QByteArray> lines;
+    FILE* out = std::tmpfile();
+    if (!out) {
+        return lines;
+    }
+
+    ResultWriter writer(out, ResultWriter::Format::Csv);
+    BatchRunner runner(config, &writer);
+    runner.run();
+
+    std::rewind(out);
+    char line[256];
+    bool header = true;
+    while (std::fgets(line, sizeof(line), out)) {
+        if (header) {
+            header = false;
+            continue;
+        }
+        const QByteArray text(line);
+        lines.insert(text.left(text.indexOf(',')).toLongLong(), text);
+    }
+    std::fclose(out);
+    return lines;
+}
+
+/**
+ * @brief 检查一个控制器在小步数上限下的结果
+ * @return 发现的错误数
+ */
+int checkController(const QString& controller)
+{
+    BatchConfig config;
+    config.games = 500;
+    config.controller = controller;
+    config.boardWidth = 10;
+    config.boardHeight = 10;
+    config.seed = 7;
+    // 步数上限远小于一局的长度，大多数对局以超时结束，下一局必须重新开始
+    config.maxTicks = 5;
+
+    config.threads = 1;
+    const QMap<qint64, QByteArray> serial = runBatch(config);
+    config.threads = 4;
+    const QMap<qint64, QByteArray> parallel = runBatch(config);
+
+    int failures = 0;
+    if (serial.size() != config.games || parallel.size() != config.games) {
+        std::fprintf(stderr, "%s: expected %lld games, got %d and %d\n",
+                     qPrintable(controller), static_cast<long long>(config.games),
+                     static_cast<int>(serial.size()), static_cast<int>(parallel.size()));
+        return 1;
+    }
+
+    for (auto it = serial.constBegin(); it != serial.constEnd(); ++it) {
+        // game,seed,score,length,ticks,outcome
+        const QList<QByteArray> fields = it.value().trimmed().split(',');
+        const int score = fields.value(2).toInt();
+        const int length = fields.value(3).toInt();
+        const qint64 ticks = fields.value(4).toLongLong();
+        const int eaten = length - Constants::kInitialSnakeLength;
+        if (ticks > config.maxTicks || eaten < 0 || eaten > ticks ||
+            score != eaten * Constants::kScorePerFood) {
+            std::fprintf(stderr, "%s: game did not start fresh: %s",
+                         qPrintable(controller), it.value().constData());
+            ++failures;
+        }
+        if (parallel.value(it.key()) != it.value()) {
+            std::fprintf(stderr, "%s: game %lld differs with 4 threads:\n  %s  %s",
+                         qPrintable(controller), static_cast<long long>(it.key()),
+                         it.value().constData(), parallel.value(it.key()).constData());
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief 完整对局下比较紧凑蛇身与默认存储的逐局结果
+ * @return 发现的错误数
+ */
+int checkCompactBody(const QString& controller)
+{
+    BatchConfig config;
+    config.games = 200;
+    config.threads = 1;
+    config.controller = controller;
+    config.boardWidth = 10;
+    config.boardHeight = 10;
+    config.seed = 11;
+
+    const QMap<qint64, QByteArray> vector = runBatch(config);
+    config.compactBody = true;
+    const QMap<qint64, QByteArray> compact = runBatch(config);
+
+    if (vector.size() != config.games || compact != vector) {
+        std::fprintf(stderr, "%s: results differ with the compact body\n", qPrintable(controller));
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    int failures = 0;
+    for (const char* controller : {"hamilton", "greedy", "random"}) {
+        failures += checkController(controller);
+        failures += checkCompactBody(controller);
+    }
+
+    std::printf("BatchRunnerTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file BoardDiffTest.cpp
+ * @brief 增量差异回归测试：跳帧、回退和状态变化后画面与观测张量都与实际局面一致，
+ *        观测的墙平面包含关卡障碍物
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QFile>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "BoardDiff.h"
+#include "GameLogic.h"
+#include "Level.h"
+#include "ObservationBuilder.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 棋盘宽度 */
+constexpr int kWidth = 12;
+
+/** @brief 棋盘高度 */
+constexpr int kHeight = 10;
+
+/** @brief 对局数 */
+constexpr int kGames = 100;
+
+/**
+ * @brief 按蛇身和食物计算每格应显示的内容（蛇优先于食物）
+ */
+std::vector<BoardDiff::Cell> expectedCells(const QVector<QPoint>& body, const QVector<QPoint>& foods)
+{
+    std::vector<BoardDiff::Cell> cells(kWidth * kHeight, BoardDiff::Cell::Empty);
+    for (const QPoint& food : foods) {
+        cells[food.y() * kWidth + food.x()] = BoardDiff::Cell::Food;
+    }
+    for (int i = body.size() - 1; i >= 0; --i) {
+        const QPoint& pos = body[i];
+        if (pos.x() >= 0 && pos.x() < kWidth && pos.y() >= 0 && pos.y() < kHeight) {
+            cells[pos.y() * kWidth + pos.x()] = i == 0 ? BoardDiff::Cell::Head : BoardDiff::Cell::Body;
+        }
+    }
+    return cells;
+}
+
+/**
+ * @brief 模拟只看快照的增量渲染器：维护一份屏幕，只应用 BoardDiff 给出的变化
+ */
+class Screen {
+public:
+    Screen()
+        : diff_(kWidth, kHeight)
+        , cells_(kWidth * kHeight, BoardDiff::Cell::Empty)
+        , state_(GameState::Ready)
+        , rewinds_(0)
+        , redraws_(0)
+    {
+    }
+
+    /**
+     * @brief 按 GameLogic 的信号顺序（状态、食物、蛇身）接收一帧
+     */
+    void show(GameState state, int rewinds, const QVector<QPoint>& foods,
+              const QVector<QPoint>& body) {
+        if (state != state_ || rewinds != rewinds_) {
+            diff_.invalidate();
+            state_ = state;
+            rewinds_ = rewinds;
+        }
+
+        diff_.setFoods(foods);
+        apply();
+        if (diff_.setSnake(body)) {
+            ++redraws_;
+            for (int y = 0; y < kHeight; ++y) {
+                for (int x = 0; x < kWidth; ++x) {
+                    cells_[y * kWidth + x] = diff_.cellAt(x, y);
+                }
+            }
+        } else {
+            apply();
+        }
+    }
+
+    void show(const GameLogic& game) {
+        show(game.getState(), game.getRewindCount(), game.getFoodPositions(), game.getSnakeBody());
+    }
+
+    const std::vector<BoardDiff::Cell>& cells() const { return cells_; }
+    int redraws() const { return redraws_; }
+
+private:
+    BoardDiff diff_;
+    std::vector<BoardDiff::Cell> cells_;
+    GameState state_;
+    int rewinds_;
+    int redraws_;
+
+    void apply() {
+        for (const BoardDiff::Change& change : diff_.changes()) {
+            cells_[change.pos.y() * kWidth + change.pos.x()] = change.cell;
+        }
+    }
+};
+
+/**
+ * @brief 读取 uint8 观测张量中的一个元素
+ */
+int plane(const ObservationBuilder& observation, ObservationBuilder::Plane which, int x, int y)
+{
+    const uchar* data = static_cast<const uchar*>(observation.data());
+    return data[which * observation.planeStride() + (y + 1) * observation.rowStride() + x + 1];
+}
+
+/**
+ * @brief 检查观测张量与局面一致
+ * @return 发现的错误数
+ */
+int checkObservation(const ObservationBuilder& observation, const GameLogic& game,
+                     const std::vector<BoardDiff::Cell>& expected)
+{
+    int failures = 0;
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            const BoardDiff::Cell cell = expected[y * kWidth + x];
+            const bool head = plane(observation, ObservationBuilder::Head, x, y) != 0;
+            const bool body = plane(observation, ObservationBuilder::Body, x, y) != 0;
+            const bool food = plane(observation, ObservationBuilder::Food, x, y) != 0;
+            if (head != (cell == BoardDiff::Cell::Head) ||
+                body != (cell == BoardDiff::Cell::Head || cell == BoardDiff::Cell::Body) ||
+                food != (cell == BoardDiff::Cell::Food)) {
+                ++failures;
+            }
+        }
+    }
+
+    // 第 i 节的年龄（当前帧序号减去占据帧序号）必须等于 i；
+    // 撞到自身的那一帧蛇头与某节重叠，那一格以蛇头为准
+    const QVector<QPoint>& body = game.getSnakeBody();
+    for (int i = 0; i < body.size(); ++i) {
+        const QPoint& pos = body[i];
+        if (pos.x() < 0 || pos.x() >= kWidth || pos.y() < 0 || pos.y() >= kHeight ||
+            (i > 0 && pos == body.first())) {
+            continue;
+        }
+        const int age = (observation.tick() - plane(observation, ObservationBuilder::Age,
+                                                    pos.x(), pos.y())) & 0xFF;
+        if (age != (i & 0xFF)) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief 两帧之间蛇身不连续：第二节仍是上一帧蛇头，但中段和蛇尾已不同
+ * @param name 场景名称（失败时输出）
+ * @param first 上一帧蛇身
+ * @param second 本帧蛇身
+ * @param rewound 两帧之间是否发生了回退
+ * @return 发现的错误数
+ */
+int checkDiscontinuity(const char* name, const QVector<QPoint>& first,
+                       const QVector<QPoint>& second, bool rewound)
+{
+    Screen screen;
+    screen.show(GameState::Running, 0, {}, first);
+    screen.show(GameState::Running, rewound ? 1 : 0, {}, second);
+    if (screen.cells() != expectedCells(second, {})) {
+        std::fprintf(stderr, "%s: screen differs from the board\n", name);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 墙平面：边界环（回绕关卡没有）加关卡障碍物
+ * @param wrap 关卡是否回绕
+ * @return 发现的错误数
+ */
+int checkWalls(bool wrap)
+{
+    const QString path = QString("BoardDiffTest-%1.snkl").arg(wrap ? "wrap" : "walls");
+    const QVector<QPoint> obstacles = {QPoint(5, 7), QPoint(6, 7), QPoint(11, 0)};
+    auto level = std::make_shared<Level>();
+    if (!Level::write(path, kWidth, kHeight, wrap, obstacles) || !level->open(path)) {
+        std::fprintf(stderr, "cannot create the test level\n");
+        QFile::remove(path);
+        return 1;
+    }
+
+    GameLogic game(kWidth, kHeight);
+    game.setAutoTick(false);
+    int failures = game.setLevel(level) ? 0 : 1;
+    game.resetGame();
+
+    ObservationBuilder observation(kWidth, kHeight, ObservationBuilder::Format::UInt8);
+    observation.update(game);
+    for (int y = -1; y <= kHeight; ++y) {
+        for (int x = -1; x <= kWidth; ++x) {
+            const bool border = x < 0 || x >= kWidth || y < 0 || y >= kHeight;
+            const bool expected = border ? !wrap : obstacles.contains(QPoint(x, y));
+            if ((plane(observation, ObservationBuilder::Wall, x, y) != 0) != expected) {
+                std::fprintf(stderr, "%s level: wall plane wrong at %d,%d\n",
+                             wrap ? "wrapping" : "walled", x, y);
+                ++failures;
+            }
+        }
+    }
+
+    game.setLevel(nullptr);
+    level.reset();
+    QFile::remove(path);
+    return failures;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+
+    GameLogic game(kWidth, kHeight);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    game.setFoodCount(3);
+    game.setRewindCapacity(64);
+    game.setController(ControllerFactory::create("greedy", kWidth, kHeight, generator));
+
+    // 跳帧与回退的时机用独立的随机序列，不影响对局本身
+    std::mt19937 chaos(7);
+    Screen screen;
+    ObservationBuilder observation(kWidth, kHeight, ObservationBuilder::Format::UInt8);
+
+    // U 形蛇身回退后走了另一条路：蛇尾仍在旧蛇身上，只能靠回退通知发现
+    const QVector<QPoint> bent = {QPoint(1, 1), QPoint(1, 0), QPoint(0, 0), QPoint(0, 1)};
+    int failures = checkDiscontinuity(
+        "rewind", bent, {QPoint(2, 1), QPoint(1, 1), QPoint(0, 1), QPoint(0, 0)}, true);
+    // 跳过若干帧后蛇尾不在旧蛇身上，不需要通知也要整帧重建
+    failures += checkDiscontinuity(
+        "skipped frames", bent, {QPoint(1, 2), QPoint(1, 1), QPoint(2, 1), QPoint(2, 2)}, false);
+    failures += checkWalls(false);
+    failures += checkWalls(true);
+
+    qint64 frames = 0;
+    auto check = [&]() {
+        const std::vector<BoardDiff::Cell> expected =
+            expectedCells(game.getSnakeBody(), game.getFoodPositions());
+        screen.show(game);
+        observation.update(game);
+        ++frames;
+        if (screen.cells() != expected) {
+            std::fprintf(stderr, "screen differs from the board at frame %lld\n",
+                         static_cast<long long>(frames));
+            ++failures;
+        }
+        const int wrong = checkObservation(observation, game, expected);
+        if (wrong != 0) {
+            std::fprintf(stderr, "observation has %d wrong cells at frame %lld\n", wrong,
+                         static_cast<long long>(frames));
+            ++failures;
+        }
+    };
+
+    const qint64 maxTicks = kWidth * kHeight * 50;
+    for (int index = 0; index < kGames && failures == 0; ++index) {
+        engine.seed(BatchRunner::seedForGame(3, index));
+        game.resetGame();
+        check();
+        game.startGame();
+
+        for (qint64 tick = 0; game.getState() == GameState::Running && tick < maxTicks; ++tick) {
+            game.step();
+
+            // 偶尔回退若干帧再继续（包括已结束的对局）
+            if (chaos() % 40 == 0) {
+                game.rewind(1 + static_cast<int>(chaos() % 20));
+                if (chaos() % 2 == 0) {
+                    check();
+                }
+                game.resumeGame();
+            }
+
+            // 模拟 UI 落后于模拟线程：约三分之一的帧被跳过
+            if (chaos() % 3 != 0 || game.getState() != GameState::Running) {
+                check();
+            }
+        }
+    }
+
+    std::printf("BoardDiffTest: %s (%lld frames, %d full redraws)\n",
+                failures == 0 ? "passed" : "FAILED", static_cast<long long>(frames),
+                screen.redraws());
+    return failures == 0 ? 0 : 1;
+}
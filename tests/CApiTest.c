@@ -0,0 +1,337 @@
+/**
+ * @file CApiTest.c
+ * @brief C 语言接口回归测试：以 C 编译（同时验证 snakecore.h 是合法的 C 头文件），
+ *        覆盖创建、重置、单步、观测、批量推进（含观测步长）、自动重开与销毁
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snakecore.h"
+
+/** @brief 棋盘宽度 */
+#define WIDTH 10
+
+/** @brief 棋盘高度 */
+#define HEIGHT 8
+
+/** @brief 观测张量四周墙的宽度 */
+#define PADDING 2
+
+/** @brief 批量推进的对局数 */
+#define ENVS 4
+
+/** @brief 批量观测之间留出的额外字节（检查不越界写入） */
+#define GAP 40
+
+/** @brief 批量推进的步数 */
+#define BATCH_STEPS 400
+
+/** @brief 观测平面：蛇头、蛇身、占据帧序号、食物、墙 */
+enum { PLANE_HEAD, PLANE_BODY, PLANE_AGE, PLANE_FOOD, PLANE_WALL, PLANE_COUNT };
+
+static int failures = 0;
+
+/**
+ * @brief 条件不成立时记录一条失败
+ */
+#define CHECK(condition, ...)                   \
+    do {                                        \
+        if (!(condition)) {                     \
+            fprintf(stderr, __VA_ARGS__);       \
+            fprintf(stderr, "\n");              \
+            ++failures;                         \
+        }                                       \
+    } while (0)
+
+/**
+ * @brief 读取观测张量中棋盘坐标 (x, y) 处的元素（uint8 或 float32）
+ */
+static float element(const snake_observation_info* info, const void* data, int plane, int x, int y)
+{
+    const size_t index = ((size_t)plane * info->height + (size_t)(y + PADDING)) * info->width +
+                         (size_t)(x + PADDING);
+    if (info->element_size == 1) {
+        return ((const unsigned char*)data)[index];
+    }
+    {
+        float value;
+        memcpy(&value, (const unsigned char*)data + index * sizeof(float), sizeof(float));
+        return value;
+    }
+}
+
+/**
+ * @brief 检查观测张量与蛇身、食物和边界墙一致
+ * @param name 场景名称（失败时输出）
+ */
+static void checkObservation(const char* name, snake_env* env, const void* data)
+{
+    snake_observation_info info;
+    int32_t body[WIDTH * HEIGHT * 2];
+    int32_t foods[WIDTH * HEIGHT * 2];
+    int head = 0;
+    int marked = 0;
+    int length;
+    int count;
+    int i;
+    int x;
+    int y;
+
+    snake_observation_info_get(env, &info);
+    length = snake_copy_body(env, body, WIDTH * HEIGHT);
+    count = snake_foods(env, foods, WIDTH * HEIGHT);
+
+    for (y = 0; y < HEIGHT; ++y) {
+        for (x = 0; x < WIDTH; ++x) {
+            head += element(&info, data, PLANE_HEAD, x, y) != 0.0f;
+            marked += element(&info, data, PLANE_BODY, x, y) != 0.0f;
+        }
+    }
+    CHECK(head == 1, "%s: %d head cells", name, head);
+    CHECK(element(&info, data, PLANE_HEAD, body[0], body[1]) != 0.0f,
+          "%s: head plane misses the head", name);
+    CHECK(marked <= length, "%s: body plane marks %d cells for length %d", name, marked, length);
+    for (i = 0; i < length; ++i) {
+        CHECK(element(&info, data, PLANE_BODY, body[2 * i], body[2 * i + 1]) != 0.0f,
+              "%s: body plane misses segment %d", name, i);
+    }
+    for (i = 0; i < count; ++i) {
+        CHECK(element(&info, data, PLANE_FOOD, foods[2 * i], foods[2 * i + 1]) != 0.0f,
+              "%s: food plane misses food %d", name, i);
+    }
+
+    /* 非回绕棋盘四周是墙 */
+    for (y = -PADDING; y < HEIGHT + PADDING; ++y) {
+        for (x = -PADDING; x < WIDTH + PADDING; ++x) {
+            const int border = x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT;
+            CHECK((element(&info, data, PLANE_WALL, x, y) != 0.0f) == border,
+                  "%s: wall plane wrong at %d,%d", name, x, y);
+        }
+    }
+}
+
+/**
+ * @brief 默认参数加上测试用的棋盘
+ */
+static snake_config testConfig(uint64_t seed, int32_t format)
+{
+    snake_config config;
+    snake_config_init(&config);
+    config.board_width = WIDTH;
+    config.board_height = HEIGHT;
+    config.seed = seed;
+    config.observation_format = format;
+    config.observation_padding = PADDING;
+    return config;
+}
+
+/**
+ * @brief 每 3 步顺时针转一次，绕 3×3 的小圈；吃到食物变长后会撞到自身
+ */
+static int32_t actionFor(int step, int lane)
+{
+    static const int32_t cycle[] = {
+        SNAKE_ACTION_UP, SNAKE_ACTION_RIGHT, SNAKE_ACTION_DOWN, SNAKE_ACTION_LEFT
+    };
+    return (step + lane) % 3 == 0 ? cycle[((step + lane) / 3) % 4] : SNAKE_ACTION_NONE;
+}
+
+/**
+ * @brief 创建、观测、单步直到结束、重置、参数检查
+ */
+static void checkSingle(void)
+{
+    snake_config config = testConfig(7, SNAKE_OBS_FLOAT32);
+    snake_observation_info info;
+    snake_step_result result;
+    snake_env* env;
+    void* observation;
+    int32_t status = SNAKE_OK;
+    int steps = 0;
+
+    CHECK(snake_abi_version() == SNAKECORE_ABI_VERSION, "ABI version mismatch");
+
+    config.board_width = 2;
+    CHECK(snake_create(&config) == NULL, "invalid board size accepted");
+    config.board_width = WIDTH;
+
+    env = snake_create(&config);
+    CHECK(env != NULL, "cannot create an env");
+    if (!env) {
+        return;
+    }
+
+    CHECK(snake_observation_info_get(env, &info) == SNAKE_OK, "observation_info failed");
+    CHECK(info.planes == PLANE_COUNT && info.width == WIDTH + 2 * PADDING &&
+          info.height == HEIGHT + 2 * PADDING && info.element_size == 4 &&
+          info.byte_size == (size_t)info.planes * info.width * info.height * 4,
+          "observation info %d x %d x %d, %zu bytes", (int)info.planes, (int)info.height,
+          (int)info.width, info.byte_size);
+
+    observation = malloc(info.byte_size);
+    CHECK(snake_observe(env, observation, info.byte_size - 1) == SNAKE_ERROR_BUFFER_TOO_SMALL,
+          "short observation buffer accepted");
+    CHECK(snake_observe(env, observation, info.byte_size) == SNAKE_OK, "observe failed");
+    checkObservation("opening", env, observation);
+    CHECK(snake_step(env, SNAKE_ACTION_RIGHT + 1, &result) == SNAKE_ERROR_INVALID_ARGUMENT,
+          "invalid action accepted");
+
+    /* 一直向上直到撞墙，每步都核对观测 */
+    while (status == SNAKE_OK && steps < WIDTH * HEIGHT) {
+        status = snake_step(env, SNAKE_ACTION_UP, &result);
+        ++steps;
+        CHECK(result.ticks == steps, "ticks %d after %d steps", (int)result.ticks, steps);
+        snake_observe(env, observation, info.byte_size);
+        checkObservation("single step", env, observation);
+        if (result.done) {
+            break;
+        }
+    }
+    CHECK(result.done && result.reason == SNAKE_REASON_WALL, "game did not end at the wall");
+    CHECK(snake_step(env, SNAKE_ACTION_NONE, &result) == SNAKE_ERROR_GAME_OVER && result.done,
+          "step after game over did not report it");
+
+    CHECK(snake_reset(env, 9) == SNAKE_OK, "reset failed");
+    CHECK(snake_step(env, SNAKE_ACTION_NONE, &result) == SNAKE_OK && result.ticks == 1 &&
+          !result.done && result.score == 0, "reset did not start a fresh game");
+    snake_observe(env, observation, info.byte_size);
+    checkObservation("after reset", env, observation);
+
+    free(observation);
+    snake_destroy(env);
+    snake_destroy(NULL);
+}
+
+/**
+ * @brief 批量推进与逐个推进结果一致，观测按步长写入且不越过各自的区域
+ */
+static void checkBatch(void)
+{
+    snake_env* batch[ENVS];
+    snake_env* single[ENVS];
+    snake_observation_info info;
+    unsigned char* observations;
+    unsigned char* expected;
+    size_t stride;
+    int step;
+    int i;
+
+    for (i = 0; i < ENVS; ++i) {
+        snake_config config = testConfig(100 + (uint64_t)i, SNAKE_OBS_UINT8);
+        config.auto_reset = 1;
+        batch[i] = snake_create(&config);
+        single[i] = snake_create(&config);
+        if (!batch[i] || !single[i]) {
+            CHECK(0, "cannot create batch envs");
+            return;
+        }
+    }
+
+    snake_observation_info_get(batch[0], &info);
+    stride = info.byte_size + GAP;
+    observations = malloc(stride * ENVS);
+    /* 句柄记住上次写入的缓冲区并只改写变化的格子，每局要有自己的一块 */
+    expected = malloc(info.byte_size * ENVS);
+    memset(observations, 0xA5, stride * ENVS);
+
+    for (step = 0; step < BATCH_STEPS && failures == 0; ++step) {
+        int32_t actions[ENVS];
+        snake_step_result results[ENVS];
+        for (i = 0; i < ENVS; ++i) {
+            actions[i] = actionFor(step, i);
+        }
+        CHECK(snake_step_batch(batch, ENVS, actions, results, observations, stride) == SNAKE_OK,
+              "step_batch failed at step %d", step);
+
+        for (i = 0; i < ENVS; ++i) {
+            snake_step_result result;
+            int byte;
+            snake_step(single[i], actions[i], &result);
+            CHECK(memcmp(&result, &results[i], sizeof(result)) == 0,
+                  "env %d: batch result differs at step %d", i, step);
+
+            snake_observe(single[i], expected + i * info.byte_size, info.byte_size);
+            CHECK(memcmp(expected + i * info.byte_size, observations + i * stride,
+                         info.byte_size) == 0,
+                  "env %d: batch observation differs at step %d", i, step);
+            checkObservation("batch", batch[i], observations + i * stride);
+            for (byte = 0; byte < GAP; ++byte) {
+                CHECK(observations[i * stride + info.byte_size + byte] == 0xA5,
+                      "env %d: wrote past its observation at step %d", i, step);
+            }
+        }
+    }
+
+    CHECK(snake_step_batch(NULL, ENVS, NULL, NULL, NULL, 0) == SNAKE_ERROR_INVALID_ARGUMENT,
+          "null batch accepted");
+    CHECK(snake_step_batch(NULL, 0, NULL, NULL, NULL, 0) == SNAKE_OK, "empty batch rejected");
+
+    free(expected);
+    free(observations);
+    for (i = 0; i < ENVS; ++i) {
+        snake_destroy(batch[i]);
+        snake_destroy(single[i]);
+    }
+}
+
+/**
+ * @brief 自动重开：结束那一步的结果描述刚结束的对局，下一步已在新的一局中
+ */
+static void checkAutoReset(void)
+{
+    snake_config config = testConfig(3, SNAKE_OBS_UINT8);
+    snake_step_result result;
+    snake_env* env;
+    int32_t initialLength;
+    int games = 0;
+    int truncated = 0;
+    int step;
+
+    config.auto_reset = 1;
+    config.max_ticks = 40;
+    env = snake_create(&config);
+    CHECK(env != NULL, "cannot create an auto-reset env");
+    if (!env) {
+        return;
+    }
+    initialLength = snake_copy_body(env, NULL, 0);
+
+    for (step = 0; step < 2000 && games < 20; ++step) {
+        const int32_t status = snake_step(env, actionFor(step, 0), &result);
+        CHECK(status == SNAKE_OK, "auto-reset env returned %d", (int)status);
+        CHECK(result.ticks <= config.max_ticks, "game ran %d ticks past max_ticks",
+              (int)result.ticks);
+        if (result.done || result.truncated) {
+            ++games;
+            truncated += result.truncated;
+            CHECK(result.truncated == (result.ticks == config.max_ticks && !result.done),
+                  "truncated flag wrong after %d ticks", (int)result.ticks);
+            /* 句柄已经处于下一局的初始局面 */
+            CHECK(snake_copy_body(env, NULL, 0) == initialLength,
+                  "auto-reset did not restart the game");
+            CHECK(snake_step(env, SNAKE_ACTION_NONE, &result) == SNAKE_OK && result.ticks == 1 &&
+                  result.score == 0 && !result.done, "next game did not start from tick 0");
+            ++step;
+        }
+    }
+    CHECK(games >= 20, "only %d games finished", games);
+    CHECK(truncated > 0 && truncated < games, "%d of %d games truncated", truncated, games);
+    snake_destroy(env);
+}
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(void)
+{
+    checkSingle();
+    checkBatch();
+    checkAutoReset();
+
+    printf("CApiTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
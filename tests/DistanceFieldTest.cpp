@@ -0,0 +1,215 @@
+/**
+ * @file DistanceFieldTest.cpp
+ * @brief 距离场回归测试：每一帧（含回退后）增量维护的距离场都与重新做一次 BFS 的结果相同，
+ *        覆盖空白棋盘、带障碍物的关卡、回绕关卡以及多个食物
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QFile>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "DistanceField.h"
+#include "GameLogic.h"
+#include "Level.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 棋盘宽度 */
+constexpr int kWidth = 16;
+
+/** @brief 棋盘高度 */
+constexpr int kHeight = 12;
+
+/** @brief 每个场景的对局数 */
+constexpr int kGames = 40;
+
+/**
+ * @brief 按当前局面从食物出发重新做一次多源 BFS
+ *
+ * 蛇身（含蛇头）和障碍物不可通行，回绕关卡越过边界从对侧出现。
+ */
+std::vector<qint32> referenceDistances(const GameLogic& game, bool wrap)
+{
+    std::vector<qint32> distances(kWidth * kHeight, DistanceField::kUnreachable);
+    std::vector<char> blocked(kWidth * kHeight, 0);
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            blocked[y * kWidth + x] = game.isObstacle(QPoint(x, y));
+        }
+    }
+    for (const QPoint& pos : game.getSnakeBody()) {
+        blocked[pos.y() * kWidth + pos.x()] = 1;
+    }
+
+    std::vector<int> queue;
+    for (const QPoint& food : game.getFoodPositions()) {
+        const int cell = food.y() * kWidth + food.x();
+        if (!blocked[cell] && distances[cell] != 0) {
+            distances[cell] = 0;
+            queue.push_back(cell);
+        }
+    }
+
+    static const int kOffsets[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int cell = queue[head];
+        for (const auto& offset : kOffsets) {
+            int x = cell % kWidth + offset[0];
+            int y = cell / kWidth + offset[1];
+            if (wrap) {
+                x = (x + kWidth) % kWidth;
+                y = (y + kHeight) % kHeight;
+            } else if (x < 0 || x >= kWidth || y < 0 || y >= kHeight) {
+                continue;
+            }
+            const int next = y * kWidth + x;
+            if (!blocked[next] && distances[next] == DistanceField::kUnreachable) {
+                distances[next] = distances[cell] + 1;
+                queue.push_back(next);
+            }
+        }
+    }
+    return distances;
+}
+
+/**
+ * @brief 比较距离场与参考 BFS
+ * @return 不一致的格子数
+ */
+int compare(const GameLogic& game, bool wrap)
+{
+    const std::vector<qint32> expected = referenceDistances(game, wrap);
+    const qint32* actual = game.getDistanceField()->data();
+    int wrong = 0;
+    for (int i = 0; i < kWidth * kHeight; ++i) {
+        wrong += actual[i] != expected[i];
+    }
+    return wrong;
+}
+
+/**
+ * @brief 写出测试关卡：一道竖墙、一个角落和跨边界的障碍物（避开开局蛇身所在的行）
+ */
+bool writeLevel(const QString& path, bool wrap)
+{
+    QVector<QPoint> obstacles;
+    for (int y = 1; y < kHeight - 4; ++y) {
+        obstacles.append(QPoint(4, y));
+    }
+    obstacles << QPoint(11, 2) << QPoint(12, 2) << QPoint(12, 3)
+              << QPoint(0, 0) << QPoint(kWidth - 1, 0) << QPoint(0, kHeight - 1)
+              << QPoint(7, kHeight - 1) << QPoint(7, 0);
+    return Level::write(path, kWidth, kHeight, wrap, obstacles);
+}
+
+/**
+ * @brief 跑一个场景的全部对局，每帧比较距离场
+ * @param name 场景名称（失败时输出）
+ * @param levelKind 0 空白棋盘，1 带障碍物，2 带障碍物且回绕
+ * @param foods 同时存在的食物数
+ * @param controllerName 控制器名称
+ * @param frames 累计比较的帧数
+ * @return 发现的错误数
+ */
+int checkScenario(const char* name, int levelKind, int foods, const char* controllerName,
+                  qint64* frames)
+{
+    const bool wrap = levelKind == 2;
+    const QString path = QString("DistanceFieldTest-%1.snkl").arg(levelKind);
+    std::shared_ptr<Level> level;
+    if (levelKind != 0) {
+        level = std::make_shared<Level>();
+        if (!writeLevel(path, wrap) || !level->open(path)) {
+            std::fprintf(stderr, "%s: cannot create the level\n", name);
+            QFile::remove(path);
+            return 1;
+        }
+    }
+
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+
+    GameLogic game(kWidth, kHeight);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    game.setFoodCount(foods);
+    game.setRewindCapacity(64);
+    int failures = 0;
+    if (level && !game.setLevel(level)) {
+        std::fprintf(stderr, "%s: level start position is blocked\n", name);
+        ++failures;
+    }
+    game.setDistanceFieldEnabled(true);
+    game.setController(ControllerFactory::create(controllerName, kWidth, kHeight, generator));
+
+    // 回退的时机用独立的随机序列，不影响对局本身
+    std::mt19937 chaos(17);
+    auto check = [&](qint64 tick) {
+        ++*frames;
+        const int wrong = compare(game, wrap);
+        if (wrong != 0) {
+            std::fprintf(stderr, "%s: %d cells differ at tick %lld\n", name, wrong,
+                         static_cast<long long>(tick));
+            ++failures;
+        }
+    };
+
+    const qint64 maxTicks = kWidth * kHeight * 20;
+    for (int index = 0; index < kGames && failures == 0; ++index) {
+        engine.seed(BatchRunner::seedForGame(9, index));
+        game.resetGame();
+        check(0);
+        game.startGame();
+        for (qint64 tick = 1; game.getState() == GameState::Running && tick < maxTicks &&
+             failures == 0; ++tick) {
+            game.step();
+            if (game.getState() != GameState::Running) {
+                break;
+            }
+            check(tick);
+            if (chaos() % 60 == 0) {
+                game.rewind(1 + static_cast<int>(chaos() % 30));
+                check(tick);
+                game.resumeGame();
+            }
+        }
+    }
+
+    game.setLevel(nullptr);
+    level.reset();
+    QFile::remove(path);
+    return failures;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    qint64 frames = 0;
+    int failures = checkScenario("open board, 1 food", 0, 1, "greedy", &frames);
+    failures += checkScenario("open board, 5 foods", 0, 5, "random", &frames);
+    failures += checkScenario("walls, 3 foods", 1, 3, "greedy", &frames);
+    failures += checkScenario("wrapping, 1 food", 2, 1, "greedy", &frames);
+    failures += checkScenario("wrapping, 4 foods", 2, 4, "random", &frames);
+    failures += checkScenario("wrapping, 4 foods, hamilton", 2, 4, "hamilton", &frames);
+
+    std::printf("DistanceFieldTest: %s (%lld frames)\n", failures == 0 ? "passed" : "FAILED",
+                static_cast<long long>(frames));
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file FoodTest.cpp
+ * @brief 食物生成回归测试：稀疏（拒绝采样）与密集（空闲格列表）两种策略下，
+ *        在切换阈值两侧食物都均匀落在可用格上，且同一生成器种子得到相同的序列
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Food.h"
+#include "OccupancyGrid.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 棋盘宽度 */
+constexpr int kWidth = 16;
+
+/** @brief 棋盘高度 */
+constexpr int kHeight = 16;
+
+/** @brief 棋盘格数；空闲格少于 kCells / 8 = 32 时 Food 改用空闲格列表 */
+constexpr int kCells = kWidth * kHeight;
+
+/** @brief 每个可用格期望被选中的次数 */
+constexpr int kExpectedPerCell = 10000;
+
+/**
+ * @brief 一种被检查的占用情况
+ */
+struct FoodCase {
+    int freeCells;      ///< 未被占据的格子数
+    int foods;          ///< 同时存在的食物数量
+    bool dense;         ///< 是否应使用空闲格列表
+};
+
+/**
+ * @brief 按种子随机占据格子，只留下 freeCells 个空闲格
+ */
+void occupy(OccupancyGrid& occupancy, int freeCells, unsigned seed)
+{
+    std::vector<int> order(kCells);
+    for (int i = 0; i < kCells; ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+
+    QVector<QPoint> occupied;
+    for (int i = 0; i < kCells - freeCells; ++i) {
+        occupied.append(QPoint(order[i] % kWidth, order[i] / kWidth));
+    }
+    occupancy.resize(kWidth, kHeight);
+    occupancy.assign(occupied);
+}
+
+/**
+ * @brief 由引擎构造 Food 使用的随机数生成器
+ */
+Food::RandomGenerator makeGenerator(std::mt19937_64& engine)
+{
+    return [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+}
+
+/**
+ * @brief 显著性约 1e-6 的卡方临界值（Wilson–Hilferty 近似）
+ * @param df 自由度
+ */
+double chiSquareLimit(int df)
+{
+    const double z = 4.75;
+    const double k = 2.0 / (9.0 * df);
+    return df * std::pow(1.0 - k + z * std::sqrt(k), 3.0);
+}
+
+/**
+ * @brief 反复补足食物再全部移除，统计每格被选中的次数并做卡方检验
+ * @param item 占用情况
+ * @return 发现的错误数
+ */
+int checkUniform(const FoodCase& item)
+{
+    OccupancyGrid occupancy;
+    occupy(occupancy, item.freeCells, 23);
+
+    std::mt19937_64 engine(static_cast<quint64>(item.freeCells) * 100 + item.foods);
+    Food food(kWidth, kHeight);
+    food.setRandomGenerator(makeGenerator(engine));
+    food.setCount(item.foods);
+
+    std::vector<qint64> hits(kCells, 0);
+    qint64 picks = 0;
+    int failures = 0;
+    const qint64 rounds = static_cast<qint64>(item.freeCells) * kExpectedPerCell / item.foods;
+    for (qint64 round = 0; round < rounds; ++round) {
+        if (food.refill(occupancy) != item.foods) {
+            std::fprintf(stderr, "free=%d foods=%d: refill placed %d foods\n", item.freeCells,
+                         item.foods, static_cast<int>(food.getPositions().size()));
+            return failures + 1;
+        }
+        for (const QPoint& pos : food.getPositions()) {
+            if (occupancy.test(pos)) {
+                std::fprintf(stderr, "free=%d foods=%d: food on an occupied cell\n",
+                             item.freeCells, item.foods);
+                ++failures;
+            }
+            ++hits[pos.y() * kWidth + pos.x()];
+            ++picks;
+        }
+        for (int i = 0; i < item.foods; ++i) {
+            food.removeLast();
+        }
+    }
+
+    if (occupancy.tracksFreeCells() != item.dense) {
+        std::fprintf(stderr, "free=%d foods=%d: expected the %s strategy\n", item.freeCells,
+                     item.foods, item.dense ? "dense" : "sparse");
+        ++failures;
+    }
+
+    const double expected = static_cast<double>(picks) / item.freeCells;
+    double chiSquare = 0.0;
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            if (!occupancy.test(QPoint(x, y))) {
+                const double delta = hits[y * kWidth + x] - expected;
+                chiSquare += delta * delta / expected;
+            }
+        }
+    }
+    const double limit = chiSquareLimit(item.freeCells - 1);
+    std::printf("free=%d foods=%d strategy=%s picks=%lld chi-square=%.1f limit=%.1f\n",
+                item.freeCells, item.foods, item.dense ? "dense" : "sparse",
+                static_cast<long long>(picks), chiSquare, limit);
+    if (chiSquare > limit) {
+        ++failures;
+    }
+    return failures;
+}
+
+/**
+ * @brief 用给定种子依次在各种占用情况下生成食物，记录生成的坐标序列
+ * @param cases 占用情况
+ * @param seed 生成器种子
+ */
+std::vector<QPoint> drawSequence(const std::vector<FoodCase>& cases, quint64 seed)
+{
+    std::mt19937_64 engine(seed);
+    Food food(kWidth, kHeight);
+    food.setRandomGenerator(makeGenerator(engine));
+
+    std::vector<QPoint> sequence;
+    for (const FoodCase& item : cases) {
+        OccupancyGrid occupancy;
+        occupy(occupancy, item.freeCells, 29);
+        food.reset(kWidth, kHeight);
+        food.setCount(item.foods);
+        for (int round = 0; round < 200; ++round) {
+            food.refill(occupancy);
+            sequence.insert(sequence.end(), food.getPositions().begin(),
+                            food.getPositions().end());
+            for (int i = 0; i < item.foods; ++i) {
+                food.removeLast();
+            }
+        }
+    }
+    return sequence;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // 阈值两侧各取几种占用率：32 个空闲格恰好仍走拒绝采样，31 个起改用空闲格列表；
+    // 多个食物时两种策略都要跳过已有食物的格子
+    const std::vector<FoodCase> cases = {
+        {240, 1, false},
+        {200, 3, false},
+        {33, 1, false},
+        {32, 1, false},
+        {32, 4, false},
+        {31, 1, true},
+        {31, 4, true},
+        {12, 1, true},
+        {6, 3, true},
+    };
+
+    int failures = 0;
+    for (const FoodCase& item : cases) {
+        failures += checkUniform(item);
+    }
+
+    // 所有随机数都来自 setRandomGenerator() 设置的生成器：同一种子序列相同，换种子则不同
+    const std::vector<QPoint> first = drawSequence(cases, 1);
+    if (first != drawSequence(cases, 1)) {
+        std::fprintf(stderr, "the same seed produced different food sequences\n");
+        ++failures;
+    }
+    if (first == drawSequence(cases, 2)) {
+        std::fprintf(stderr, "different seeds produced the same food sequence\n");
+        ++failures;
+    }
+
+    std::printf("FoodTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file PerfectPolicyTest.cpp
+ * @brief 最优策略回归测试：导出的策略文件覆盖对局中的每一步，局面数上限生效，
+ *        无法求解时改由哈密顿回路驾驶
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QFile>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include "BatchRunner.h"
+#include "GameLogic.h"
+#include "HamiltonController.h"
+#include "PerfectController.h"
+#include "PerfectSolver.h"
+#include "PolicyTable.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 每个棋盘上用策略表对局的局数 */
+constexpr int kGames = 200;
+
+/**
+ * @brief 导出一个棋盘的策略，再只靠策略表对局
+ * @return 发现的错误数
+ */
+int checkBoard(int width, int height)
+{
+    const QString path = QString("PerfectPolicyTest-%1x%2.snkp").arg(width).arg(height);
+
+    PerfectSolver solver(width, height);
+    GameLogic probe(width, height);
+    probe.resetGame();
+    PerfectSolver::Result opening;
+    if (!solver.solveOpening(probe.getSnakeBody(), &opening) || !solver.savePolicy(path)) {
+        std::fprintf(stderr, "%dx%d: cannot solve or save the policy\n", width, height);
+        return 1;
+    }
+
+    auto policy = std::make_shared<PolicyTable>();
+    if (!policy->open(path)) {
+        std::fprintf(stderr, "%dx%d: cannot open the policy\n", width, height);
+        QFile::remove(path);
+        return 1;
+    }
+
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+    GameLogic game(width, height);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    auto controller = std::make_unique<PerfectController>(policy);
+    const PerfectController* perfect = controller.get();
+    game.setController(std::move(controller));
+
+    int failures = 0;
+    int won = 0;
+    const qint64 maxTicks = static_cast<qint64>(width * height) * width * height;
+    for (int index = 0; index < kGames; ++index) {
+        engine.seed(BatchRunner::seedForGame(1, index));
+        game.resetGame();
+        game.startGame();
+        for (qint64 tick = 0; game.getState() == GameState::Running && tick < maxTicks; ++tick) {
+            game.step();
+        }
+        if (game.getState() == GameState::Running) {
+            std::fprintf(stderr, "%dx%d: game %d did not finish\n", width, height, index);
+            ++failures;
+        }
+        if (game.getGameOverReason() == GameOverReason::BoardFilled) {
+            ++won;
+        }
+    }
+
+    // 按策略走出的每一步（包括食物周期中途）都必须能在表中查到
+    if (perfect->policyMisses() != 0) {
+        std::fprintf(stderr, "%dx%d: %llu moves missed the policy table\n", width, height,
+                     static_cast<unsigned long long>(perfect->policyMisses()));
+        ++failures;
+    }
+
+    std::printf("%dx%d: %d policy entries, expected win rate %.3f, won %d of %d\n",
+                width, height, static_cast<int>(policy->size()), opening.winProbability,
+                won, kGames);
+
+    policy.reset();
+    QFile::remove(path);
+    return failures;
+}
+
+/**
+ * @brief 局面数上限同时约束记忆表和 BFS 节点
+ * @return 发现的错误数
+ */
+int checkStateLimit()
+{
+    PerfectSolver solver(4, 4);
+    GameLogic probe(4, 4);
+    probe.resetGame();
+
+    // 一个周期的 BFS 就会超过这个上限，记忆表本身还远远不到
+    const int limit = 64;
+    solver.setStateLimit(limit);
+    if (solver.solveOpening(probe.getSnakeBody(), nullptr)) {
+        std::fprintf(stderr, "solver ignored a state limit of %d\n", limit);
+        return 1;
+    }
+    if (solver.stateCount() >= limit) {
+        std::fprintf(stderr, "solver kept %d states with a limit of %d\n",
+                     solver.stateCount(), limit);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 无法求解时的对局必须与哈密顿回路控制器逐帧相同
+ * @param name 场景名称（失败时输出）
+ * @param width 棋盘宽度
+ * @param height 棋盘高度
+ * @param stateLimit 现场求解的局面数上限
+ * @return 发现的错误数
+ */
+int checkFallback(const char* name, int width, int height, int stateLimit)
+{
+    // 两局各用一个引擎，以相同种子逐帧并行推进
+    std::mt19937_64 engines[2];
+    GameLogic perfectGame(width, height);
+    GameLogic hamiltonGame(width, height);
+    GameLogic* games[] = {&perfectGame, &hamiltonGame};
+    for (int i = 0; i < 2; ++i) {
+        std::mt19937_64* engine = &engines[i];
+        games[i]->setAutoTick(false);
+        games[i]->setRandomGenerator([engine](int min, int max) {
+            return std::uniform_int_distribution<int>(min, max)(*engine);
+        });
+    }
+    auto controller = std::make_unique<PerfectController>(nullptr, stateLimit);
+    const PerfectController* perfect = controller.get();
+    perfectGame.setController(std::move(controller));
+    hamiltonGame.setController(std::make_unique<HamiltonController>());
+
+    int failures = 0;
+    const qint64 maxTicks = static_cast<qint64>(width * height) * width * height;
+    for (int index = 0; index < 4 && failures == 0; ++index) {
+        for (int i = 0; i < 2; ++i) {
+            engines[i].seed(BatchRunner::seedForGame(2, index));
+            games[i]->resetGame();
+            games[i]->startGame();
+        }
+        for (qint64 tick = 0; perfectGame.getState() == GameState::Running && tick < maxTicks;
+             ++tick) {
+            perfectGame.step();
+            hamiltonGame.step();
+            if (perfectGame.getSnakeBody() != hamiltonGame.getSnakeBody()) {
+                std::fprintf(stderr, "%s: game %d left the Hamiltonian cycle at tick %lld\n",
+                             name, index, static_cast<long long>(tick));
+                ++failures;
+                break;
+            }
+        }
+        if (failures == 0 && perfectGame.getGameOverReason() != GameOverReason::BoardFilled) {
+            std::fprintf(stderr, "%s: game %d did not fill the board\n", name, index);
+            ++failures;
+        }
+    }
+
+    if (!perfect->isFallingBack()) {
+        std::fprintf(stderr, "%s: controller did not report the fallback\n", name);
+        ++failures;
+    }
+    return failures;
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    int failures = checkBoard(4, 2);
+    failures += checkBoard(4, 3);
+    failures += checkStateLimit();
+    failures += checkFallback("8x8 board", 8, 8, PerfectSolver::kDefaultStateLimit);
+    failures += checkFallback("state limit", 4, 4, 64);
+
+    std::printf("PerfectPolicyTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,250 @@
+/**
+ * @file ReplayTest.cpp
+ * @brief 录像回归测试：写出的录像能逐帧播放和任意跳转，
+ *        未正常关闭（缺少索引、末尾截断）的录像重建索引后仍可播放
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <QCoreApplication>
+#include <QFile>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "BatchRunner.h"
+#include "ControllerFactory.h"
+#include "GameLogic.h"
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 棋盘宽度 */
+constexpr int kWidth = 10;
+
+/** @brief 棋盘高度 */
+constexpr int kHeight = 8;
+
+/** @brief 关键帧间隔（取小值让跳转经过多个关键帧） */
+constexpr int kKeyframeInterval = 16;
+
+/** @brief 录制的对局数 */
+constexpr int kGames = 6;
+
+/**
+ * @brief 录制时记下的一帧
+ */
+struct ExpectedFrame {
+    int score;
+    QVector<QPoint> body;
+    QVector<QPoint> foods;
+};
+
+/**
+ * @brief 录制若干局（含回退），每写入一帧就记下当时的局面
+ * @param path 录像文件路径
+ * @param expected 输出：按帧号排列的局面
+ * @return true 录像写入成功
+ */
+bool record(const QString& path, std::vector<ExpectedFrame>* expected)
+{
+    std::mt19937_64 engine;
+    Food::RandomGenerator generator = [&engine](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(engine);
+    };
+
+    ReplayWriter writer(kKeyframeInterval);
+    if (!writer.open(path, kWidth, kHeight)) {
+        return false;
+    }
+
+    GameLogic game(kWidth, kHeight);
+    game.setAutoTick(false);
+    game.setRandomGenerator(generator);
+    game.setFoodCount(2);
+    game.setRewindCapacity(64);
+    game.setController(ControllerFactory::create("greedy", kWidth, kHeight, generator));
+    game.setRecorder(&writer);
+
+    auto capture = [&]() {
+        while (static_cast<qint64>(expected->size()) < writer.frameCount()) {
+            expected->push_back({game.getScore(), game.getSnakeBody(), game.getFoodPositions()});
+        }
+    };
+
+    std::mt19937 chaos(11);
+    for (int index = 0; index < kGames; ++index) {
+        engine.seed(BatchRunner::seedForGame(5, index));
+        game.resetGame();
+        capture();
+        game.startGame();
+        capture();
+        for (int tick = 0; game.getState() == GameState::Running && tick < 2000; ++tick) {
+            game.step();
+            capture();
+            // 回退会开始新的一帧并写入关键帧
+            if (chaos() % 50 == 0) {
+                game.rewind(1 + static_cast<int>(chaos() % 30));
+                capture();
+                game.resumeGame();
+            }
+        }
+    }
+
+    game.setRecorder(nullptr);
+    return writer.close();
+}
+
+/**
+ * @brief 比较读取器当前帧与录制时的局面
+ */
+bool matches(const ReplayReader& reader, const std::vector<ExpectedFrame>& expected)
+{
+    const ReplayFrame& frame = reader.current();
+    if (frame.frame < 0 || frame.frame >= static_cast<qint64>(expected.size())) {
+        return false;
+    }
+    const ExpectedFrame& want = expected[static_cast<size_t>(frame.frame)];
+    return frame.score == want.score && frame.body == want.body && frame.foods == want.foods;
+}
+
+/**
+ * @brief 逐帧播放并随机跳转，每一帧都与录制时的局面比较
+ * @param name 场景名称（失败时输出）
+ * @param reader 已打开的读取器
+ * @param expected 录制时的局面（可能多于录像中的帧）
+ * @return 发现的错误数
+ */
+int checkPlayback(const char* name, ReplayReader& reader,
+                  const std::vector<ExpectedFrame>& expected)
+{
+    const qint64 frames = reader.frameCount();
+    if (!reader.seek(0) || reader.current().frame != 0) {
+        std::fprintf(stderr, "%s: cannot seek to the first frame\n", name);
+        return 1;
+    }
+    for (qint64 frame = 0; frame < frames; ++frame) {
+        if (reader.current().frame != frame || !matches(reader, expected)) {
+            std::fprintf(stderr, "%s: frame %lld differs while stepping\n", name,
+                         static_cast<long long>(frame));
+            return 1;
+        }
+        if (reader.step() != (frame + 1 < frames)) {
+            std::fprintf(stderr, "%s: step failed after frame %lld\n", name,
+                         static_cast<long long>(frame));
+            return 1;
+        }
+    }
+
+    // 随机跳转（前后双向），再从落点前进几帧
+    std::mt19937 jumps(13);
+    for (int i = 0; i < 500; ++i) {
+        const qint64 target = static_cast<qint64>(jumps() % static_cast<quint32>(frames));
+        if (!reader.seek(target) || reader.current().frame != target ||
+            !matches(reader, expected)) {
+            std::fprintf(stderr, "%s: seek to frame %lld failed\n", name,
+                         static_cast<long long>(target));
+            return 1;
+        }
+        for (int j = 0; j < 3 && reader.step(); ++j) {
+            if (!matches(reader, expected)) {
+                std::fprintf(stderr, "%s: frame %lld differs after seeking to %lld\n", name,
+                             static_cast<long long>(reader.current().frame),
+                             static_cast<long long>(target));
+                return 1;
+            }
+        }
+    }
+
+    // 超出范围的帧号截断到首尾
+    if (!reader.seek(-5) || reader.current().frame != 0 ||
+        !reader.seek(frames + 5) || reader.current().frame != frames - 1) {
+        std::fprintf(stderr, "%s: out-of-range seek was not clamped\n", name);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 复制录像的记录区并截掉末尾若干字节，模拟写入时进程被杀死
+ * @return true 写出成功
+ */
+bool writeTruncated(const QString& source, const QString& target, qint64 recordsEnd, int cut)
+{
+    QFile in(source);
+    QFile out(target);
+    if (!in.open(QIODevice::ReadOnly) || !out.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    const QByteArray records = in.read(recordsEnd - cut);
+    return out.write(records) == records.size();
+}
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const QString path = "ReplayTest.snkr";
+    const QString truncatedPath = "ReplayTest-truncated.snkr";
+    std::vector<ExpectedFrame> expected;
+    int failures = 0;
+
+    ReplayReader reader;
+    if (!record(path, &expected) || !reader.open(path)) {
+        std::fprintf(stderr, "cannot write or open the replay\n");
+        failures = 1;
+    } else if (reader.isRecovered() ||
+               reader.frameCount() != static_cast<qint64>(expected.size())) {
+        std::fprintf(stderr, "replay has %lld frames, recorded %lld\n",
+                     static_cast<long long>(reader.frameCount()),
+                     static_cast<long long>(expected.size()));
+        failures = 1;
+    } else {
+        failures += checkPlayback("closed", reader, expected);
+
+        // 记录区之后是索引和尾部
+        const qint64 recordsEnd = QFile(path).size() - ReplayReader::kTrailerSize -
+                                  reader.keyframeCount() * ReplayReader::kIndexEntrySize;
+        const qint64 keyframes = reader.keyframeCount();
+        reader.close();
+
+        for (int cut : {0, 3}) {
+            const QString name = QString("unclosed, %1 bytes cut").arg(cut);
+            ReplayReader recovered;
+            if (!writeTruncated(path, truncatedPath, recordsEnd, cut) ||
+                !recovered.open(truncatedPath) || !recovered.isRecovered()) {
+                std::fprintf(stderr, "%s: cannot open\n", qPrintable(name));
+                ++failures;
+                continue;
+            }
+            // 不截断时重建的索引与文件自带的相同；截断最多丢掉最后一帧
+            const qint64 lost = static_cast<qint64>(expected.size()) - recovered.frameCount();
+            if ((cut == 0 && (lost != 0 || recovered.keyframeCount() != keyframes)) ||
+                (cut != 0 && (lost < 0 || lost > 1))) {
+                std::fprintf(stderr, "%s: %lld frames and %lld keyframes recovered\n",
+                             qPrintable(name), static_cast<long long>(recovered.frameCount()),
+                             static_cast<long long>(recovered.keyframeCount()));
+                ++failures;
+                continue;
+            }
+            failures += checkPlayback(qPrintable(name), recovered, expected);
+        }
+    }
+
+    reader.close();
+    QFile::remove(path);
+    QFile::remove(truncatedPath);
+
+    std::printf("ReplayTest: %s (%lld frames)\n", failures == 0 ? "passed" : "FAILED",
+                static_cast<long long>(expected.size()));
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file TripleBufferTest.cpp
+ * @brief 三缓冲回归测试：不撕裂、只前进、最后提交的值总能读到
+ * @author Snake Game Team
+ * @date 2026-01-15
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "TripleBuffer.h"
+
+using namespace SnakeGame;
+
+namespace {
+
+/** @brief 生产者提交的值的个数 */
+constexpr int kValues = 2000000;
+
+/** @brief 每个值的载荷长度（整段写入同一个序号，用来发现读到写了一半的槽位） */
+constexpr int kPayload = 64;
+
+}  // namespace
+
+/**
+ * @brief 程序入口
+ * @return 0 通过，1 失败
+ */
+int main()
+{
+    TripleBuffer<std::vector<int>> buffer(std::vector<int>(kPayload, 0));
+    std::atomic<bool> done(false);
+    int failures = 0;
+
+    std::thread producer([&]() {
+        for (int value = 1; value <= kValues; ++value) {
+            std::vector<int>* slot = buffer.writeSlot();
+            for (int& item : *slot) {
+                item = value;
+            }
+            buffer.publish();
+        }
+        done.store(true);
+    });
+
+    int last = 0;
+    auto consume = [&]() {
+        const std::vector<int>* slot = buffer.acquireLatest();
+        if (!slot) {
+            return;
+        }
+        const int value = slot->front();
+        for (int item : *slot) {
+            if (item != value) {
+                std::fprintf(stderr, "torn read: %d vs %d\n", item, value);
+                ++failures;
+                break;
+            }
+        }
+        if (value <= last) {
+            std::fprintf(stderr, "value went backwards: %d after %d\n", value, last);
+            ++failures;
+        }
+        last = value;
+    };
+
+    while (!done.load()) {
+        consume();
+    }
+    producer.join();
+    consume();
+
+    // 消费者远慢于生产者，中间的值被覆盖，但最后一个不能丢
+    if (last != kValues) {
+        std::fprintf(stderr, "last value lost: read %d, expected %d\n", last, kValues);
+        ++failures;
+    }
+    if (buffer.published() != static_cast<quint64>(kValues)) {
+        std::fprintf(stderr, "published %llu, expected %d\n",
+                     static_cast<unsigned long long>(buffer.published()), kValues);
+        ++failures;
+    }
+    if (buffer.acquireLatest() != nullptr) {
+        std::fprintf(stderr, "value returned twice\n");
+        ++failures;
+    }
+
+    std::printf("TripleBufferTest: %s (%llu of %d values overwritten before being read)\n",
+                failures == 0 ? "passed" : "FAILED",
+                static_cast<unsigned long long>(buffer.overwritten()), kValues);
+    return failures == 0 ? 0 : 1;
+}